@@ -0,0 +1,254 @@
+#include "BlobStore.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // FNV-1a pe 64 biti
+    std::uint64_t fnv1a64(std::span<const std::uint8_t> bytes)
+    {
+        std::uint64_t h = 14695981039346656037ull;
+        for (std::uint8_t b : bytes)
+            h = (h ^ b) * 1099511628211ull;
+        return h;
+    }
+
+    // MurmurHash64A (independent de FNV, impreuna dau 128 biti)
+    std::uint64_t murmur64(std::span<const std::uint8_t> bytes, std::uint64_t seed)
+    {
+        const std::uint64_t m = 0xc6a4a7935bd1e995ull;
+        const int r = 47;
+        std::uint64_t h = seed ^ (bytes.size() * m);
+
+        std::size_t blocks = bytes.size() / 8;
+        for (std::size_t i = 0; i < blocks; ++i)
+        {
+            std::uint64_t k;
+            std::memcpy(&k, bytes.data() + i * 8, sizeof(k));
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+
+        const std::uint8_t *tail = bytes.data() + blocks * 8;
+        switch (bytes.size() & 7)
+        {
+        case 7: h ^= std::uint64_t(tail[6]) << 48; [[fallthrough]];
+        case 6: h ^= std::uint64_t(tail[5]) << 40; [[fallthrough]];
+        case 5: h ^= std::uint64_t(tail[4]) << 32; [[fallthrough]];
+        case 4: h ^= std::uint64_t(tail[3]) << 24; [[fallthrough]];
+        case 3: h ^= std::uint64_t(tail[2]) << 16; [[fallthrough]];
+        case 2: h ^= std::uint64_t(tail[1]) << 8; [[fallthrough]];
+        case 1: h ^= std::uint64_t(tail[0]);
+                h *= m;
+        }
+
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+
+    // scriere atomica: fisier temporar + rename
+    bool writeFileAtomic(const std::string &path, std::span<const std::uint8_t> bytes)
+    {
+        std::error_code ec;
+        fs::create_directories(fs::path(path).parent_path(), ec);
+        const std::string tmp = path + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            if (!out)
+                return false;
+            out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out)
+                return false;
+        }
+        fs::rename(tmp, path, ec);
+        return !ec;
+    }
+}
+
+BlobStore::BlobStore(std::string rootDir) : root_(std::move(rootDir))
+{
+    std::error_code ec;
+    fs::create_directories(fs::path(root_) / "objects", ec);
+    fs::create_directories(fs::path(root_) / "thumbs", ec);
+    loadIndex();
+}
+
+std::string BlobStore::hashKey(std::span<const std::uint8_t> bytes)
+{
+    static const char *hex = "0123456789abcdef";
+    const std::uint64_t parts[2] = {fnv1a64(bytes), murmur64(bytes, 0x5eed0fb10b5ull)};
+
+    std::string key;
+    key.reserve(32);
+    for (std::uint64_t part : parts)
+        for (int i = 15; i >= 0; --i)
+            key.push_back(hex[(part >> (4 * i)) & 0xF]);
+    return key;
+}
+
+std::string BlobStore::objectPath(const std::string &key) const
+{
+    return (fs::path(root_) / "objects" / key.substr(0, 2) / key).string();
+}
+
+std::string BlobStore::thumbPath(const std::string &key) const
+{
+    return (fs::path(root_) / "thumbs" / key.substr(0, 2) / key).string();
+}
+
+void BlobStore::loadIndex()
+{
+    std::ifstream in((fs::path(root_) / "refs.idx").string());
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream ls(line);
+        std::string key;
+        Entry entry;
+        if (ls >> key >> entry.refs >> entry.size >> entry.thumbSize && entry.refs > 0)
+            entries_[key] = entry;
+    }
+}
+
+bool BlobStore::saveIndex() const
+{
+    std::ostringstream out;
+    for (const auto &[key, entry] : entries_)
+        out << key << ' ' << entry.refs << ' ' << entry.size << ' ' << entry.thumbSize << '\n';
+    const std::string text = out.str();
+    return writeFileAtomic((fs::path(root_) / "refs.idx").string(),
+                           {reinterpret_cast<const std::uint8_t *>(text.data()), text.size()});
+}
+
+std::string BlobStore::put(std::span<const std::uint8_t> bytes)
+{
+    if (bytes.empty())
+        return "";
+
+    const std::string key = hashKey(bytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++puts_;
+
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        // verificam continutul ca o coliziune de hash sa nu amestece doua imagini
+        ImageBlob existing = ImageBlob::mapFile(objectPath(key));
+        if (existing.size() != bytes.size() || std::memcmp(existing.data(), bytes.data(), bytes.size()) != 0)
+            return "";
+
+        ++dedupHits_;
+        ++it->second.refs;
+        saveIndex();
+        return key;
+    }
+
+    if (!writeFileAtomic(objectPath(key), bytes))
+        return "";
+
+    Entry entry;
+    entry.refs = 1;
+    entry.size = bytes.size();
+    if (thumbnailGenerator_)
+    {
+        std::vector<std::uint8_t> thumb = thumbnailGenerator_(bytes);
+        if (!thumb.empty() && writeFileAtomic(thumbPath(key), thumb))
+            entry.thumbSize = thumb.size();
+    }
+    entries_[key] = entry;
+    saveIndex();
+    return key;
+}
+
+bool BlobStore::retain(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+        return false;
+    ++it->second.refs;
+    return saveIndex();
+}
+
+bool BlobStore::release(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+        return false;
+
+    if (--it->second.refs == 0)
+    {
+        // blob-urile deja mapate raman valide pana la munmap
+        std::error_code ec;
+        fs::remove(objectPath(key), ec);
+        fs::remove(thumbPath(key), ec);
+        entries_.erase(it);
+    }
+    return saveIndex();
+}
+
+ImageBlob BlobStore::open(const std::string &key) const
+{
+    if (!contains(key))
+        return {};
+    return ImageBlob::mapFile(objectPath(key), key);
+}
+
+ImageBlob BlobStore::openThumbnail(const std::string &key) const
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end())
+            return {};
+        if (it->second.thumbSize > 0)
+            return ImageBlob::mapFile(thumbPath(key), key);
+    }
+    return open(key);
+}
+
+bool BlobStore::contains(const std::string &key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.count(key) > 0;
+}
+
+std::uint32_t BlobStore::refCount(const std::string &key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    return it == entries_.end() ? 0 : it->second.refs;
+}
+
+BlobStore::Stats BlobStore::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats s;
+    s.puts = puts_;
+    s.dedupHits = dedupHits_;
+    s.uniqueBlobs = entries_.size();
+    for (const auto &[key, entry] : entries_)
+    {
+        s.bytesStored += entry.size;
+        s.thumbnailBytes += entry.thumbSize;
+        // fiecare referinta in plus ar fi fost o copie completa a imaginii
+        s.bytesDeduplicated += entry.size * (entry.refs - 1);
+    }
+    return s;
+}
+
+void BlobStore::setThumbnailGenerator(ThumbnailGenerator generator)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    thumbnailGenerator_ = std::move(generator);
+}
@@ -0,0 +1,398 @@
+#include "ColorAnalyzer.hpp"
+#include "Metrics.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+
+#ifndef DRESSDIARY_SIMD
+#define DRESSDIARY_SIMD 1
+#endif
+
+#if DRESSDIARY_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define DD_COLOR_SSE2 1
+#elif DRESSDIARY_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DD_COLOR_NEON 1
+#endif
+
+namespace
+{
+    // vocabularul din AddItemView (fara "other", pe care analiza nu il produce)
+    enum ColorName : std::uint8_t
+    {
+        Red,
+        Orange,
+        Yellow,
+        Green,
+        Blue,
+        Purple,
+        Pink,
+        Brown,
+        Black,
+        White,
+        Gray,
+        NameCount
+    };
+
+    constexpr const char *Names[NameCount] = {"red", "orange", "yellow", "green", "blue", "purple",
+                                              "pink", "brown", "black", "white", "gray"};
+
+    ColorName classify(int r, int g, int b)
+    {
+        const int maxc = std::max({r, g, b});
+        const int minc = std::min({r, g, b});
+        const float v = maxc / 255.0f;
+        const float s = maxc == 0 ? 0.0f : static_cast<float>(maxc - minc) / maxc;
+        if (v < 0.2f)
+            return Black;
+        if (s < 0.18f)
+            return v > 0.82f ? White : (v < 0.3f ? Black : Gray);
+
+        float h = 0;
+        const float delta = static_cast<float>(maxc - minc);
+        if (maxc == r)
+            h = 60.0f * ((g - b) / delta);
+        else if (maxc == g)
+            h = 60.0f * ((b - r) / delta + 2.0f);
+        else
+            h = 60.0f * ((r - g) / delta + 4.0f);
+        if (h < 0)
+            h += 360.0f;
+
+        if (h < 15 || h >= 345)
+            return s < 0.5f && v > 0.7f ? Pink : Red;
+        if (h < 40)
+            return v < 0.65f || s < 0.45f ? Brown : Orange; // portocaliu inchis / desaturat = maro, bej
+        if (h < 70)
+            return v >= 0.6f && s >= 0.35f ? Yellow : Brown; // mustar inchis, kaki
+        if (h < 170)
+            return Green;
+        if (h < 255)
+            return Blue;
+        if (h < 290)
+            return Purple;
+        return v < 0.5f ? Purple : Pink;
+    }
+
+    // numele culorii pentru fiecare bin (centrul bin-ului), calculat o singura data
+    const std::array<std::uint8_t, ColorAnalyzer::TransparentBin> &binNames()
+    {
+        static const auto table = []
+        {
+            std::array<std::uint8_t, ColorAnalyzer::TransparentBin> names{};
+            for (int bin = 0; bin < ColorAnalyzer::TransparentBin; ++bin)
+                names[bin] = classify(((bin >> 8) << 4) | 8, (((bin >> 4) & 0xF) << 4) | 8, ((bin & 0xF) << 4) | 8);
+            return names;
+        }();
+        return table;
+    }
+
+    // sums[i] += row[i] pentru `bytes` octeti
+    void accumulateRow(const std::uint8_t *row, std::uint32_t *sums, std::size_t bytes, ColorAnalyzer::Kernel kernel)
+    {
+        std::size_t i = 0;
+        const bool simd = kernel == ColorAnalyzer::Kernel::Simd;
+#if DD_COLOR_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; simd && i + 16 <= bytes; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            __m128i *acc = reinterpret_cast<__m128i *>(sums + i);
+            _mm_storeu_si128(acc + 0, _mm_add_epi32(_mm_loadu_si128(acc + 0), _mm_unpacklo_epi16(lo, zero)));
+            _mm_storeu_si128(acc + 1, _mm_add_epi32(_mm_loadu_si128(acc + 1), _mm_unpackhi_epi16(lo, zero)));
+            _mm_storeu_si128(acc + 2, _mm_add_epi32(_mm_loadu_si128(acc + 2), _mm_unpacklo_epi16(hi, zero)));
+            _mm_storeu_si128(acc + 3, _mm_add_epi32(_mm_loadu_si128(acc + 3), _mm_unpackhi_epi16(hi, zero)));
+        }
+#elif DD_COLOR_NEON
+        for (; simd && i + 16 <= bytes; i += 16)
+        {
+            const uint8x16_t v = vld1q_u8(row + i);
+            const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+            const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+            vst1q_u32(sums + i + 0, vaddw_u16(vld1q_u32(sums + i + 0), vget_low_u16(lo)));
+            vst1q_u32(sums + i + 4, vaddw_u16(vld1q_u32(sums + i + 4), vget_high_u16(lo)));
+            vst1q_u32(sums + i + 8, vaddw_u16(vld1q_u32(sums + i + 8), vget_low_u16(hi)));
+            vst1q_u32(sums + i + 12, vaddw_u16(vld1q_u32(sums + i + 12), vget_high_u16(hi)));
+        }
+#else
+        (void)simd;
+#endif
+        for (; i < bytes; ++i)
+            sums[i] += row[i];
+    }
+
+    // [0, count) impartit intre apelant si cel mult executor.threadCount() job-uri, cu un contor
+    // comun. Apelantul asteapta doar indicii deja luati: un job pornit dupa terminarea lotului nu mai
+    // gaseste nimic de facut si nu atinge `work`, deci apelul nu depinde de cat de plina e coada.
+    void parallelFor(Executor &executor, std::size_t count, const std::function<void(std::size_t)> &work)
+    {
+        struct Shared
+        {
+            std::atomic<std::size_t> next{0};
+            std::size_t count = 0;
+            const std::function<void(std::size_t)> *work = nullptr;
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::size_t done = 0;
+            std::exception_ptr error;
+        };
+        auto shared = std::make_shared<Shared>();
+        shared->count = count;
+        shared->work = &work;
+
+        auto run = [shared]
+        {
+            std::size_t done = 0;
+            std::exception_ptr error;
+            for (std::size_t i; (i = shared->next.fetch_add(1, std::memory_order_relaxed)) < shared->count; ++done)
+            {
+                try
+                {
+                    (*shared->work)(i);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            }
+            if (done == 0)
+                return;
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (error && !shared->error)
+                shared->error = error;
+            if ((shared->done += done) == shared->count)
+                shared->finished.notify_all();
+        };
+
+        const std::size_t helpers = std::min<std::size_t>(executor.threadCount(), count > 0 ? count - 1 : 0);
+        for (std::size_t h = 0; h < helpers; ++h)
+            executor.submit(run);
+        run();
+
+        std::unique_lock<std::mutex> lock(shared->mutex);
+        shared->finished.wait(lock, [&] { return shared->done == shared->count; });
+        if (shared->error)
+            std::rethrow_exception(shared->error);
+    }
+}
+
+const char *ColorAnalyzer::kernelName()
+{
+#if DD_COLOR_SSE2
+    return "sse2";
+#elif DD_COLOR_NEON
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+void ColorAnalyzer::downsample(const RgbaImage &src, std::size_t maxSide, RgbaImage &dst, Kernel kernel)
+{
+    if (src.width == 0 || src.height == 0 || maxSide == 0)
+    {
+        dst.width = dst.height = 0;
+        dst.pixels.clear();
+        return;
+    }
+    const std::size_t longSide = std::max(src.width, src.height);
+    const std::size_t factor = (longSide + maxSide - 1) / maxSide;
+    // blocurile incomplete de la margine se ignora
+    const std::size_t blockW = std::min(factor, src.width);
+    const std::size_t blockH = std::min(factor, src.height);
+    dst.width = src.width / blockW;
+    dst.height = src.height / blockH;
+    dst.pixels.resize(dst.width * dst.height * 4);
+
+    // sumele pe coloane ale randurilor unui bloc (vectorizat), apoi suma pe orizontala si media
+    const std::size_t rowBytes = dst.width * blockW * 4;
+    const std::uint32_t area = static_cast<std::uint32_t>(blockW * blockH);
+    std::vector<std::uint32_t> sums(rowBytes);
+    for (std::size_t y = 0; y < dst.height; ++y)
+    {
+        std::fill(sums.begin(), sums.end(), 0);
+        for (std::size_t r = 0; r < blockH; ++r)
+            accumulateRow(src.pixels.data() + (y * blockH + r) * src.width * 4, sums.data(), rowBytes, kernel);
+
+        std::uint8_t *out = dst.pixels.data() + y * dst.width * 4;
+        for (std::size_t x = 0; x < dst.width; ++x)
+        {
+            const std::uint32_t *block = sums.data() + x * blockW * 4;
+            std::uint32_t total[4] = {0, 0, 0, 0};
+            for (std::size_t k = 0; k < blockW; ++k)
+                for (int c = 0; c < 4; ++c)
+                    total[c] += block[k * 4 + c];
+            for (int c = 0; c < 4; ++c)
+                out[x * 4 + c] = static_cast<std::uint8_t>((total[c] + area / 2) / area);
+        }
+    }
+}
+
+void ColorAnalyzer::quantize(const std::uint8_t *rgba, std::size_t pixels, std::uint16_t *bins, Kernel kernel)
+{
+    std::size_t i = 0;
+    const bool simd = kernel == Kernel::Simd;
+#if DD_COLOR_SSE2
+    // 4 pixeli pe iteratie, ca u32 little-endian: r | g << 8 | b << 16 | a << 24
+    static_assert(std::endian::native == std::endian::little);
+    const __m128i nibble = _mm_set1_epi32(0xF);
+    const __m128i halfAlpha = _mm_set1_epi32(127);
+    const __m128i transparent = _mm_set1_epi32(TransparentBin);
+    for (; simd && i + 4 <= pixels; i += 4)
+    {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgba + i * 4));
+        const __m128i r = _mm_and_si128(_mm_srli_epi32(p, 4), nibble);
+        const __m128i g = _mm_and_si128(_mm_srli_epi32(p, 12), nibble);
+        const __m128i b = _mm_and_si128(_mm_srli_epi32(p, 20), nibble);
+        __m128i bin = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 8), _mm_slli_epi32(g, 4)), b);
+        const __m128i opaque = _mm_cmpgt_epi32(_mm_srli_epi32(p, 24), halfAlpha);
+        bin = _mm_or_si128(_mm_and_si128(opaque, bin), _mm_andnot_si128(opaque, transparent));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(bins + i), _mm_packs_epi32(bin, bin));
+    }
+#elif DD_COLOR_NEON
+    // 16 pixeli pe iteratie, canalele separate de vld4
+    const uint8x16_t halfAlpha = vdupq_n_u8(128);
+    const uint16x8_t transparent = vdupq_n_u16(TransparentBin);
+    for (; simd && i + 16 <= pixels; i += 16)
+    {
+        const uint8x16x4_t p = vld4q_u8(rgba + i * 4);
+        const uint8x16_t r = vshrq_n_u8(p.val[0], 4);
+        const uint8x16_t g = vshrq_n_u8(p.val[1], 4);
+        const uint8x16_t b = vshrq_n_u8(p.val[2], 4);
+        const uint8x16_t opaque = vcgeq_u8(p.val[3], halfAlpha);
+
+        const uint16x8_t binLo = vorrq_u16(vorrq_u16(vshlq_n_u16(vmovl_u8(vget_low_u8(r)), 8),
+                                                     vshlq_n_u16(vmovl_u8(vget_low_u8(g)), 4)),
+                                           vmovl_u8(vget_low_u8(b)));
+        const uint16x8_t binHi = vorrq_u16(vorrq_u16(vshlq_n_u16(vmovl_u8(vget_high_u8(r)), 8),
+                                                     vshlq_n_u16(vmovl_u8(vget_high_u8(g)), 4)),
+                                           vmovl_u8(vget_high_u8(b)));
+        // masca 0x00 / 0xFF extinsa cu semn la 0x0000 / 0xFFFF
+        const uint16x8_t maskLo = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_low_u8(opaque))));
+        const uint16x8_t maskHi = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_high_u8(opaque))));
+        vst1q_u16(bins + i, vbslq_u16(maskLo, binLo, transparent));
+        vst1q_u16(bins + i + 8, vbslq_u16(maskHi, binHi, transparent));
+    }
+#else
+    (void)simd;
+#endif
+    for (; i < pixels; ++i)
+    {
+        const std::uint8_t *p = rgba + i * 4;
+        bins[i] = p[3] >= 128 ? static_cast<std::uint16_t>((p[0] >> 4) << 8 | (p[1] >> 4) << 4 | p[2] >> 4)
+                              : TransparentBin;
+    }
+}
+
+ColorAnalyzer::Analysis ColorAnalyzer::analyzePixels(const RgbaImage &image, Kernel kernel)
+{
+    Analysis analysis;
+    analysis.width = image.width;
+    analysis.height = image.height;
+    if (image.pixels.size() < image.pixelCount() * 4)
+        return analysis;
+
+    RgbaImage small;
+    downsample(image, SampleSide, small, kernel);
+    const std::size_t w = small.width, h = small.height;
+    if (w == 0 || h == 0)
+        return analysis;
+    std::vector<std::uint16_t> bins(w * h);
+    quantize(small.pixels.data(), bins.size(), bins.data(), kernel);
+
+    // marginea (fundalul probabil) si zona centrala, numarate separat pe nume
+    const std::size_t ring = std::max<std::size_t>(1, std::min(w, h) / 16);
+    const std::size_t insetX = w / 8, insetY = h / 8;
+    const auto &names = binNames();
+    std::array<std::size_t, NameCount> border{}, center{};
+    std::array<std::array<std::uint64_t, 3>, NameCount> sums{};
+    std::size_t borderTotal = 0, centerTotal = 0;
+    for (std::size_t y = 0; y < h; ++y)
+        for (std::size_t x = 0; x < w; ++x)
+        {
+            const std::uint16_t bin = bins[y * w + x];
+            if (bin == TransparentBin)
+                continue;
+            const std::uint8_t name = names[bin];
+            if (x < ring || y < ring || x >= w - ring || y >= h - ring)
+            {
+                ++border[name];
+                ++borderTotal;
+            }
+            if (x >= insetX && x < w - insetX && y >= insetY && y < h - insetY)
+            {
+                const std::uint8_t *p = small.pixels.data() + (y * w + x) * 4;
+                ++center[name];
+                ++centerTotal;
+                for (int c = 0; c < 3; ++c)
+                    sums[name][c] += p[c];
+            }
+        }
+    if (centerTotal == 0)
+        return analysis;
+
+    // culoarea care acopera cel putin 60% din margine e fundalul; o ignoram daca articolul
+    // (restul zonei centrale) are macar 15% din pixeli
+    const auto background = std::max_element(border.begin(), border.end()) - border.begin();
+    std::size_t counted = centerTotal;
+    if (borderTotal > 0 && border[background] * 10 >= borderTotal * 6 &&
+        (centerTotal - center[background]) * 100 >= centerTotal * 15)
+    {
+        counted -= center[background];
+        center[background] = 0;
+    }
+
+    for (int name = 0; name < NameCount; ++name)
+    {
+        const std::size_t n = center[name];
+        if (n == 0 || n * 100 < counted) // sub 1%: zgomot
+            continue;
+        Swatch swatch;
+        swatch.name = Names[name];
+        swatch.share = static_cast<float>(n) / counted;
+        swatch.r = static_cast<std::uint8_t>(sums[name][0] / n);
+        swatch.g = static_cast<std::uint8_t>(sums[name][1] / n);
+        swatch.b = static_cast<std::uint8_t>(sums[name][2] / n);
+        analysis.colors.push_back(std::move(swatch));
+    }
+    std::stable_sort(analysis.colors.begin(), analysis.colors.end(),
+                     [](const Swatch &a, const Swatch &b) { return a.share > b.share; });
+    return analysis;
+}
+
+ColorAnalyzer::Analysis ColorAnalyzer::analyze(std::span<const std::uint8_t> encoded) const
+{
+    DD_METRIC_SCOPE("ColorAnalyzer::analyze");
+    Decoder decoder;
+    {
+        std::shared_lock lock(mutex_);
+        decoder = decoder_;
+    }
+    RgbaImage image;
+    if (!decoder || encoded.empty() || !decoder(encoded, DecodeMaxSide, image))
+        return {};
+    DD_METRIC_COUNT("ColorAnalyzer.pixelsDecoded", image.pixelCount());
+    return analyzePixels(image);
+}
+
+std::vector<ColorAnalyzer::Analysis> ColorAnalyzer::analyzeBatch(std::span<const ImageBlob> images, Executor &executor) const
+{
+    DD_METRIC_SCOPE("ColorAnalyzer::analyzeBatch");
+    std::vector<Analysis> results(images.size());
+    parallelFor(executor, images.size(), [&](std::size_t i) { results[i] = analyze(images[i]); });
+    return results;
+}
+
+std::vector<ColorAnalyzer::Analysis> ColorAnalyzer::analyzePixelsBatch(std::span<const RgbaImage> images, Executor &executor)
+{
+    std::vector<Analysis> results(images.size());
+    parallelFor(executor, images.size(), [&](std::size_t i) { results[i] = analyzePixels(images[i]); });
+    return results;
+}
@@ -1,46 +1,46 @@
 #include "DataManager.hpp"
-#include "CurrentUser.hpp"
+#include "ItemFactory.hpp"
 #include "Utilities.hpp"
-#include <random>
+#include "Metrics.hpp"
+#include <stdexcept>
+#include <algorithm>
 #include <chrono>
-
-// Declarații funcții externe din CoreDataAdapter.mm
-extern bool objcCreateUser(const std::string &, const std::string &, const std::string &);
-extern std::shared_ptr<User> objcLoginUser(const std::string &, const std::string &);
-extern bool objcUpdateUserLoginMeta(const std::string &, const std::string &, int);
-
-extern std::vector<std::shared_ptr<ClothingItem>> objcFetchClothingItems(const std::string &);
-extern bool objcSaveClothingItem(const std::string &, const ClothingItem &);
-extern bool objcDeleteClothingItem(const std::string &, int);
-
-extern std::vector<std::shared_ptr<Outfit>> objcFetchOutfits(const std::string &);
-extern bool objcSaveOutfit(const std::string &, const Outfit &);
-extern bool objcDeleteOutfit(const std::string &, const std::string &);
+#include <optional>
 
 // Implementarea functiilor din header
 
 bool DataManager::createUser(const std::string &username, const std::string &name, const std::string &password)
 {
-    return objcCreateUser(username, name, password);
+    DD_METRIC_SCOPE("DataManager::createUser");
+    auto backend = getBackend();
+    if (!backend)
+        return false;
+    return worker_.submit([&] { return backend->createUser(username, name, password); }).get();
 }
 
 std::shared_ptr<User> DataManager::loginUser(const std::string &username, const std::string &password)
 {
-    auto userPtr = objcLoginUser(username, password);
+    DD_METRIC_SCOPE("DataManager::loginUser");
+    WriteLock lock = writeLock(username);
+    if (!backend_)
+        return nullptr;
+
+    auto backend = backend_;
+    auto userPtr = worker_.submit([&] { return backend->loginUser(username, password); }).get();
     if (!userPtr)
     {
         return nullptr;
     }
 
     // Actualizare streak și lastLoginDate
-    std::string today = getTodayDate();
-    std::string lastDate = userPtr->getLastLogIn();
+    const Date today = Date::today();
+    const Date lastDate = userPtr->getLastLogIn();
 
     if (lastDate.empty())
         userPtr->setStreak(1);
     else
     {
-        int delta = daysBetween(lastDate, today);
+        int delta = today - lastDate;
         if (delta == 0)
         {
             // deja logat azi → nu schimb streak
@@ -51,114 +51,1516 @@ std::shared_ptr<User> DataManager::loginUser(const std::string &username, const
             userPtr->setStreak(1);
     }
 
+    // userul se rezolva o singura data; handle-ul e folosit de toate operatiile urmatoare
+    UserHandlePtr handle = worker_.submit([&] { return backend->resolveUser(username); }).get();
+    if (!handle)
+        return nullptr;
+    shardFor(username).handles[username] = handle;
+
     userPtr->setLastLogIn(today);
-    objcUpdateUserLoginMeta(username, today, userPtr->getStreak());
+    persist(username, [handle, today, streak = userPtr->getStreak()](StorageBackend &b)
+            { return b.updateUserLoginMeta(*handle, today, streak); });
 
-    CurrentUser::getInstance().setUser(userPtr);
+    loadCache(handle);
     return userPtr;
 }
 
+std::shared_ptr<User> DataManager::recoverUser(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::recoverUser");
+    WriteLock lock = writeLock(username);
+    if (!backend_)
+        return nullptr;
+
+    auto backend = backend_;
+    auto userPtr = worker_.submit([&] { return backend->recoverUser(username); }).get();
+    if (!userPtr)
+        return nullptr;
+
+    UserHandlePtr handle = worker_.submit([&] { return backend->resolveUser(username); }).get();
+    if (!handle)
+        return nullptr;
+    shardFor(username).handles[username] = handle;
+
+    loadCache(handle);
+    return userPtr;
+}
+
+bool DataManager::updateDarkMode(const std::string &username, bool isDarkMode)
+{
+    DD_METRIC_SCOPE("DataManager::updateDarkMode");
+    return submitUpdateDarkMode(username, isDarkMode).get();
+}
+
+std::future<bool> DataManager::submitUpdateDarkMode(const std::string &username, bool isDarkMode)
+{
+    DD_METRIC_SCOPE("DataManager::submitUpdateDarkMode");
+    WriteLock lock = writeLock(username);
+    UserHandlePtr handle = handleFor(username);
+    if (!handle)
+        return ready(false);
+    return persist(username, [handle, isDarkMode](StorageBackend &b) { return b.updateUserDarkMode(*handle, isDarkMode); });
+}
+
+// generatoarele backend-urilor sunt atomice; nu trec prin coada de scrieri
+int DataManager::generateNextClothingItemId()
+{
+    DD_METRIC_SCOPE("DataManager::generateNextClothingItemId");
+    auto backend = getBackend();
+    return backend ? backend->generateNextClothingItemId() : 0;
+}
+
+std::string DataManager::generateNextOutfitId()
+{
+    DD_METRIC_SCOPE("DataManager::generateNextOutfitId");
+    auto backend = getBackend();
+    return backend ? backend->generateNextOutfitId() : "";
+}
+
+// cache management
+UserHandlePtr DataManager::handleFor(const std::string &username)
+{
+    if (!backend_)
+        return nullptr;
+    auto &handles = shardFor(username).handles;
+    auto it = handles.find(username);
+    if (it != handles.end())
+        return it->second;
+
+    auto backend = backend_;
+    UserHandlePtr handle = worker_.submit([&] { return backend->resolveUser(username); }).get();
+    if (handle)
+        handles[username] = handle;
+    return handle;
+}
+
+void DataManager::loadCache(const UserHandlePtr &user)
+{
+    DD_METRIC_SCOPE("DataManager::loadCache");
+    WardrobeCache cache;
+    cache.user = user;
+
+    // prin coada: citirea vede toate scrierile trimise inainte
+    auto backend = backend_;
+    std::vector<std::shared_ptr<Outfit>> outfits;
+    std::vector<WearRecord> wears;
+    if (!loadSnapshot(*user, cache, outfits, wears))
+    {
+        cache.items = worker_.submit([&]
+                                     {
+                                         outfits = backend->fetchOutfits(*user);
+                                         wears = backend->fetchWearRecords(*user);
+                                         return backend->fetchClothingItems(*user); })
+                          .get();
+        DD_METRIC_COUNT("DataManager.backendFetches", 3);
+        // urmatoarea incarcare vine din snapshot
+        scheduleSnapshot(user->username());
+    }
+    DD_METRIC_COUNT("DataManager.itemsLoaded", cache.items.size());
+    DD_METRIC_COUNT("DataManager.outfitsLoaded", outfits.size());
+    cache.itemSlots.reserve(cache.items.size());
+    cache.table.reserve(cache.items.size());
+    for (std::size_t i = 0; i < cache.items.size(); ++i)
+    {
+        cache.itemSlots[cache.items[i].id] = i;
+        cache.itemOrder.insert(cache.items[i].id);
+        cache.index.insertItem(i, cache.items[i]);
+        cache.table.push(cache.items[i]);
+        cache.wear.trackItem(cache.items[i]);
+    }
+
+    cache.outfits = std::move(outfits);
+    cache.outfitSlots.reserve(cache.outfits.size());
+    cache.join.reserve(cache.items.size(), cache.outfits.size());
+    cache.recommender.reserve(cache.outfits.size());
+    for (std::size_t i = 0; i < cache.items.size(); ++i)
+        cache.join.pushItem();
+    for (std::size_t i = 0; i < cache.outfits.size(); ++i)
+    {
+        cache.outfitSlots[cache.outfits[i]->getId()] = i;
+        cache.outfitOrder.insert(cache.outfits[i]->getId());
+        cache.index.insertOutfit(i, *cache.outfits[i]);
+        indexItemSet(cache, *cache.outfits[i]);
+        cache.join.pushOutfit(itemSlotsOf(cache, *cache.outfits[i]));
+        cache.recommender.pushOutfit(*cache.outfits[i]);
+        cache.wear.trackOutfit(cache.outfits[i]->getId());
+    }
+
+    // istoricul purtarilor: agregatele si ultimele purtari din recomandari se refac o singura data
+    if (!wears.empty())
+    {
+        cache.wear.reserve(wears.size());
+        cache.wear.append(wears);
+        std::unordered_map<std::uint64_t, std::size_t> slotByKey;
+        slotByKey.reserve(cache.outfits.size());
+        for (std::size_t i = 0; i < cache.outfits.size(); ++i)
+            slotByKey[WearLog::outfitKey(cache.outfits[i]->getId())] = i;
+        for (const WearRecord &record : wears)
+        {
+            if (!record.isOutfit())
+                continue;
+            auto slot = slotByKey.find(record.outfitKey);
+            if (slot != slotByKey.end())
+                cache.recommender.markWorn(slot->second, record.date());
+        }
+    }
+
+    shardFor(user->username()).caches[user->username()] = std::move(cache);
+}
+
+bool DataManager::loadSnapshot(const UserHandle &user, WardrobeCache &cache, std::vector<std::shared_ptr<Outfit>> &outfits,
+                               std::vector<WearRecord> &wears)
+{
+    if (snapshotDir_.empty())
+        return false;
+    DD_METRIC_SCOPE("DataManager::loadSnapshot");
+    auto backend = backend_;
+    const std::uint64_t revision = worker_.submit([&] { return backend->dataRevision(user); }).get();
+    if (revision == 0)
+        return false;
+    auto snapshot = WardrobeSnapshot::open(snapshotPath(user.username()));
+    if (!snapshot || snapshot->revision() != revision || snapshot->username() != user.username())
+    {
+        DD_METRIC_COUNT("DataManager.snapshotMisses", 1);
+        return false;
+    }
+
+    cache.items = snapshot->items(blobStore_.get());
+    outfits = snapshot->outfits();
+    wears.assign(snapshot->wears().begin(), snapshot->wears().end());
+    DD_METRIC_COUNT("DataManager.snapshotHits", 1);
+    std::lock_guard<std::mutex> lock(snapshotWriteMutex_);
+    snapshotRevisions_[user.username()] = revision;
+    return true;
+}
+
+DataManager::WardrobeCache *DataManager::cacheFor(const std::string &username)
+{
+    if (!backend_)
+        return nullptr;
+    auto &caches = shardFor(username).caches;
+    auto it = caches.find(username);
+    if (it != caches.end() && takeStale(username))
+    {
+        caches.erase(it);
+        it = caches.end();
+    }
+    if (it == caches.end())
+    {
+        UserHandlePtr handle = handleFor(username);
+        if (!handle)
+            return nullptr;
+        loadCache(handle);
+        it = caches.find(username);
+    }
+    return &it->second;
+}
+
+const DataManager::WardrobeCache *DataManager::findCache(const std::string &username) const
+{
+    const auto &caches = shardFor(username).caches;
+    auto it = caches.find(username);
+    if (it == caches.end() || isStale(username))
+        return nullptr;
+    return &it->second;
+}
+
+// estimare grosiera: record-urile plus un cost fix per articol / outfit pentru structurile
+// paralele (slot-uri, ordine, index, coloane, join, recomandari); imaginile nu intra,
+// fiindca sunt mapate si partajate prin BlobStore
+std::size_t DataManager::getCacheBytes(const std::string &username) const
+{
+    constexpr std::size_t PerItem = 256;
+    constexpr std::size_t PerOutfit = 320;
+    ReadLock lock = readLock(username);
+    const WardrobeCache *cache = findCache(username);
+    if (!cache)
+        return 0;
+    return cache->items.capacity() * sizeof(ItemRecord) + cache->items.size() * PerItem +
+           cache->outfits.size() * PerOutfit + cache->wear.size() * sizeof(WearRecord);
+}
+
+void DataManager::markStale(const std::string &username)
+{
+    std::lock_guard<std::mutex> lock(staleMutex_);
+    staleUsers_.insert(username);
+}
+
+bool DataManager::isStale(const std::string &username) const
+{
+    std::lock_guard<std::mutex> lock(staleMutex_);
+    return staleUsers_.count(username) > 0;
+}
+
+bool DataManager::takeStale(const std::string &username)
+{
+    std::lock_guard<std::mutex> lock(staleMutex_);
+    return staleUsers_.erase(username) > 0;
+}
+
+std::future<bool> DataManager::persist(const std::string &username, std::function<bool(StorageBackend &)> write,
+                                       std::vector<std::string> imageKeys, std::vector<std::string> releasedKeys)
+{
+    return worker_.submit([this, backend = backend_, blobs = blobStore_, username, write = std::move(write),
+                           imageKeys = std::move(imageKeys), releasedKeys = std::move(releasedKeys)]
+                          {
+                              DD_METRIC_SCOPE("DataManager::persist(write)");
+                              if (write(*backend))
+                              {
+                                  // randurile vechi nu mai exista: imaginile lor pot fi sterse
+                                  if (blobs)
+                                      for (const auto &key : releasedKeys)
+                                          blobs->release(key);
+                                  return true;
+                              }
+                              DD_METRIC_COUNT("DataManager.failedWrites", 1);
+                              // cache-ul are deja modificarea: il reincarcam din backend la urmatorul acces
+                              if (blobs)
+                                  for (const auto &key : imageKeys)
+                                      if (!key.empty())
+                                          blobs->release(key);
+                              markStale(username);
+                              std::lock_guard<std::mutex> lock(snapshotMutex_);
+                              ++snapshotFailures_[username];
+                              return false; });
+}
+
+std::future<bool> DataManager::persistWardrobe(const std::string &username, std::function<bool(StorageBackend &)> write,
+                                               std::vector<std::string> imageKeys,
+                                               std::vector<std::string> releasedKeys)
+{
+    auto persisted = persist(username, std::move(write), std::move(imageKeys), std::move(releasedKeys));
+    scheduleSnapshot(username);
+    return persisted;
+}
+
+// snapshot-uri
+
+std::string DataManager::snapshotPath(const std::string &username) const
+{
+    return snapshotDir_ + "/" + WardrobeSnapshot::fileName(username);
+}
+
+void DataManager::scheduleSnapshot(const std::string &username)
+{
+    if (snapshotDir_.empty())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        // o rescriere care n-a inceput inca prinde si modificarea asta
+        if (!snapshotPending_.insert(username).second)
+            return;
+        ++snapshotJobs_;
+    }
+    executor_.submit([this, username]
+                     {
+                         writeSnapshot(username);
+                         std::lock_guard<std::mutex> lock(snapshotMutex_);
+                         if (--snapshotJobs_ == 0)
+                             snapshotIdle_.notify_all(); });
+}
+
+void DataManager::writeSnapshot(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::writeSnapshot");
+    std::uint64_t failures = 0;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshotPending_.erase(username);
+        failures = snapshotFailures_[username];
+    }
+
+    // copia cache-ului e ieftina (imaginile si outfit-urile sunt partajate); encode-ul ruleaza fara lock
+    std::vector<ItemRecord> items;
+    std::vector<std::shared_ptr<Outfit>> outfits;
+    std::vector<WearRecord> wears;
+    std::string path;
+    std::future<std::uint64_t> revision;
+    {
+        ReadLock lock = readLock(username);
+        const WardrobeCache *cache = findCache(username);
+        if (!cache || snapshotDir_.empty())
+            return;
+        items = cache->items;
+        outfits = cache->outfits;
+        wears = cache->wear.records();
+        path = snapshotPath(username);
+        // in coada dupa scrierile deja aplicate in cache: versiunea le include pe toate
+        revision = worker_.submit([backend = backend_, user = cache->user] { return backend->dataRevision(*user); });
+    }
+    const std::uint64_t rev = revision.get();
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        if (rev == 0 || snapshotFailures_[username] != failures)
+            return;
+    }
+
+    WardrobeSnapshot::Contents contents;
+    contents.username = username;
+    contents.revision = rev;
+    contents.items = items;
+    contents.outfits = outfits;
+    contents.wears = wears;
+    const std::vector<std::uint8_t> bytes = WardrobeSnapshot::encode(contents);
+
+    // doua rescrieri pot termina in alta ordine: ramane cea cu versiunea mai noua
+    std::lock_guard<std::mutex> lock(snapshotWriteMutex_);
+    std::uint64_t &written = snapshotRevisions_[username];
+    if (rev <= written)
+        return;
+    if (WardrobeSnapshot::writeFile(path, bytes))
+    {
+        written = rev;
+        DD_METRIC_COUNT("DataManager.snapshotBytes", bytes.size());
+    }
+}
+
+std::future<bool> DataManager::ready(bool value)
+{
+    std::promise<bool> done;
+    done.set_value(value);
+    return done.get_future();
+}
+
+// slot-urile articolelor unui outfit (id-urile fara articol in cache sunt ignorate)
+std::vector<OutfitJoin::Slot> DataManager::itemSlotsOf(const WardrobeCache &cache, const Outfit &outfit)
+{
+    std::vector<OutfitJoin::Slot> slots;
+    slots.reserve(outfit.getItemIds().size());
+    for (int id : outfit.getItemIds())
+    {
+        auto it = cache.itemSlots.find(id);
+        if (it != cache.itemSlots.end())
+            slots.push_back(static_cast<OutfitJoin::Slot>(it->second));
+    }
+    return slots;
+}
+
+std::vector<int> DataManager::linkedItemIds(const WardrobeCache &cache, const Outfit &outfit)
+{
+    std::vector<int> linked;
+    linked.reserve(outfit.getItemSet().size());
+    for (int id : outfit.getItemSet())
+        if (cache.itemSlots.count(id) && (linked.empty() || linked.back() != id))
+            linked.push_back(id);
+    return linked;
+}
+
+void DataManager::indexItemSet(WardrobeCache &cache, const Outfit &outfit)
+{
+    cache.outfitsByItemSet[outfit.getItemSetHash()].push_back(outfit.getId());
+}
+
+void DataManager::unindexItemSet(WardrobeCache &cache, const Outfit &outfit)
+{
+    auto it = cache.outfitsByItemSet.find(outfit.getItemSetHash());
+    if (it == cache.outfitsByItemSet.end())
+        return;
+    std::erase(it->second, outfit.getId());
+    if (it->second.empty())
+        cache.outfitsByItemSet.erase(it);
+}
+
+std::shared_ptr<Outfit> DataManager::duplicateOf(const WardrobeCache &cache, const std::vector<int> &itemSet,
+                                                 const std::string &exceptId)
+{
+    auto it = cache.outfitsByItemSet.find(Outfit::hashItemSet(itemSet));
+    if (it == cache.outfitsByItemSet.end())
+        return nullptr;
+    // acelasi hash: comparam si multimile (coliziuni)
+    for (const auto &outfitId : it->second)
+    {
+        if (outfitId == exceptId)
+            continue;
+        const auto &candidate = cache.outfits[cache.outfitSlots.at(outfitId)];
+        if (candidate->getItemSet() == itemSet)
+            return candidate;
+    }
+    return nullptr;
+}
+
+bool DataManager::rejectsOutfits(const WardrobeCache &cache, std::span<const Outfit> outfits,
+                                 const std::vector<std::vector<int>> &itemSets) const
+{
+    if (duplicatePolicy_ != DuplicateOutfitPolicy::Reject)
+        return false;
+    std::set<std::vector<int>> seen;
+    for (std::size_t i = 0; i < outfits.size(); ++i)
+        if (duplicateOf(cache, itemSets[i], outfits[i].getId()) || !seen.insert(itemSets[i]).second)
+            return true;
+    return false;
+}
+
+DataManager::ResolvedOutfit DataManager::resolveOutfit(const WardrobeCache &cache, std::size_t slot)
+{
+    ResolvedOutfit resolved;
+    resolved.outfit = cache.outfits[slot];
+    auto itemSlots = cache.join.itemsOf(slot);
+    resolved.items.reserve(itemSlots.size());
+    for (OutfitJoin::Slot item : itemSlots)
+        resolved.items.push_back(cache.items[item]);
+    return resolved;
+}
+
+void DataManager::notifyItems(const std::string &username, const ItemsDelta &delta)
+{
+    if (delta.empty())
+        return;
+    ItemsChangedCallback callback;
+    {
+        std::shared_lock lock(mutex_);
+        callback = itemsChangedCallback_;
+    }
+    if (callback)
+        callback(username, delta);
+}
+
+void DataManager::notifyOutfits(const std::string &username, const OutfitsDelta &delta)
+{
+    if (delta.empty())
+        return;
+    OutfitsChangedCallback callback;
+    {
+        std::shared_lock lock(mutex_);
+        callback = outfitsChangedCallback_;
+    }
+    if (callback)
+        callback(username, delta);
+}
+
 // clothing items management
+std::vector<ItemRecord>
+DataManager::getItemRecords(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getItemRecords");
+    return readCache(username, [](const WardrobeCache &cache) { return cache.items; });
+}
+
+ItemBatch DataManager::getItemBatch(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getItemBatch");
+    return readCache(username, [](const WardrobeCache &cache) { return ItemBatch(cache.items); });
+}
+
 std::vector<std::shared_ptr<ClothingItem>>
 DataManager::getClothingItems(const std::string &username)
 {
-    return objcFetchClothingItems(username);
+    DD_METRIC_SCOPE("DataManager::getClothingItems");
+    return readCache(username, [](const WardrobeCache &cache)
+                     {
+                         std::vector<std::shared_ptr<ClothingItem>> result;
+                         result.reserve(cache.items.size());
+                         for (const auto &record : cache.items)
+                             result.push_back(ItemFactory::fromRecord(record));
+                         return result; });
 }
 
-bool DataManager::saveClothingItem(const std::string &username, const ClothingItem &item)
+ItemCursor DataManager::openItemCursor(const std::string &username, int resumeAfter)
 {
-    bool ok = objcSaveClothingItem(username, item);
-    if (ok && itemsChangedCallback_)
+    return ItemCursor([this, username](const int &after, std::size_t limit)
+                      { return getItemRecordPage(username, after, limit); },
+                      [](const ItemRecord &item) { return item.id; }, resumeAfter);
+}
+
+OutfitCursor DataManager::openOutfitCursor(const std::string &username, std::string resumeAfter)
+{
+    return OutfitCursor([this, username](const std::string &after, std::size_t limit)
+                        { return getOutfitPage(username, after, limit); },
+                        [](const std::shared_ptr<Outfit> &outfit) { return outfit->getId(); }, std::move(resumeAfter));
+}
+
+std::vector<ItemRecord> DataManager::getItemRecordPage(const std::string &username, int afterId, std::size_t limit)
+{
+    DD_METRIC_SCOPE("DataManager::getItemRecordPage");
+    {
+        ReadLock lock = readLock(username);
+        if (const WardrobeCache *cache = findCache(username))
+        {
+            std::vector<ItemRecord> page;
+            for (auto id = cache->itemOrder.upper_bound(afterId); id != cache->itemOrder.end() && page.size() < limit; ++id)
+                page.push_back(cache->items[cache->itemSlots.at(*id)]);
+            return page;
+        }
+    }
+
+    // fara cache: doar pagina ceruta, prin coada (vede scrierile trimise inainte)
+    UserHandlePtr handle;
+    std::shared_ptr<StorageBackend> backend;
+    {
+        WriteLock lock = writeLock(username);
+        handle = handleFor(username);
+        backend = backend_;
+    }
+    if (!handle)
+        return {};
+    DD_METRIC_COUNT("DataManager.backendFetches", 1);
+    return worker_.submit([&] { return backend->fetchClothingItemPage(*handle, afterId, limit); }).get();
+}
+
+std::vector<std::shared_ptr<Outfit>> DataManager::getOutfitPage(const std::string &username, const std::string &afterId,
+                                                                std::size_t limit)
+{
+    DD_METRIC_SCOPE("DataManager::getOutfitPage");
+    {
+        ReadLock lock = readLock(username);
+        if (const WardrobeCache *cache = findCache(username))
+        {
+            std::vector<std::shared_ptr<Outfit>> page;
+            for (auto id = cache->outfitOrder.upper_bound(afterId); id != cache->outfitOrder.end() && page.size() < limit; ++id)
+                page.push_back(cache->outfits[cache->outfitSlots.at(*id)]);
+            return page;
+        }
+    }
+
+    UserHandlePtr handle;
+    std::shared_ptr<StorageBackend> backend;
+    {
+        WriteLock lock = writeLock(username);
+        handle = handleFor(username);
+        backend = backend_;
+    }
+    if (!handle)
+        return {};
+    DD_METRIC_COUNT("DataManager.backendFetches", 1);
+    return worker_.submit([&] { return backend->fetchOutfitPage(*handle, afterId, limit); }).get();
+}
+
+// cat se copiaza intre doua verificari ale token-ului
+static constexpr std::size_t CancellationStride = 256;
+
+std::vector<ItemRecord>
+DataManager::getItemRecords(const std::string &username, const CancellationToken &token)
+{
+    DD_METRIC_SCOPE("DataManager::getItemRecords(token)");
+    token.throwIfCancelled();
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<ItemRecord> result;
+                         result.reserve(cache.items.size());
+                         for (std::size_t i = 0; i < cache.items.size(); ++i)
+                         {
+                             if (i % CancellationStride == 0)
+                                 token.throwIfCancelled();
+                             result.push_back(cache.items[i]);
+                         }
+                         return result; });
+}
+
+std::future<std::vector<ItemRecord>>
+DataManager::getItemRecordsAsync(const std::string &username, CancellationToken token)
+{
+    DD_METRIC_SCOPE("DataManager::getItemRecordsAsync");
+    return executor_.submit(token, [this, username, token] { return getItemRecords(username, token); });
+}
+
+std::future<std::vector<std::shared_ptr<ClothingItem>>>
+DataManager::getClothingItemsAsync(const std::string &username, CancellationToken token)
+{
+    DD_METRIC_SCOPE("DataManager::getClothingItemsAsync");
+    return executor_.submit(token, [this, username, token]
+                            {
+                                std::vector<std::shared_ptr<ClothingItem>> result;
+                                auto records = getItemRecords(username, token);
+                                result.reserve(records.size());
+                                for (std::size_t i = 0; i < records.size(); ++i)
+                                {
+                                    if (i % CancellationStride == 0)
+                                        token.throwIfCancelled();
+                                    result.push_back(ItemFactory::fromRecord(records[i]));
+                                }
+                                return result; });
+}
+
+// imaginea trece prin BlobStore: o singura copie pe disc pentru continut identic.
+// Intoarce cheia pentru care s-a luat o referinta (gol daca nu exista).
+std::string DataManager::storeImage(ItemRecord &item)
+{
+    std::string imageKey = item.image.key();
+    if (blobStore_)
+    {
+        if (!imageKey.empty())
+            blobStore_->retain(imageKey);
+        else if (!item.image.empty())
+        {
+            imageKey = blobStore_->put(item.image.bytes());
+            if (!imageKey.empty())
+                item.image = blobStore_->open(imageKey);
+        }
+    }
+    return imageKey;
+}
+
+void DataManager::cacheItem(WardrobeCache &cache, ItemRecord &&item, ItemsDelta &delta,
+                            std::vector<std::string> &releasedKeys)
+{
+    const int itemId = item.id;
+    auto slot = cache.itemSlots.find(itemId);
+    if (slot != cache.itemSlots.end())
     {
-        itemsChangedCallback_();
+        // articolul inlocuit nu mai tine referinta la imaginea veche
+        ItemRecord &old = cache.items[slot->second];
+        if (blobStore_ && !old.image.key().empty())
+            releasedKeys.push_back(old.image.key());
+        cache.index.eraseItem(slot->second, old);
+        cache.index.insertItem(slot->second, item);
+        cache.table.set(slot->second, item);
+        cache.wear.trackItem(item);
+        old = std::move(item);
+        // adaugat si modificat in acelasi lot ramane "added"
+        if (std::find(delta.added.begin(), delta.added.end(), itemId) == delta.added.end())
+            delta.updated.push_back(itemId);
+    }
+    else
+    {
+        cache.itemSlots[itemId] = cache.items.size();
+        cache.itemOrder.insert(itemId);
+        cache.index.insertItem(cache.items.size(), item);
+        cache.table.push(item);
+        cache.join.pushItem();
+        cache.wear.trackItem(item);
+        cache.items.push_back(std::move(item));
+        delta.added.push_back(itemId);
     }
-    return ok;
+}
+
+void DataManager::uncacheItem(WardrobeCache &cache, int itemId, ItemsDelta &delta, OutfitsDelta &outfitsDelta,
+                              std::vector<std::string> &releasedKeys)
+{
+    auto slot = cache.itemSlots.find(itemId);
+    if (slot == cache.itemSlots.end())
+        return;
+
+    std::size_t idx = slot->second;
+
+    // backend-ul scoate articolul si din outfit-uri (relatia inversa); in cache
+    // atingem doar outfit-urile din indexul invers, nu toata lista
+    for (OutfitJoin::Slot o : cache.join.outfitsUsing(idx))
+    {
+        auto updated = std::make_shared<Outfit>(*cache.outfits[o]);
+        updated->removeItem(itemId);
+        unindexItemSet(cache, *cache.outfits[o]);
+        indexItemSet(cache, *updated);
+        cache.recommender.setOutfit(o, *updated);
+        cache.outfits[o] = std::move(updated);
+        const std::string &outfitId = cache.outfits[o]->getId();
+        if (std::find(outfitsDelta.updated.begin(), outfitsDelta.updated.end(), outfitId) == outfitsDelta.updated.end())
+            outfitsDelta.updated.push_back(outfitId);
+    }
+    cache.join.swapRemoveItem(idx);
+    cache.wear.untrackItem(itemId);
+
+    const std::string &imageKey = cache.items[idx].image.key();
+    if (blobStore_ && !imageKey.empty())
+        releasedKeys.push_back(imageKey);
+
+    // swap cu ultimul element ca stergerea sa fie O(1)
+    cache.itemSlots.erase(slot);
+    cache.itemOrder.erase(itemId);
+    cache.index.eraseItem(idx, cache.items[idx]);
+    if (idx != cache.items.size() - 1)
+    {
+        cache.index.moveItem(cache.items.size() - 1, idx, cache.items.back());
+        cache.items[idx] = std::move(cache.items.back());
+        cache.itemSlots[cache.items[idx].id] = idx;
+    }
+    cache.items.pop_back();
+    cache.table.swapRemove(idx);
+    delta.removed.push_back(itemId);
+}
+
+void DataManager::cacheOutfit(WardrobeCache &cache, const Outfit &outfit, const std::vector<int> &linked,
+                              OutfitsDelta &delta)
+{
+    auto stored = std::make_shared<Outfit>(outfit);
+    stored->setItemIds(linked);
+    auto itemSlots = itemSlotsOf(cache, *stored);
+
+    auto slot = cache.outfitSlots.find(outfit.getId());
+    if (slot != cache.outfitSlots.end())
+    {
+        cache.index.eraseOutfit(slot->second, *cache.outfits[slot->second]);
+        cache.index.insertOutfit(slot->second, *stored);
+        unindexItemSet(cache, *cache.outfits[slot->second]);
+        indexItemSet(cache, *stored);
+        cache.join.setOutfit(slot->second, std::move(itemSlots));
+        cache.recommender.setOutfit(slot->second, *stored);
+        cache.outfits[slot->second] = std::move(stored);
+        delta.updated.push_back(outfit.getId());
+    }
+    else
+    {
+        cache.outfitSlots[outfit.getId()] = cache.outfits.size();
+        cache.outfitOrder.insert(outfit.getId());
+        cache.index.insertOutfit(cache.outfits.size(), *stored);
+        indexItemSet(cache, *stored);
+        cache.join.pushOutfit(std::move(itemSlots));
+        cache.recommender.pushOutfit(*stored);
+        cache.wear.trackOutfit(outfit.getId());
+        cache.outfits.push_back(std::move(stored));
+        delta.added.push_back(outfit.getId());
+    }
+}
+
+void DataManager::uncacheOutfit(WardrobeCache &cache, const std::string &outfitId, OutfitsDelta &delta)
+{
+    auto slot = cache.outfitSlots.find(outfitId);
+    if (slot == cache.outfitSlots.end())
+        return;
+
+    std::size_t idx = slot->second;
+    cache.wear.untrackOutfit(outfitId);
+    cache.outfitOrder.erase(outfitId);
+    cache.outfitSlots.erase(slot);
+    cache.index.eraseOutfit(idx, *cache.outfits[idx]);
+    unindexItemSet(cache, *cache.outfits[idx]);
+    if (idx != cache.outfits.size() - 1)
+    {
+        cache.index.moveOutfit(cache.outfits.size() - 1, idx, *cache.outfits.back());
+        cache.outfits[idx] = std::move(cache.outfits.back());
+        cache.outfitSlots[cache.outfits[idx]->getId()] = idx;
+    }
+    cache.outfits.pop_back();
+    cache.join.swapRemoveOutfit(idx);
+    cache.recommender.swapRemoveOutfit(idx);
+    delta.removed.push_back(outfitId);
+}
+
+bool DataManager::saveItemRecord(const std::string &username, ItemRecord item)
+{
+    DD_METRIC_SCOPE("DataManager::saveItemRecord");
+    return submitSaveItemRecord(username, std::move(item)).get();
+}
+
+std::future<bool> DataManager::submitSaveItemRecord(const std::string &username, ItemRecord item)
+{
+    DD_METRIC_SCOPE("DataManager::submitSaveItemRecord");
+    ItemsDelta delta;
+    std::future<bool> persisted;
+    {
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+
+        std::string imageKey = storeImage(item);
+        auto write = [user = cache->user, item](StorageBackend &b) { return b.saveClothingItem(*user, item); };
+        std::vector<std::string> releasedKeys;
+        cacheItem(*cache, std::move(item), delta, releasedKeys);
+        persisted = persistWardrobe(username, std::move(write), {imageKey}, std::move(releasedKeys));
+    }
+    notifyItems(username, delta);
+    return persisted;
+}
+
+bool DataManager::saveClothingItems(const std::string &username, std::span<const ItemRecord> items)
+{
+    DD_METRIC_SCOPE("DataManager::saveClothingItems");
+    return submitSaveClothingItems(username, items).get();
+}
+
+std::future<bool> DataManager::submitSaveClothingItems(const std::string &username, std::span<const ItemRecord> items)
+{
+    DD_METRIC_SCOPE("DataManager::submitSaveClothingItems");
+    ItemsDelta delta;
+    std::future<bool> persisted;
+    {
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+        if (items.empty())
+            return ready(true);
+
+        std::vector<ItemRecord> stored(items.begin(), items.end());
+        std::vector<std::string> imageKeys;
+        imageKeys.reserve(stored.size());
+        for (auto &item : stored)
+            imageKeys.push_back(storeImage(item));
+
+        // un singur commit in backend pentru tot lotul
+        auto write = [user = cache->user, batch = stored](StorageBackend &b) { return b.saveClothingItems(*user, batch); };
+        std::vector<std::string> releasedKeys;
+        for (auto &item : stored)
+            cacheItem(*cache, std::move(item), delta, releasedKeys);
+        persisted = persistWardrobe(username, std::move(write), std::move(imageKeys), std::move(releasedKeys));
+    }
+    notifyItems(username, delta);
+    return persisted;
+}
+
+bool DataManager::saveClothingItems(const std::string &username, std::span<const std::shared_ptr<ClothingItem>> items)
+{
+    DD_METRIC_SCOPE("DataManager::saveClothingItems(ClothingItem)");
+    std::vector<ItemRecord> records;
+    records.reserve(items.size());
+    for (const auto &item : items)
+        if (item)
+            records.push_back(item->toRecord());
+    return saveClothingItems(username, std::span<const ItemRecord>(records));
 }
 
 bool DataManager::deleteClothingItem(const std::string &username, int itemId)
 {
-    bool ok = objcDeleteClothingItem(username, itemId);
-    if (ok && itemsChangedCallback_)
+    DD_METRIC_SCOPE("DataManager::deleteClothingItem");
+    return submitDeleteClothingItem(username, itemId).get();
+}
+
+std::future<bool> DataManager::submitDeleteClothingItem(const std::string &username, int itemId)
+{
+    DD_METRIC_SCOPE("DataManager::submitDeleteClothingItem");
+    return submitDeleteClothingItems(username, std::span<const int>(&itemId, 1));
+}
+
+bool DataManager::deleteClothingItems(const std::string &username, std::span<const int> itemIds)
+{
+    DD_METRIC_SCOPE("DataManager::deleteClothingItems");
+    return submitDeleteClothingItems(username, itemIds).get();
+}
+
+std::future<bool> DataManager::submitDeleteClothingItems(const std::string &username, std::span<const int> itemIds)
+{
+    DD_METRIC_SCOPE("DataManager::submitDeleteClothingItems");
+    ItemsDelta delta;
+    OutfitsDelta outfitsDelta;
+    std::future<bool> persisted;
     {
-        itemsChangedCallback_();
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+
+        std::vector<int> ids(itemIds.begin(), itemIds.end());
+        std::vector<std::string> releasedKeys;
+        for (int itemId : ids)
+            uncacheItem(*cache, itemId, delta, outfitsDelta, releasedKeys);
+        persisted = persistWardrobe(username, [user = cache->user, ids](StorageBackend &b)
+                                    { return ids.size() == 1 ? b.deleteClothingItem(*user, ids.front())
+                                                             : b.deleteClothingItems(*user, ids); },
+                                    {}, std::move(releasedKeys));
     }
-    return ok;
+    notifyItems(username, delta);
+    notifyOutfits(username, outfitsDelta);
+    return persisted;
+}
+
+std::vector<ItemRecord>
+DataManager::filterClothingItems(const std::string &username,
+                                 const std::vector<std::string> &colors,
+                                 const std::vector<std::string> &materials,
+                                 const std::vector<std::string> &categories)
+{
+    DD_METRIC_SCOPE("DataManager::filterClothingItems");
+    return filterClothingItemsBySymbol(username,
+                                       WardrobeIndex::toSymbols(colors),
+                                       WardrobeIndex::toSymbols(materials),
+                                       WardrobeIndex::toSymbols(categories));
+}
+
+std::vector<ItemRecord>
+DataManager::filterClothingItemsBySymbol(const std::string &username,
+                                         const std::vector<Symbol> &colors,
+                                         const std::vector<Symbol> &materials,
+                                         const std::vector<Symbol> &categories)
+{
+    DD_METRIC_SCOPE("DataManager::filterClothingItemsBySymbol");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<ItemRecord> result;
+                         Bitset hits = cache.index.query(colors, materials, categories);
+                         result.reserve(hits.count());
+                         hits.forEach([&](std::size_t slot) { result.push_back(cache.items[slot]); });
+                         return result; });
+}
+
+ImageBlob DataManager::getThumbnail(const ImageBlob &image) const
+{
+    DD_METRIC_SCOPE("DataManager::getThumbnail");
+    auto blobStore = getBlobStore();
+    const std::string &imageKey = image.key();
+    if (!blobStore || imageKey.empty())
+        return image;
+    ImageBlob thumb = blobStore->openThumbnail(imageKey);
+    return thumb.hasSource() ? thumb : image;
 }
 
 // outfits management
 std::vector<std::shared_ptr<Outfit>>
 DataManager::getOutfits(const std::string &username)
 {
-    return objcFetchOutfits(username);
+    DD_METRIC_SCOPE("DataManager::getOutfits");
+    return readCache(username, [](const WardrobeCache &cache) { return cache.outfits; });
+}
+
+std::vector<std::shared_ptr<Outfit>>
+DataManager::filterOutfits(const std::string &username, const std::vector<std::string> &seasons)
+{
+    DD_METRIC_SCOPE("DataManager::filterOutfits");
+    return filterOutfitsBySymbol(username, WardrobeIndex::toSymbols(seasons));
+}
+
+std::vector<std::shared_ptr<Outfit>>
+DataManager::filterOutfitsBySymbol(const std::string &username, const std::vector<Symbol> &seasons)
+{
+    DD_METRIC_SCOPE("DataManager::filterOutfitsBySymbol");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<std::shared_ptr<Outfit>> result;
+                         Bitset hits = cache.index.queryOutfits(seasons);
+                         result.reserve(hits.count());
+                         hits.forEach([&](std::size_t slot) { result.push_back(cache.outfits[slot]); });
+                         return result; });
+}
+
+std::vector<DataManager::ResolvedOutfit>
+DataManager::getResolvedOutfits(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getResolvedOutfits");
+    return readCache(username, [](const WardrobeCache &cache)
+                     {
+                         std::vector<ResolvedOutfit> result;
+                         result.reserve(cache.outfits.size());
+                         for (std::size_t slot = 0; slot < cache.outfits.size(); ++slot)
+                             result.push_back(resolveOutfit(cache, slot));
+                         return result; });
+}
+
+std::vector<DataManager::ResolvedOutfit>
+DataManager::getResolvedOutfits(const std::string &username, const CancellationToken &token)
+{
+    DD_METRIC_SCOPE("DataManager::getResolvedOutfits(token)");
+    token.throwIfCancelled();
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<ResolvedOutfit> result;
+                         result.reserve(cache.outfits.size());
+                         for (std::size_t slot = 0; slot < cache.outfits.size(); ++slot)
+                         {
+                             if (slot % CancellationStride == 0)
+                                 token.throwIfCancelled();
+                             result.push_back(resolveOutfit(cache, slot));
+                         }
+                         return result; });
+}
+
+std::future<std::vector<DataManager::ResolvedOutfit>>
+DataManager::getResolvedOutfitsAsync(const std::string &username, CancellationToken token)
+{
+    DD_METRIC_SCOPE("DataManager::getResolvedOutfitsAsync");
+    return executor_.submit(token, [this, username, token] { return getResolvedOutfits(username, token); });
+}
+
+std::vector<DataManager::ResolvedOutfit>
+DataManager::filterResolvedOutfits(const std::string &username, const std::vector<std::string> &seasons)
+{
+    DD_METRIC_SCOPE("DataManager::filterResolvedOutfits");
+    const std::vector<Symbol> wanted = WardrobeIndex::toSymbols(seasons);
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<ResolvedOutfit> result;
+                         Bitset hits = cache.index.queryOutfits(wanted);
+                         result.reserve(hits.count());
+                         hits.forEach([&](std::size_t slot) { result.push_back(resolveOutfit(cache, slot)); });
+                         return result; });
+}
+
+std::vector<ItemRecord>
+DataManager::getOutfitItems(const std::string &username, const std::string &outfitId)
+{
+    DD_METRIC_SCOPE("DataManager::getOutfitItems");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         auto slot = cache.outfitSlots.find(outfitId);
+                         if (slot == cache.outfitSlots.end())
+                             return std::vector<ItemRecord>{};
+                         return resolveOutfit(cache, slot->second).items; });
 }
 
 bool DataManager::saveOutfit(const std::string &username, const Outfit &outfit)
 {
-    bool ok = objcSaveOutfit(username, outfit);
-    if (ok && outfitsChangedCallback_)
+    DD_METRIC_SCOPE("DataManager::saveOutfit");
+    return submitSaveOutfit(username, outfit).get();
+}
+
+std::future<bool> DataManager::submitSaveOutfit(const std::string &username, const Outfit &outfit)
+{
+    DD_METRIC_SCOPE("DataManager::submitSaveOutfit");
+    OutfitsDelta delta;
+    std::future<bool> persisted;
+    {
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+
+        // la fel ca backend-ul: doar articolele existente, sortate dupa id
+        std::vector<int> linked = linkedItemIds(*cache, outfit);
+        if (duplicatePolicy_ == DuplicateOutfitPolicy::Reject && duplicateOf(*cache, linked, outfit.getId()))
+            return ready(false);
+        persisted = persistWardrobe(username, [user = cache->user, outfit](StorageBackend &b)
+                                    { return b.saveOutfit(*user, outfit); });
+
+        cacheOutfit(*cache, outfit, linked, delta);
+    }
+    notifyOutfits(username, delta);
+    return persisted;
+}
+
+bool DataManager::saveOutfits(const std::string &username, std::span<const std::shared_ptr<Outfit>> outfits)
+{
+    DD_METRIC_SCOPE("DataManager::saveOutfits");
+    return submitSaveOutfits(username, outfits).get();
+}
+
+std::future<bool> DataManager::submitSaveOutfits(const std::string &username,
+                                                 std::span<const std::shared_ptr<Outfit>> outfits)
+{
+    DD_METRIC_SCOPE("DataManager::submitSaveOutfits");
+    OutfitsDelta delta;
+    std::future<bool> persisted;
     {
-        outfitsChangedCallback_();
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+        if (outfits.empty())
+            return ready(true);
+
+        // tot lotul se valideaza inainte de orice scriere
+        std::vector<Outfit> batch;
+        std::vector<std::vector<int>> itemSets;
+        batch.reserve(outfits.size());
+        itemSets.reserve(outfits.size());
+        for (const auto &outfit : outfits)
+        {
+            if (!outfit)
+                continue;
+            batch.push_back(*outfit);
+            itemSets.push_back(linkedItemIds(*cache, *outfit));
+        }
+        if (rejectsOutfits(*cache, batch, itemSets))
+            return ready(false);
+        persisted = persistWardrobe(username, [user = cache->user, batch](StorageBackend &b)
+                                    { return b.saveOutfits(*user, batch); });
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            cacheOutfit(*cache, batch[i], itemSets[i], delta);
     }
-    return ok;
+    notifyOutfits(username, delta);
+    return persisted;
+}
+
+std::future<bool> DataManager::saveOutfitAsync(const std::string &username, Outfit outfit, CancellationToken token)
+{
+    DD_METRIC_SCOPE("DataManager::saveOutfitAsync");
+    return executor_.submit(token, [this, username, outfit = std::move(outfit)]
+                            { return submitSaveOutfit(username, outfit).get(); });
+}
+
+std::shared_ptr<Outfit> DataManager::findDuplicateOutfit(const std::string &username, const Outfit &outfit)
+{
+    DD_METRIC_SCOPE("DataManager::findDuplicateOutfit");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     { return duplicateOf(cache, linkedItemIds(cache, outfit), outfit.getId()); });
+}
+
+std::vector<DataManager::NearDuplicate> DataManager::findNearDuplicateOutfits(const std::string &username, double threshold)
+{
+    DD_METRIC_SCOPE("DataManager::findNearDuplicateOutfits");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<NearDuplicate> result;
+                         for (const auto &match : OutfitSimilarity::nearDuplicates(cache.outfits, threshold))
+                             result.push_back({cache.outfits[match.first]->getId(), cache.outfits[match.second]->getId(), match.jaccard});
+                         return result; });
 }
 
 bool DataManager::deleteOutfit(const std::string &username, const std::string &outfitId)
 {
-    bool ok = objcDeleteOutfit(username, outfitId);
-    if (ok && outfitsChangedCallback_)
+    DD_METRIC_SCOPE("DataManager::deleteOutfit");
+    return submitDeleteOutfit(username, outfitId).get();
+}
+
+std::future<bool> DataManager::submitDeleteOutfit(const std::string &username, const std::string &outfitId)
+{
+    DD_METRIC_SCOPE("DataManager::submitDeleteOutfit");
+    return submitDeleteOutfits(username, std::span<const std::string>(&outfitId, 1));
+}
+
+bool DataManager::deleteOutfits(const std::string &username, std::span<const std::string> outfitIds)
+{
+    DD_METRIC_SCOPE("DataManager::deleteOutfits");
+    return submitDeleteOutfits(username, outfitIds).get();
+}
+
+std::future<bool> DataManager::submitDeleteOutfits(const std::string &username, std::span<const std::string> outfitIds)
+{
+    DD_METRIC_SCOPE("DataManager::submitDeleteOutfits");
+    OutfitsDelta delta;
+    std::future<bool> persisted;
     {
-        outfitsChangedCallback_();
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache)
+            return ready(false);
+
+        std::vector<std::string> ids(outfitIds.begin(), outfitIds.end());
+        for (const auto &outfitId : ids)
+            uncacheOutfit(*cache, outfitId, delta);
+        persisted = persistWardrobe(username, [user = cache->user, ids = std::move(ids)](StorageBackend &b)
+                                    { return ids.size() == 1 ? b.deleteOutfit(*user, ids.front())
+                                                             : b.deleteOutfits(*user, ids); });
     }
-    return ok;
+    notifyOutfits(username, delta);
+    return persisted;
 }
 
-// alegem random sugestia in functie de sezon
+// sugestia zilei: RecommendationEngine alege ponderat (O(log n)) dintre outfit-urile sezonului
 std::shared_ptr<Outfit> DataManager::getTodaySuggestion(const std::string &username)
 {
-    auto allOutfits = getOutfits(username);
-    if (allOutfits.empty())
-        return nullptr;
-
+    DD_METRIC_SCOPE("DataManager::getTodaySuggestion");
     // Determinăm sezonul curent
-    std::time_t t = std::time(nullptr);
-    std::tm localTime;
-    localtime_r(&t, &localTime);
-    int luna = localTime.tm_mon + 1;
-    std::string sezon;
-
-    if (luna >= 6 && luna <= 8)
-        sezon = "vara";
-    else if (luna >= 9 && luna <= 11)
-        sezon = "toamna";
-    else if (luna == 12 || luna <= 2)
-        sezon = "iarna";
-    else
-        sezon = "primavara";
+    const Date today = Date::today();
+    Symbol sezon = RecommendationEngine::seasonForMonth(today.civil().month);
 
-    // Filtrăm după sezon
-    std::vector<std::shared_ptr<Outfit>> potrivite;
-    for (auto &o : allOutfits)
-        if (o->getSeason() == sezon)
-            potrivite.push_back(o);
+    // alegerea modifica istoricul sugestiilor, deci lock exclusiv
+    return writeCache(username, [&](WardrobeCache &cache) -> std::shared_ptr<Outfit>
+                      {
+                          auto slot = cache.recommender.suggest(today, sezon);
+                          if (!slot)
+                              return nullptr;
+                          return cache.outfits[*slot]; });
+}
 
-    if (potrivite.empty())
-        return nullptr;
+std::future<std::shared_ptr<Outfit>> DataManager::getTodaySuggestionAsync(const std::string &username, CancellationToken token)
+{
+    DD_METRIC_SCOPE("DataManager::getTodaySuggestionAsync");
+    return executor_.submit(token, [this, username] { return getTodaySuggestion(username); });
+}
+
+std::vector<OutfitGenerator::Result> DataManager::generateOutfits(const std::string &username, std::size_t count)
+{
+    DD_METRIC_SCOPE("DataManager::generateOutfits");
+    OutfitGenerator::Options options;
+    options.season = RecommendationEngine::seasonForMonth(Date::today().civil().month);
+    options.count = count;
+    return readCache(username, [&](const WardrobeCache &cache)
+                     { return OutfitGenerator::generate(cache.items, options); });
+}
+
+bool DataManager::markOutfitWorn(const std::string &username, const std::string &outfitId, const std::string &date)
+{
+    const Date day = date.empty() ? Date::today() : Date::fromString(date);
+    if (day.empty())
+        return false;
+    return markOutfitWorn(username, outfitId, day);
+}
+
+bool DataManager::markOutfitWorn(const std::string &username, const std::string &outfitId, Date day)
+{
+    DD_METRIC_SCOPE("DataManager::markOutfitWorn");
+    return submitMarkOutfitWorn(username, outfitId, day).get();
+}
+
+std::future<bool> DataManager::submitMarkOutfitWorn(const std::string &username, const std::string &outfitId, Date day)
+{
+    DD_METRIC_SCOPE("DataManager::submitMarkOutfitWorn");
+    if (day.empty())
+        return ready(false);
+    WriteLock lock = writeLock(username);
+    auto *cache = cacheFor(username);
+    if (!cache)
+        return ready(false);
+    auto slot = cache->outfitSlots.find(outfitId);
+    if (slot == cache->outfitSlots.end())
+        return ready(false);
 
-    // Alegem random
-    static std::mt19937_64 rng{std::random_device{}()};
-    std::uniform_int_distribution<size_t> dist(0, potrivite.size() - 1);
-    return potrivite[dist(rng)];
+    // outfit-ul cu articolele lui de azi; inregistrarile raman corecte si daca se schimba ulterior
+    std::vector<WearRecord> records = WearLog::forOutfit(day, *cache->outfits[slot->second]);
+    cache->wear.append(records);
+    cache->recommender.markWorn(slot->second, day);
+    return persistWardrobe(username, [user = cache->user, records = std::move(records)](StorageBackend &b)
+                           { return b.appendWearRecords(*user, records); });
+}
+
+bool DataManager::markItemWorn(const std::string &username, int itemId, Date day)
+{
+    DD_METRIC_SCOPE("DataManager::markItemWorn");
+    return submitMarkItemWorn(username, itemId, day).get();
 }
 
-// statistici
+std::future<bool> DataManager::submitMarkItemWorn(const std::string &username, int itemId, Date day)
+{
+    DD_METRIC_SCOPE("DataManager::submitMarkItemWorn");
+    if (day.empty())
+        return ready(false);
+    WriteLock lock = writeLock(username);
+    auto *cache = cacheFor(username);
+    if (!cache || !cache->itemSlots.count(itemId))
+        return ready(false);
+
+    const WearRecord record = WearLog::forItem(day, itemId);
+    cache->wear.append(std::span<const WearRecord>(&record, 1));
+    return persistWardrobe(username, [user = cache->user, record](StorageBackend &b)
+                           { return b.appendWearRecords(*user, std::span<const WearRecord>(&record, 1)); });
+}
+
+// statistici (O(1), direct din cache)
 std::size_t DataManager::getClothingItemsCount(const std::string &username)
 {
-    auto items = getClothingItems(username);
-    return items.size();
+    DD_METRIC_SCOPE("DataManager::getClothingItemsCount");
+    return readCache(username, [](const WardrobeCache &cache) { return cache.items.size(); });
 }
 
 std::size_t DataManager::getOutfitCount(const std::string &username)
 {
-    auto outfits = getOutfits(username);
-    return outfits.size();
+    DD_METRIC_SCOPE("DataManager::getOutfitCount");
+    return readCache(username, [](const WardrobeCache &cache) { return cache.outfits.size(); });
+}
+
+// statistici pe coloane
+namespace
+{
+    // string gol -> fara restrictie; valoare necunoscuta -> nullopt (niciun articol)
+    std::optional<Symbol> columnFilter(const std::string &value)
+    {
+        if (value.empty())
+            return symbols::Empty;
+        return SymbolTable::getInstance().find(toLowerAscii(value));
+    }
+
+    DataManager::Histogram namedHistogram(const std::vector<std::pair<Symbol, std::size_t>> &counts)
+    {
+        DataManager::Histogram result;
+        result.reserve(counts.size());
+        for (const auto &[symbol, count] : counts)
+            result.emplace_back(SymbolTable::getInstance().name(symbol), count);
+        return result;
+    }
+}
+
+std::size_t DataManager::countClothingItems(const std::string &username, const std::string &color, const std::string &category)
+{
+    DD_METRIC_SCOPE("DataManager::countClothingItems");
+    auto colorId = columnFilter(color);
+    auto categoryId = columnFilter(category);
+    if (!colorId || !categoryId)
+        return 0;
+    return readCache(username, [&](const WardrobeCache &cache) { return cache.table.count(*colorId, *categoryId); });
+}
+
+std::size_t DataManager::countClothingItemsWithMaterial(const std::string &username, const std::string &material)
+{
+    DD_METRIC_SCOPE("DataManager::countClothingItemsWithMaterial");
+    auto materialId = columnFilter(material);
+    return readCache(username, [&](const WardrobeCache &cache) -> std::size_t
+                     {
+                         if (material.empty())
+                             return cache.table.size();
+                         return materialId ? cache.table.countMaterial(*materialId) : 0; });
+}
+
+DataManager::Histogram DataManager::getColorHistogram(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getColorHistogram");
+    return readCache(username, [](const WardrobeCache &cache) { return namedHistogram(cache.table.colorHistogram()); });
+}
+
+DataManager::Histogram DataManager::getCategoryHistogram(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getCategoryHistogram");
+    return readCache(username, [](const WardrobeCache &cache) { return namedHistogram(cache.table.categoryHistogram()); });
+}
+
+DataManager::Histogram DataManager::getMaterialHistogram(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getMaterialHistogram");
+    return readCache(username, [](const WardrobeCache &cache) { return namedHistogram(cache.table.materialHistogram()); });
+}
+
+// statistici de purtare
+
+DataManager::WearStats DataManager::getWearStats(const std::string &username, std::size_t mostWornCount)
+{
+    DD_METRIC_SCOPE("DataManager::getWearStats");
+    const Date today = Date::today();
+    // fereastra glisanta avanseaza la ziua de azi, deci lock exclusiv
+    return writeCache(username, [&](WardrobeCache &cache)
+                      {
+                          cache.wear.advanceTo(today);
+                          WearStats stats;
+                          stats.outfitWears = cache.wear.totalOutfitWears();
+                          stats.itemWears = cache.wear.totalItemWears();
+                          stats.neverWorn = cache.wear.neverWornCount();
+                          stats.windowDays = cache.wear.windowDays();
+                          for (auto &entry : cache.wear.mostWornOutfits(mostWornCount))
+                          {
+                              auto slot = cache.outfitSlots.find(entry.outfitId);
+                              if (slot != cache.outfitSlots.end())
+                                  stats.mostWorn.emplace_back(cache.outfits[slot->second], entry.wears);
+                          }
+                          stats.colors = namedHistogram(cache.wear.colorDistribution());
+                          stats.categories = namedHistogram(cache.wear.categoryDistribution());
+                          return stats; });
+}
+
+WearLog::ItemWear DataManager::getItemWear(const std::string &username, int itemId)
+{
+    DD_METRIC_SCOPE("DataManager::getItemWear");
+    return readCache(username, [&](const WardrobeCache &cache) { return cache.wear.itemWear(itemId); });
+}
+
+std::vector<int> DataManager::getNeverWornItems(const std::string &username)
+{
+    DD_METRIC_SCOPE("DataManager::getNeverWornItems");
+    return readCache(username, [](const WardrobeCache &cache) { return cache.wear.neverWornItems(); });
+}
+
+std::vector<WearRecord> DataManager::getWearRecords(const std::string &username, Date from, Date to)
+{
+    DD_METRIC_SCOPE("DataManager::getWearRecords");
+    return readCache(username, [&](const WardrobeCache &cache)
+                     {
+                         std::vector<WearRecord> records;
+                         cache.wear.forEachBetween(from, to, [&](const WearRecord &record) { records.push_back(record); });
+                         return records; });
+}
+
+// export / import
+
+bool DataManager::exportWardrobe(const std::string &username, const std::string &path)
+{
+    DD_METRIC_SCOPE("DataManager::exportWardrobe");
+    std::vector<ItemRecord> items;
+    std::vector<std::shared_ptr<Outfit>> outfits;
+    std::vector<WearRecord> wears;
+    const bool found = readCache(username, [&](const WardrobeCache &cache)
+                                 {
+                                     items = cache.items;
+                                     outfits = cache.outfits;
+                                     wears = cache.wear.records();
+                                     return true; });
+    if (!found)
+        return false;
+
+    WardrobeSnapshot::Contents contents;
+    contents.username = username;
+    contents.items = items;
+    contents.outfits = outfits;
+    contents.wears = wears;
+    contents.embedImages = true;
+    return WardrobeSnapshot::writeFile(path, WardrobeSnapshot::encode(contents));
+}
+
+bool DataManager::importWardrobe(const std::string &username, const std::string &path)
+{
+    DD_METRIC_SCOPE("DataManager::importWardrobe");
+    auto snapshot = WardrobeSnapshot::open(path);
+    if (!snapshot || !getUserHandle(username))
+        return false;
+
+    // id-uri noi, ca garderoba importata sa nu se suprapuna cu cea existenta
+    std::vector<ItemRecord> items = snapshot->items(getBlobStore().get());
+    std::unordered_map<int, int> itemIds;
+    for (ItemRecord &item : items)
+    {
+        const int id = generateNextClothingItemId();
+        itemIds[item.id] = id;
+        item.id = id;
+    }
+
+    std::vector<std::shared_ptr<Outfit>> outfits;
+    std::unordered_map<std::uint64_t, std::uint64_t> outfitKeys;
+    for (const auto &imported : snapshot->outfits())
+    {
+        std::vector<int> ids;
+        for (int id : imported->getItemIds())
+            if (auto it = itemIds.find(id); it != itemIds.end())
+                ids.push_back(it->second);
+        std::vector<OutfitItemPlacement> layout;
+        for (const auto &placement : imported->getLayout())
+            if (auto it = itemIds.find(placement.itemId); it != itemIds.end())
+                layout.push_back(OutfitItemPlacement{it->second, placement.normalizedX, placement.normalizedY});
+        auto outfit = ItemFactory::createOutfit(generateNextOutfitId(), imported->getName(), imported->getDateAdded(),
+                                                imported->getSeason(), {}, ids, layout);
+        outfitKeys[WearLog::outfitKey(imported->getId())] = WearLog::outfitKey(outfit->getId());
+        outfits.push_back(std::move(outfit));
+    }
+
+    // purtarile articolelor / outfit-urilor importate, cu id-urile noi
+    std::vector<WearRecord> wears;
+    for (WearRecord record : snapshot->wears())
+    {
+        if (!record.isOutfit())
+        {
+            auto it = itemIds.find(record.itemId);
+            if (it == itemIds.end())
+                continue;
+            record.itemId = it->second;
+        }
+        if (record.outfitKey != WearRecord::NoOutfit)
+        {
+            auto it = outfitKeys.find(record.outfitKey);
+            // purtarea unui outfit care nu e in arhiva nu mai are la ce se referi;
+            // a unui articol ramane, dar fara outfit
+            if (it == outfitKeys.end() && record.isOutfit())
+                continue;
+            record.outfitKey = it != outfitKeys.end() ? it->second : WearRecord::NoOutfit;
+        }
+        wears.push_back(record);
+    }
+
+    // cu DuplicateOutfitPolicy::Reject importul e refuzat inainte de orice scriere; articolele
+    // au id-uri noi, deci multimile se pot calcula fara ele in cache
+    std::vector<Outfit> batch;
+    std::vector<std::vector<int>> itemSets;
+    for (const auto &outfit : outfits)
+    {
+        std::vector<int> ids = outfit->getItemIds();
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        batch.push_back(*outfit);
+        itemSets.push_back(std::move(ids));
+    }
+
+    // verificarea si scrierea sub acelasi lock: intre ele nu se poate salva un outfit care sa faca
+    // lotul duplicat. Backend-ul scrie totul ca un singur commit; daca esueaza, cache-ul se
+    // reincarca din backend (persist), deci nu raman articole importate fara outfit-urile lor.
+    ItemsDelta itemsDelta;
+    OutfitsDelta outfitsDelta;
+    std::future<bool> persisted;
+    {
+        WriteLock lock = writeLock(username);
+        auto *cache = cacheFor(username);
+        if (!cache || rejectsOutfits(*cache, batch, itemSets))
+            return false;
+
+        std::vector<std::string> imageKeys;
+        imageKeys.reserve(items.size());
+        for (auto &item : items)
+            imageKeys.push_back(storeImage(item));
+        auto write = [user = cache->user, items, batch, wears](StorageBackend &b)
+        { return b.importWardrobe(*user, items, batch, wears); };
+
+        std::vector<std::string> releasedKeys;
+        for (auto &item : items)
+            cacheItem(*cache, std::move(item), itemsDelta, releasedKeys);
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            cacheOutfit(*cache, batch[i], itemSets[i], outfitsDelta);
+        cache->wear.append(wears);
+        std::unordered_map<std::uint64_t, std::size_t> slotByKey;
+        slotByKey.reserve(cache->outfits.size());
+        for (std::size_t i = 0; i < cache->outfits.size(); ++i)
+            slotByKey[WearLog::outfitKey(cache->outfits[i]->getId())] = i;
+        for (const WearRecord &record : wears)
+        {
+            if (!record.isOutfit())
+                continue;
+            auto slot = slotByKey.find(record.outfitKey);
+            if (slot != slotByKey.end())
+                cache->recommender.markWorn(slot->second, record.date());
+        }
+        persisted = persistWardrobe(username, std::move(write), std::move(imageKeys), std::move(releasedKeys));
+    }
+    notifyItems(username, itemsDelta);
+    notifyOutfits(username, outfitsDelta);
+    return persisted.get();
 }
@@ -0,0 +1,57 @@
+#include "ItemBatch.hpp"
+
+ItemBatch::ItemBatch(std::span<const ItemRecord> items)
+{
+    reserve(items.size());
+    for (const auto &item : items)
+        push(item);
+}
+
+void ItemBatch::reserve(std::size_t count)
+{
+    records_.reserve(count);
+    images_.reserve(count);
+}
+
+void ItemBatch::push(const ItemRecord &item)
+{
+    Record record{};
+    record.id = item.id;
+    record.category = intern(item.category);
+    record.color = intern(item.color);
+    record.materialsBegin = static_cast<std::uint32_t>(materials_.size());
+    record.materialsCount = static_cast<std::uint32_t>(item.materials.size());
+    for (Symbol material : item.materials)
+        materials_.push_back(intern(material));
+    record.pantWaist = NoString;
+    record.topSleeveType = NoString;
+    record.topNeckline = NoString;
+    record.kind = static_cast<Kind>(item.payload.index());
+
+    std::visit(overloaded{
+                   [](std::monostate) {},
+                   [&](const PantsData &pants)
+                   {
+                       record.pantLength = pants.lungime;
+                       record.pantWaist = intern(pants.talie);
+                   },
+                   [&](const TopData &top)
+                   {
+                       record.topSleeveType = intern(top.maneca);
+                       record.topNeckline = intern(top.decolteu);
+                   },
+                   [&](const JacketData &jacket) { record.jacketWaterproof = jacket.waterproof; },
+                   [&](const ShoesData &shoes) { record.shoeSize = shoes.size; }},
+               item.payload);
+
+    records_.push_back(record);
+    images_.push_back(item.image);
+}
+
+std::uint32_t ItemBatch::intern(Symbol symbol)
+{
+    auto [it, inserted] = stringIndex_.try_emplace(symbol, static_cast<std::uint32_t>(strings_.size()));
+    if (inserted)
+        strings_.push_back(symbol);
+    return it->second;
+}
@@ -0,0 +1,195 @@
+#include "Metrics.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    // id mic si stabil pentru thread-ul curent (campul "tid" din trace)
+    std::uint32_t currentThreadId()
+    {
+        static std::atomic<std::uint32_t> next{1};
+        thread_local std::uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    void appendEscaped(std::string &out, const std::string &text)
+    {
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20)
+                continue;
+            out += c;
+        }
+    }
+}
+
+void Metrics::Timer::record(std::uint64_t ns)
+{
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(ns, std::memory_order_relaxed);
+    buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t seen = maxNs.load(std::memory_order_relaxed);
+    while (ns > seen && !maxNs.compare_exchange_weak(seen, ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+Metrics::Metrics() : origin_(std::chrono::steady_clock::now()) {}
+
+Metrics::Timer *Metrics::timer(const char *name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &timer : timers_)
+        if (timer.name == name)
+            return &timer;
+    return &timers_.emplace_back(name);
+}
+
+Metrics::Counter *Metrics::counter(const char *name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &counter : counters_)
+        if (counter.name == name)
+            return &counter;
+    return &counters_.emplace_back(name);
+}
+
+std::size_t Metrics::bucketOf(std::uint64_t ns)
+{
+    if (ns < SubBuckets)
+        return static_cast<std::size_t>(ns);
+    // puterea lui 2, apoi urmatorii 2 biti dupa bitul cel mai semnificativ
+    const unsigned width = static_cast<unsigned>(std::bit_width(ns)) - 1;
+    const std::size_t sub = static_cast<std::size_t>(ns >> (width - 2)) & (SubBuckets - 1);
+    return std::min(Buckets - 1, width * SubBuckets + sub);
+}
+
+std::uint64_t Metrics::bucketUpperNs(std::size_t bucket)
+{
+    if (bucket < SubBuckets)
+        return bucket + 1;
+    const std::size_t width = bucket / SubBuckets;
+    const std::uint64_t sub = bucket % SubBuckets;
+    if (width < 2)
+        return SubBuckets; // nefolosite: valorile < 4 au bucket-uri proprii
+    if (width >= 63)
+        return UINT64_MAX;
+    return ((SubBuckets + sub + 1) << (width - 2));
+}
+
+MetricsSnapshot Metrics::snapshot() const
+{
+    constexpr double NsPerMs = 1e6;
+    MetricsSnapshot result;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    result.timers.reserve(timers_.size());
+    for (const auto &timer : timers_)
+    {
+        MetricsSnapshot::Timer entry;
+        entry.name = timer.name;
+        entry.count = timer.count.load(std::memory_order_relaxed);
+        entry.totalMs = static_cast<double>(timer.totalNs.load(std::memory_order_relaxed)) / NsPerMs;
+        entry.maxMs = static_cast<double>(timer.maxNs.load(std::memory_order_relaxed)) / NsPerMs;
+
+        std::array<std::uint64_t, Buckets> counts;
+        std::uint64_t total = 0;
+        for (std::size_t b = 0; b < Buckets; ++b)
+            total += counts[b] = timer.buckets[b].load(std::memory_order_relaxed);
+        auto percentile = [&](double p) -> double
+        {
+            if (total == 0)
+                return 0.0;
+            const auto rank = static_cast<std::uint64_t>(p * static_cast<double>(total - 1)) + 1;
+            std::uint64_t seen = 0;
+            for (std::size_t b = 0; b < Buckets; ++b)
+                if ((seen += counts[b]) >= rank)
+                    return std::min(static_cast<double>(bucketUpperNs(b)) / NsPerMs, entry.maxMs);
+            return entry.maxMs;
+        };
+        entry.p50Ms = percentile(0.50);
+        entry.p99Ms = percentile(0.99);
+        result.timers.push_back(std::move(entry));
+    }
+
+    result.counters.reserve(counters_.size());
+    for (const auto &counter : counters_)
+        result.counters.push_back({counter.name, counter.value.load(std::memory_order_relaxed)});
+    return result;
+}
+
+void Metrics::reset()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &timer : timers_)
+        {
+            timer.count.store(0, std::memory_order_relaxed);
+            timer.totalNs.store(0, std::memory_order_relaxed);
+            timer.maxNs.store(0, std::memory_order_relaxed);
+            for (auto &bucket : timer.buckets)
+                bucket.store(0, std::memory_order_relaxed);
+        }
+        for (auto &counter : counters_)
+            counter.value.store(0, std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(traceMutex_);
+    trace_.clear();
+    traceNext_ = 0;
+}
+
+void Metrics::setTracing(bool enabled, std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(traceMutex_);
+    if (enabled)
+    {
+        traceCapacity_ = std::max<std::size_t>(capacity, 1);
+        trace_.clear();
+        trace_.reserve(traceCapacity_);
+        traceNext_ = 0;
+    }
+    tracing_.store(enabled, std::memory_order_relaxed);
+}
+
+void Metrics::traceEvent(const Timer &timer, std::chrono::steady_clock::time_point start, std::uint64_t durationNs)
+{
+    using namespace std::chrono;
+    TraceEvent event{&timer, duration_cast<microseconds>(start - origin_).count(),
+                     static_cast<std::int64_t>(durationNs / 1000), currentThreadId()};
+
+    std::lock_guard<std::mutex> lock(traceMutex_);
+    if (!tracing_.load(std::memory_order_relaxed))
+        return;
+    // buffer circular: dupa ce se umple, evenimentul nou il inlocuieste pe cel mai vechi
+    if (trace_.size() < traceCapacity_)
+        trace_.push_back(event);
+    else
+        trace_[traceNext_] = event;
+    traceNext_ = (traceNext_ + 1) % traceCapacity_;
+}
+
+std::string Metrics::traceJSON() const
+{
+    std::lock_guard<std::mutex> lock(traceMutex_);
+    std::string out = "{\"traceEvents\":[";
+    // in ordine cronologica: dupa umplere, cel mai vechi eveniment e la traceNext_
+    const std::size_t first = trace_.size() < traceCapacity_ ? 0 : traceNext_;
+    char numbers[96];
+    for (std::size_t i = 0; i < trace_.size(); ++i)
+    {
+        const TraceEvent &event = trace_[(first + i) % trace_.size()];
+        if (i > 0)
+            out += ',';
+        out += "{\"name\":\"";
+        appendEscaped(out, event.timer->name);
+        std::snprintf(numbers, sizeof(numbers), "\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}",
+                      static_cast<long long>(event.startUs), static_cast<long long>(event.durationUs), event.thread);
+        out += numbers;
+    }
+    out += "]}";
+    return out;
+}
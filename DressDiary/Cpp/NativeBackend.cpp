@@ -0,0 +1,1150 @@
+#include "NativeBackend.hpp"
+#include "ItemFactory.hpp"
+#include "Utilities.hpp"
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <unistd.h>
+
+// Format log: [u32 lungime payload][u8 tip][payload][u32 checksum]
+// Toate valorile sunt little-endian; string-urile si blob-urile sunt prefixate cu lungimea (u32).
+
+namespace
+{
+    constexpr std::size_t HeaderBytes = 5;
+    constexpr std::size_t TrailerBytes = 4;
+    // limita unei inregistrari: la replay o lungime mai mare e tratata ca antet corupt
+    constexpr std::uint32_t MaxRecordBytes = 512u << 20;
+
+    class ByteWriter
+    {
+        std::vector<std::uint8_t> &out;
+
+    public:
+        explicit ByteWriter(std::vector<std::uint8_t> &out_) : out(out_) {}
+
+        void u8(std::uint8_t v) { out.push_back(v); }
+        void u32(std::uint32_t v)
+        {
+            for (int i = 0; i < 4; ++i)
+                out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+        }
+        void i32(std::int32_t v) { u32(static_cast<std::uint32_t>(v)); }
+        void u64(std::uint64_t v)
+        {
+            for (int i = 0; i < 8; ++i)
+                out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+        }
+        void f32(float v)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            u32(bits);
+        }
+        void f64(double v)
+        {
+            std::uint64_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            u64(bits);
+        }
+        void bytes(const std::uint8_t *data, std::size_t size)
+        {
+            u32(static_cast<std::uint32_t>(size));
+            out.insert(out.end(), data, data + size);
+        }
+        void str(const std::string &s) { bytes(reinterpret_cast<const std::uint8_t *>(s.data()), s.size()); }
+    };
+
+    class ByteReader
+    {
+        const std::vector<std::uint8_t> &in;
+        std::size_t pos = 0;
+        bool ok_ = true;
+
+        bool need(std::size_t n)
+        {
+            if (!ok_ || in.size() - pos < n)
+                ok_ = false;
+            return ok_;
+        }
+
+    public:
+        explicit ByteReader(const std::vector<std::uint8_t> &in_) : in(in_) {}
+
+        bool ok() const { return ok_; }
+
+        std::uint8_t u8() { return need(1) ? in[pos++] : 0; }
+        std::uint32_t u32()
+        {
+            if (!need(4))
+                return 0;
+            std::uint32_t v = 0;
+            for (int i = 0; i < 4; ++i)
+                v |= static_cast<std::uint32_t>(in[pos++]) << (8 * i);
+            return v;
+        }
+        std::int32_t i32() { return static_cast<std::int32_t>(u32()); }
+        std::uint64_t u64()
+        {
+            if (!need(8))
+                return 0;
+            std::uint64_t v = 0;
+            for (int i = 0; i < 8; ++i)
+                v |= static_cast<std::uint64_t>(in[pos++]) << (8 * i);
+            return v;
+        }
+        float f32()
+        {
+            std::uint32_t bits = u32();
+            float v;
+            std::memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+        double f64()
+        {
+            std::uint64_t bits = u64();
+            double v;
+            std::memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+        std::vector<std::uint8_t> bytes()
+        {
+            std::uint32_t n = u32();
+            if (!need(n))
+                return {};
+            std::vector<std::uint8_t> v(in.begin() + pos, in.begin() + pos + n);
+            pos += n;
+            return v;
+        }
+        std::string str()
+        {
+            std::uint32_t n = u32();
+            if (!need(n))
+                return {};
+            std::string s(reinterpret_cast<const char *>(in.data() + pos), n);
+            pos += n;
+            return s;
+        }
+    };
+
+    std::uint64_t mix64(std::uint64_t x)
+    {
+        // finalizer splitmix64
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    std::uint32_t checksum(std::uint8_t type, const std::vector<std::uint8_t> &payload)
+    {
+        // FNV-1a pe 32 biti
+        std::uint32_t h = 2166136261u;
+        h = (h ^ type) * 16777619u;
+        for (std::uint8_t b : payload)
+            h = (h ^ b) * 16777619u;
+        return h;
+    }
+
+    enum class ImageKind : std::uint8_t
+    {
+        Inline = 0,
+        BlobKey = 1
+    };
+
+    void encodeItem(ByteWriter &w, const ItemRecord &item)
+    {
+        const auto &table = SymbolTable::getInstance();
+        w.i32(item.id);
+        w.str(item.colorName());
+        w.u32(static_cast<std::uint32_t>(item.materials.size()));
+        for (Symbol m : item.materials)
+            w.str(table.name(m));
+        w.str(item.categoryName());
+        const auto &img = item.image;
+        if (!img.key().empty())
+        {
+            w.u8(static_cast<std::uint8_t>(ImageKind::BlobKey));
+            w.str(img.key());
+        }
+        else
+        {
+            w.u8(static_cast<std::uint8_t>(ImageKind::Inline));
+            w.bytes(img.data(), img.size());
+        }
+
+        // campurile specifice se scriu dupa categorie (fara RTTI, direct din variant)
+        if (item.category == symbols::Pants)
+        {
+            const auto *pants = std::get_if<PantsData>(&item.payload);
+            w.f32(pants ? pants->lungime : 0.0f);
+            w.str(pants ? table.name(pants->talie) : std::string());
+        }
+        else if (item.category == symbols::Jacket)
+        {
+            const auto *jacket = std::get_if<JacketData>(&item.payload);
+            w.u8(jacket && jacket->waterproof ? 1 : 0);
+        }
+        else if (item.category == symbols::Top)
+        {
+            const auto *top = std::get_if<TopData>(&item.payload);
+            w.str(top ? table.name(top->maneca) : std::string());
+            w.str(top ? table.name(top->decolteu) : std::string());
+        }
+        else if (item.category == symbols::Shoes)
+        {
+            const auto *shoes = std::get_if<ShoesData>(&item.payload);
+            w.f32(shoes ? shoes->size : 0.0f);
+        }
+    }
+
+    std::optional<ItemRecord> decodeItem(ByteReader &r, const BlobStore *blobs)
+    {
+        auto &table = SymbolTable::getInstance();
+        ItemRecord item;
+        item.id = r.i32();
+        item.color = table.intern(r.str());
+        for (std::uint32_t n = r.u32(); n > 0 && r.ok(); --n)
+            item.materials.push_back(table.intern(r.str()));
+        item.category = table.intern(r.str());
+        if (static_cast<ImageKind>(r.u8()) == ImageKind::BlobKey)
+        {
+            std::string key = r.str();
+            if (blobs)
+                item.image = blobs->open(key);
+        }
+        else
+            item.image = ImageBlob(r.bytes());
+        if (!r.ok())
+            return std::nullopt;
+
+        if (item.category == symbols::Pants)
+        {
+            PantsData pants;
+            pants.lungime = roundToOneDecimal(r.f32());
+            pants.talie = table.intern(r.str());
+            item.payload = pants;
+        }
+        else if (item.category == symbols::Jacket)
+            item.payload = JacketData{r.u8() != 0};
+        else if (item.category == symbols::Top)
+        {
+            TopData top;
+            top.maneca = table.intern(r.str());
+            top.decolteu = table.intern(r.str());
+            item.payload = top;
+        }
+        else if (item.category == symbols::Shoes)
+            item.payload = ShoesData{roundToOneDecimal(r.f32())};
+        else
+            return std::nullopt;
+
+        if (!r.ok())
+            return std::nullopt;
+        return item;
+    }
+
+    void encodeOutfit(ByteWriter &w, const Outfit &outfit)
+    {
+        w.str(outfit.getId());
+        w.str(outfit.getName());
+        w.str(outfit.getSeason());
+        w.str(outfit.getDateAdded().toString());
+        const auto &ids = outfit.getItemIds();
+        w.u32(static_cast<std::uint32_t>(ids.size()));
+        for (int id : ids)
+            w.i32(id);
+        const auto &layout = outfit.getLayout();
+        w.u32(static_cast<std::uint32_t>(layout.size()));
+        for (const auto &entry : layout)
+        {
+            w.i32(entry.itemId);
+            w.f64(entry.normalizedX);
+            w.f64(entry.normalizedY);
+        }
+    }
+
+    std::vector<std::uint8_t> encodeWears(const std::string &username, std::span<const WearRecord> records)
+    {
+        std::vector<std::uint8_t> payload;
+        payload.reserve(username.size() + 8 + records.size() * sizeof(WearRecord));
+        ByteWriter w(payload);
+        w.str(username);
+        w.u32(static_cast<std::uint32_t>(records.size()));
+        for (const auto &record : records)
+        {
+            w.i32(record.day);
+            w.i32(record.itemId);
+            w.u64(record.outfitKey);
+        }
+        return payload;
+    }
+
+    std::shared_ptr<Outfit> decodeOutfit(ByteReader &r)
+    {
+        std::string id = r.str();
+        std::string name = r.str();
+        std::string season = r.str();
+        Date dateAdded = Date::fromString(r.str());
+        std::vector<int> ids(r.u32());
+        for (auto &itemId : ids)
+            itemId = r.i32();
+        std::vector<OutfitItemPlacement> layout(r.u32());
+        for (auto &entry : layout)
+        {
+            entry.itemId = r.i32();
+            entry.normalizedX = r.f64();
+            entry.normalizedY = r.f64();
+        }
+        if (!r.ok())
+            return nullptr;
+        return ItemFactory::createOutfit(id, name, dateAdded, season, {}, ids, layout);
+    }
+}
+
+NativeBackend::NativeBackend(const std::string &logPath, std::shared_ptr<BlobStore> blobs)
+    : logPath_(logPath), blobs_(std::move(blobs))
+{
+    if (logPath_.empty())
+    {
+        startGeneration();
+        return;
+    }
+    replay();
+    log_ = std::fopen(logPath_.c_str(), "ab");
+    // o cadere poate pierde coada nesincronizata, iar inregistrarile noi ajung atunci la pozitii
+    // deja folosite: fiecare deschidere incepe o generatie, ca versiunile lor sa difere oricum
+    if (log_)
+        startGeneration();
+}
+
+NativeBackend::~NativeBackend()
+{
+    if (log_)
+        std::fclose(log_);
+}
+
+// reconstruieste indexul din log; o inregistrare incompleta/corupta la final
+// (scriere intrerupta) este ignorata si log-ul este trunchiat la ultima valida
+void NativeBackend::replay()
+{
+    std::FILE *in = std::fopen(logPath_.c_str(), "rb");
+    if (!in)
+        return;
+
+    std::fseek(in, 0, SEEK_END);
+    const long fileEnd = std::ftell(in);
+    std::fseek(in, 0, SEEK_SET);
+
+    long validEnd = 0;
+    std::vector<std::uint8_t> header(HeaderBytes);
+    std::vector<std::uint8_t> payload;
+    while (std::fread(header.data(), 1, header.size(), in) == header.size())
+    {
+        ByteReader hr(header);
+        std::uint32_t len = hr.u32();
+        auto type = static_cast<RecordType>(hr.u8());
+
+        // lungimea vine dintr-un antet inca neverificat: una care nu incape in fisier
+        // e o coada corupta, ca un checksum gresit (fara sa alocam pentru ea)
+        const long remaining = fileEnd - std::ftell(in);
+        if (len > MaxRecordBytes || static_cast<long>(len + TrailerBytes) > remaining)
+            break;
+
+        payload.resize(len);
+        std::vector<std::uint8_t> trailer(TrailerBytes);
+        if (std::fread(payload.data(), 1, len, in) != len ||
+            std::fread(trailer.data(), 1, trailer.size(), in) != trailer.size())
+            break;
+        if (ByteReader(trailer).u32() != checksum(static_cast<std::uint8_t>(type), payload))
+            break;
+
+        validEnd = std::ftell(in);
+        logEnd_ = static_cast<std::uint64_t>(validEnd);
+        apply(type, payload);
+    }
+
+    std::fclose(in);
+
+    if (fileEnd == validEnd)
+        return;
+
+    // taiem doar coada, pe loc: partea valida nu se rescrie, deci o cadere in timpul
+    // reparatiei nu pierde inregistrari deja scrise
+    if (std::FILE *log = std::fopen(logPath_.c_str(), "r+b"))
+    {
+        if (::ftruncate(::fileno(log), static_cast<off_t>(validEnd)) == 0)
+            ::fsync(::fileno(log));
+        std::fclose(log);
+    }
+}
+
+bool NativeBackend::startGeneration()
+{
+    static thread_local std::mt19937_64 rng{std::random_device{}()};
+    std::uint64_t nonce = 0;
+    while (nonce == 0)
+        nonce = rng();
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.u64(nonce);
+    return append(RecordType::Generation, payload) && apply(RecordType::Generation, payload);
+}
+
+std::uint64_t NativeBackend::currentRevision() const
+{
+    const std::uint64_t revision = mix64(generation_ ^ mix64(logEnd_));
+    return revision == 0 ? 1 : revision;
+}
+
+bool NativeBackend::append(RecordType type, const std::vector<std::uint8_t> &payload)
+{
+    if (payload.size() > MaxRecordBytes)
+        return false;
+    if (logPath_.empty())
+    {
+        logEnd_ += HeaderBytes + payload.size() + TrailerBytes;
+        return true;
+    }
+    if (!log_)
+        return false;
+
+    std::vector<std::uint8_t> frame;
+    frame.reserve(HeaderBytes + payload.size() + TrailerBytes);
+    ByteWriter w(frame);
+    w.u32(static_cast<std::uint32_t>(payload.size()));
+    w.u8(static_cast<std::uint8_t>(type));
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    w.u32(checksum(static_cast<std::uint8_t>(type), payload));
+
+    if (std::fwrite(frame.data(), 1, frame.size(), log_) != frame.size())
+        return false;
+    logEnd_ += frame.size();
+    unsynced_ = true;
+    return std::fflush(log_) == 0;
+}
+
+bool NativeBackend::commitBatch(const PendingRecords &records)
+{
+    if (records.empty())
+        return true;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.u32(static_cast<std::uint32_t>(records.size()));
+    for (const auto &[type, data] : records)
+    {
+        w.u8(static_cast<std::uint8_t>(type));
+        w.bytes(data.data(), data.size());
+    }
+    // se verifica inainte de append: un lot care nu s-ar aplica intreg nu se scrie deloc
+    return checkBatch(payload) && append(RecordType::Batch, payload) && applyBatch(payload);
+}
+
+bool NativeBackend::checkBatch(const std::vector<std::uint8_t> &payload) const
+{
+    ByteReader r(payload);
+    BatchCheck staged;
+    for (std::uint32_t n = r.u32(); n > 0 && r.ok(); --n)
+    {
+        auto subType = static_cast<RecordType>(r.u8());
+        auto sub = r.bytes();
+        if (!r.ok() || subType == RecordType::Batch || !check(subType, sub, staged))
+            return false;
+    }
+    return r.ok();
+}
+
+// oglinda lui apply: aceleasi conditii de esec, dar schimbarile raman in `staged`
+bool NativeBackend::check(RecordType type, const std::vector<std::uint8_t> &payload, BatchCheck &staged) const
+{
+    auto userExists = [&](const std::string &username)
+    { return users_.count(username) || staged.users.count(username); };
+    auto itemExists = [&](const std::string &username, int itemId)
+    {
+        if (auto user = staged.items.find(username); user != staged.items.end())
+            if (auto it = user->second.find(itemId); it != user->second.end())
+                return it->second;
+        auto it = users_.find(username);
+        return it != users_.end() && it->second.items.count(itemId) != 0;
+    };
+    auto outfitExists = [&](const std::string &username, const std::string &outfitId)
+    {
+        if (auto user = staged.outfits.find(username); user != staged.outfits.end())
+            if (auto it = user->second.find(outfitId); it != user->second.end())
+                return it->second;
+        auto it = users_.find(username);
+        return it != users_.end() && it->second.outfitSlots.count(outfitId) != 0;
+    };
+
+    ByteReader r(payload);
+    switch (type)
+    {
+    case RecordType::Batch:
+        return false;
+    case RecordType::Generation:
+        r.u64();
+        return r.ok();
+    case RecordType::CreateUser:
+    {
+        std::string username = r.str();
+        r.str();
+        r.str();
+        if (!r.ok() || userExists(username))
+            return false;
+        staged.users.insert(std::move(username));
+        return true;
+    }
+    case RecordType::LoginMeta:
+    {
+        std::string username = r.str();
+        r.str();
+        r.i32();
+        return r.ok() && userExists(username);
+    }
+    case RecordType::DarkMode:
+    {
+        std::string username = r.str();
+        r.u8();
+        return r.ok() && userExists(username);
+    }
+    case RecordType::SaveItem:
+    {
+        std::string username = r.str();
+        // fara BlobStore: imaginea nu conteaza pentru verificare
+        auto item = decodeItem(r, nullptr);
+        if (!item || !userExists(username))
+            return false;
+        staged.items[username][item->id] = true;
+        return true;
+    }
+    case RecordType::DeleteItem:
+    {
+        std::string username = r.str();
+        int itemId = r.i32();
+        if (!r.ok() || !itemExists(username, itemId))
+            return false;
+        staged.items[username][itemId] = false;
+        return true;
+    }
+    case RecordType::SaveOutfit:
+    {
+        std::string username = r.str();
+        auto outfit = decodeOutfit(r);
+        if (!outfit || !userExists(username))
+            return false;
+        staged.outfits[username][outfit->getId()] = true;
+        return true;
+    }
+    case RecordType::Wear:
+    {
+        std::string username = r.str();
+        for (std::uint32_t n = r.u32(); n > 0 && r.ok(); --n)
+        {
+            r.i32();
+            r.i32();
+            r.u64();
+        }
+        return r.ok() && userExists(username);
+    }
+    case RecordType::DeleteOutfit:
+    {
+        std::string username = r.str();
+        std::string outfitId = r.str();
+        if (!r.ok() || !outfitExists(username, outfitId))
+            return false;
+        staged.outfits[username][outfitId] = false;
+        return true;
+    }
+    }
+    return false;
+}
+
+bool NativeBackend::applyBatch(const std::vector<std::uint8_t> &payload)
+{
+    ByteReader r(payload);
+    bool ok = true;
+    for (std::uint32_t n = r.u32(); n > 0 && r.ok(); --n)
+    {
+        auto subType = static_cast<RecordType>(r.u8());
+        auto sub = r.bytes();
+        if (!r.ok())
+            return false;
+        ok = apply(subType, sub) && ok;
+    }
+    return ok && r.ok();
+}
+
+bool NativeBackend::apply(RecordType type, const std::vector<std::uint8_t> &payload)
+{
+    ByteReader r(payload);
+    switch (type)
+    {
+    case RecordType::Batch:
+        // la replay un lot care nu trece verificarea e sarit intreg, ca la scriere
+        return checkBatch(payload) && applyBatch(payload);
+    case RecordType::Generation:
+    {
+        const std::uint64_t nonce = r.u64();
+        if (!r.ok())
+            return false;
+        generation_ = nonce;
+        return true;
+    }
+    case RecordType::CreateUser:
+    {
+        std::string username = r.str();
+        UserRecord rec;
+        rec.name = r.str();
+        rec.password = r.str();
+        rec.revision = currentRevision();
+        if (!r.ok() || users_.count(username))
+            return false;
+        users_.emplace(username, std::move(rec));
+        return true;
+    }
+    case RecordType::LoginMeta:
+    {
+        std::string username = r.str();
+        Date date = Date::fromString(r.str());
+        int streak = r.i32();
+        auto it = users_.find(username);
+        if (!r.ok() || it == users_.end())
+            return false;
+        it->second.lastLoginDate = date;
+        it->second.streak = streak;
+        return true;
+    }
+    case RecordType::DarkMode:
+    {
+        std::string username = r.str();
+        bool dark = r.u8() != 0;
+        auto it = users_.find(username);
+        if (!r.ok() || it == users_.end())
+            return false;
+        it->second.darkMode = dark;
+        return true;
+    }
+    case RecordType::SaveItem:
+    {
+        std::string username = r.str();
+        auto item = decodeItem(r, blobs_.get());
+        auto it = users_.find(username);
+        if (!item || it == users_.end())
+            return false;
+        it->second.revision = currentRevision();
+        lastItemId_ = std::max(lastItemId_, item->id);
+        it->second.items[item->id] = std::move(*item);
+        return true;
+    }
+    case RecordType::DeleteItem:
+    {
+        std::string username = r.str();
+        int itemId = r.i32();
+        auto it = users_.find(username);
+        if (!r.ok() || it == users_.end())
+            return false;
+        it->second.revision = currentRevision();
+        if (it->second.items.erase(itemId) == 0)
+            return false;
+        // ca relatia inversa din Core Data: articolul dispare si din outfit-uri
+        // (doar din cele care il folosesc, gasite prin indexul invers)
+        auto &rec = it->second;
+        auto used = rec.outfitsByItem.find(itemId);
+        if (used != rec.outfitsByItem.end())
+        {
+            for (const auto &outfitId : used->second)
+                rec.outfits[rec.outfitSlots.at(outfitId)]->removeItem(itemId);
+            rec.outfitsByItem.erase(used);
+        }
+        return true;
+    }
+    case RecordType::SaveOutfit:
+    {
+        std::string username = r.str();
+        auto outfit = decodeOutfit(r);
+        auto it = users_.find(username);
+        if (!outfit || it == users_.end())
+            return false;
+        auto &rec = it->second;
+        rec.revision = currentRevision();
+
+        // pastram doar articolele existente, sortate dupa id (ca fetch-ul din Core Data)
+        std::vector<int> linked;
+        for (int id : outfit->getItemIds())
+            if (rec.items.count(id))
+                linked.push_back(id);
+        std::sort(linked.begin(), linked.end());
+        linked.erase(std::unique(linked.begin(), linked.end()), linked.end());
+        outfit->setItemIds(linked);
+
+        auto slot = rec.outfitSlots.find(outfit->getId());
+        if (slot != rec.outfitSlots.end())
+            rec.unlinkOutfit(*rec.outfits[slot->second]);
+        for (int id : linked)
+            rec.outfitsByItem[id].push_back(outfit->getId());
+
+        if (slot != rec.outfitSlots.end())
+            rec.outfits[slot->second] = std::move(outfit);
+        else
+        {
+            rec.outfitSlots[outfit->getId()] = rec.outfits.size();
+            rec.outfits.push_back(std::move(outfit));
+        }
+        return true;
+    }
+    case RecordType::Wear:
+    {
+        std::string username = r.str();
+        std::uint32_t n = r.u32();
+        auto it = users_.find(username);
+        if (!r.ok() || it == users_.end())
+            return false;
+        it->second.revision = currentRevision();
+        // fara reserve(n): un n corupt nu trebuie sa aloce
+        std::vector<WearRecord> records;
+        for (; n > 0 && r.ok(); --n)
+        {
+            WearRecord record{};
+            record.day = r.i32();
+            record.itemId = r.i32();
+            record.outfitKey = r.u64();
+            records.push_back(record);
+        }
+        if (!r.ok())
+            return false;
+        auto &wears = it->second.wears;
+        wears.insert(wears.end(), records.begin(), records.end());
+        return true;
+    }
+    case RecordType::DeleteOutfit:
+    {
+        std::string username = r.str();
+        std::string outfitId = r.str();
+        auto it = users_.find(username);
+        if (!r.ok() || it == users_.end())
+            return false;
+        auto &rec = it->second;
+        rec.revision = currentRevision();
+        auto slot = rec.outfitSlots.find(outfitId);
+        if (slot == rec.outfitSlots.end())
+            return false;
+
+        // swap cu ultimul ca stergerea sa fie O(1)
+        std::size_t idx = slot->second;
+        rec.unlinkOutfit(*rec.outfits[idx]);
+        rec.outfitSlots.erase(slot);
+        if (idx != rec.outfits.size() - 1)
+        {
+            rec.outfits[idx] = std::move(rec.outfits.back());
+            rec.outfitSlots[rec.outfits[idx]->getId()] = idx;
+        }
+        rec.outfits.pop_back();
+        return true;
+    }
+    }
+    return false;
+}
+
+std::shared_ptr<User> NativeBackend::makeUser(const std::string &username, const UserRecord &rec, bool withPassword) const
+{
+    auto user = std::make_shared<User>(username, rec.name, withPassword ? rec.password : "");
+    user->setLastLogIn(rec.lastLoginDate);
+    user->setStreak(rec.streak == 0 ? 1 : rec.streak);
+    user->setDarkMode(rec.darkMode);
+    return user;
+}
+
+// user operations
+
+bool NativeBackend::createUser(const std::string &username, const std::string &name, const std::string &password)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (users_.count(username))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    w.str(name);
+    w.str(password);
+    return append(RecordType::CreateUser, payload) && apply(RecordType::CreateUser, payload);
+}
+
+std::shared_ptr<User> NativeBackend::loginUser(const std::string &username, const std::string &password)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end() || it->second.password != password)
+        return nullptr;
+    return makeUser(username, it->second, true);
+}
+
+bool NativeBackend::updateUserLoginMeta(const UserHandle &user, Date lastLoginDate, int streak)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    w.str(lastLoginDate.toString());
+    w.i32(streak);
+    return append(RecordType::LoginMeta, payload) && apply(RecordType::LoginMeta, payload);
+}
+
+bool NativeBackend::updateUserDarkMode(const UserHandle &user, bool isDarkMode)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    w.u8(isDarkMode ? 1 : 0);
+    return append(RecordType::DarkMode, payload) && apply(RecordType::DarkMode, payload);
+}
+
+std::shared_ptr<User> NativeBackend::recoverUser(const std::string &username)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end())
+        return nullptr;
+    return makeUser(username, it->second, false);
+}
+
+// indexul e deja in memorie, handle-ul poarta doar username-ul
+UserHandlePtr NativeBackend::resolveUser(const std::string &username)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return nullptr;
+    return std::make_shared<UserHandle>(username);
+}
+
+// clothing item operations
+
+std::vector<ItemRecord> NativeBackend::fetchClothingItems(const UserHandle &user)
+{
+    const std::string &username = user.username();
+    std::vector<ItemRecord> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end())
+        return result;
+
+    // record-urile sunt plate: o singura alocare pentru tot vectorul
+    result.reserve(it->second.items.size());
+    for (const auto &[id, item] : it->second.items)
+        result.push_back(item);
+    return result;
+}
+
+std::vector<ItemRecord> NativeBackend::fetchClothingItemPage(const UserHandle &user, int afterId, std::size_t limit)
+{
+    std::vector<ItemRecord> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(user.username());
+    if (it == users_.end())
+        return result;
+
+    const auto &items = it->second.items;
+    for (auto item = items.upper_bound(afterId); item != items.end() && result.size() < limit; ++item)
+        result.push_back(item->second);
+    return result;
+}
+
+bool NativeBackend::saveClothingItem(const UserHandle &user, const ItemRecord &item)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    encodeItem(w, item);
+    return append(RecordType::SaveItem, payload) && apply(RecordType::SaveItem, payload);
+}
+
+bool NativeBackend::deleteClothingItem(const UserHandle &user, int itemId)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end() || !it->second.items.count(itemId))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    w.i32(itemId);
+    return append(RecordType::DeleteItem, payload) && apply(RecordType::DeleteItem, payload);
+}
+
+bool NativeBackend::saveClothingItems(const UserHandle &user, std::span<const ItemRecord> items)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    PendingRecords records;
+    records.reserve(items.size());
+    for (const auto &item : items)
+    {
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        encodeItem(w, item);
+        records.emplace_back(RecordType::SaveItem, std::move(payload));
+    }
+    return commitBatch(records);
+}
+
+bool NativeBackend::deleteClothingItems(const UserHandle &user, std::span<const int> itemIds)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end())
+        return false;
+
+    // doar articolele existente, fiecare o singura data
+    std::vector<int> ids(itemIds.begin(), itemIds.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    PendingRecords records;
+    for (int itemId : ids)
+    {
+        if (!it->second.items.count(itemId))
+            continue;
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        w.i32(itemId);
+        records.emplace_back(RecordType::DeleteItem, std::move(payload));
+    }
+    return commitBatch(records);
+}
+
+// outfit operations
+
+std::vector<std::shared_ptr<Outfit>> NativeBackend::fetchOutfits(const UserHandle &user)
+{
+    const std::string &username = user.username();
+    std::vector<std::shared_ptr<Outfit>> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end())
+        return result;
+
+    // outfit-urile au setteri, deci intoarcem copii ca apelantul sa nu modifice indexul
+    result.reserve(it->second.outfits.size());
+    for (const auto &outfit : it->second.outfits)
+        result.push_back(std::make_shared<Outfit>(*outfit));
+    return result;
+}
+
+std::vector<std::shared_ptr<Outfit>> NativeBackend::fetchOutfitPage(const UserHandle &user, const std::string &afterId,
+                                                                    std::size_t limit)
+{
+    std::vector<std::shared_ptr<Outfit>> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(user.username());
+    if (it == users_.end())
+        return result;
+
+    const UserRecord &rec = it->second;
+    for (auto slot = rec.outfitSlots.upper_bound(afterId); slot != rec.outfitSlots.end() && result.size() < limit; ++slot)
+        result.push_back(std::make_shared<Outfit>(*rec.outfits[slot->second]));
+    return result;
+}
+
+bool NativeBackend::saveOutfit(const UserHandle &user, const Outfit &outfit)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    encodeOutfit(w, outfit);
+    return append(RecordType::SaveOutfit, payload) && apply(RecordType::SaveOutfit, payload);
+}
+
+bool NativeBackend::saveOutfits(const UserHandle &user, std::span<const Outfit> outfits)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    PendingRecords records;
+    records.reserve(outfits.size());
+    for (const auto &outfit : outfits)
+    {
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        encodeOutfit(w, outfit);
+        records.emplace_back(RecordType::SaveOutfit, std::move(payload));
+    }
+    return commitBatch(records);
+}
+
+bool NativeBackend::deleteOutfit(const UserHandle &user, const std::string &outfitId)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end() || !it->second.outfitSlots.count(outfitId))
+        return false;
+
+    std::vector<std::uint8_t> payload;
+    ByteWriter w(payload);
+    w.str(username);
+    w.str(outfitId);
+    return append(RecordType::DeleteOutfit, payload) && apply(RecordType::DeleteOutfit, payload);
+}
+
+bool NativeBackend::deleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(username);
+    if (it == users_.end())
+        return false;
+
+    std::vector<std::string> ids(outfitIds.begin(), outfitIds.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    PendingRecords records;
+    for (const auto &outfitId : ids)
+    {
+        if (!it->second.outfitSlots.count(outfitId))
+            continue;
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        w.str(outfitId);
+        records.emplace_back(RecordType::DeleteOutfit, std::move(payload));
+    }
+    return commitBatch(records);
+}
+
+// wear log
+
+bool NativeBackend::appendWearRecords(const UserHandle &user, std::span<const WearRecord> records)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+    if (records.empty())
+        return true;
+
+    std::vector<std::uint8_t> payload = encodeWears(username, records);
+    return append(RecordType::Wear, payload) && apply(RecordType::Wear, payload);
+}
+
+bool NativeBackend::importWardrobe(const UserHandle &user, std::span<const ItemRecord> items,
+                                   std::span<const Outfit> outfits, std::span<const WearRecord> wears)
+{
+    const std::string &username = user.username();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!users_.count(username))
+        return false;
+
+    // ordinea conteaza la aplicare: outfit-urile isi pastreaza doar articolele deja existente
+    PendingRecords records;
+    records.reserve(items.size() + outfits.size() + 1);
+    for (const auto &item : items)
+    {
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        encodeItem(w, item);
+        records.emplace_back(RecordType::SaveItem, std::move(payload));
+    }
+    for (const auto &outfit : outfits)
+    {
+        std::vector<std::uint8_t> payload;
+        ByteWriter w(payload);
+        w.str(username);
+        encodeOutfit(w, outfit);
+        records.emplace_back(RecordType::SaveOutfit, std::move(payload));
+    }
+    if (!wears.empty())
+        records.emplace_back(RecordType::Wear, encodeWears(username, wears));
+    return commitBatch(records);
+}
+
+std::vector<WearRecord> NativeBackend::fetchWearRecords(const UserHandle &user)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(user.username());
+    if (it == users_.end())
+        return {};
+    return it->second.wears;
+}
+
+std::uint64_t NativeBackend::dataRevision(const UserHandle &user)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = users_.find(user.username());
+    if (it == users_.end())
+        return 0;
+    // un snapshot scris la versiunea asta nu trebuie sa supravietuiasca inregistrarilor pe care le acopera
+    if (unsynced_)
+    {
+        if (std::fflush(log_) != 0 || ::fsync(::fileno(log_)) != 0)
+            return 0;
+        unsynced_ = false;
+    }
+    return it->second.revision;
+}
+
+int NativeBackend::generateNextClothingItemId()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ++lastItemId_;
+}
+
+// UUID v4 (format identic cu NSUUID)
+std::string NativeBackend::generateNextOutfitId()
+{
+    static thread_local std::mt19937_64 rng{std::random_device{}()};
+    std::uint64_t hi = rng();
+    std::uint64_t lo = rng();
+    hi = (hi & 0xFFFFFFFFFFFF0FFFull) | 0x0000000000004000ull;
+    lo = (lo & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;
+
+    static const char *hex = "0123456789ABCDEF";
+    std::string out;
+    out.reserve(36);
+    for (int i = 15; i >= 0; --i)
+    {
+        out.push_back(hex[(hi >> (4 * i)) & 0xF]);
+        if (i == 8 || i == 4)
+            out.push_back('-');
+    }
+    out.push_back('-');
+    for (int i = 15; i >= 0; --i)
+    {
+        out.push_back(hex[(lo >> (4 * i)) & 0xF]);
+        if (i == 12)
+            out.push_back('-');
+    }
+    return out;
+}
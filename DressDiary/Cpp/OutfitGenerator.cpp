@@ -0,0 +1,492 @@
+#include "OutfitGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+
+namespace
+{
+    constexpr double NoThreshold = -std::numeric_limits<double>::infinity();
+    // scorurile egale pot diferi la rotunjire dupa ordinea adunarilor; fara marja,
+    // ramurile cu scor egal cu pragul nu s-ar mai taia
+    constexpr double Epsilon = 1e-9;
+    constexpr std::size_t MaxSlots = 4;
+
+    // ---- reguli de compatibilitate (vocabularul din AddItemView / FilterPageView) ----
+
+    // pozitia pe roata culorilor; neutrele merg cu orice, restul (ex. "other") sunt necunoscute
+    constexpr int Neutral = -1;
+    constexpr int Unknown = -2;
+
+    int colorClass(const std::string &color)
+    {
+        static const std::map<std::string, int, std::less<>> wheel = {
+            {"red", 0}, {"orange", 1}, {"yellow", 2}, {"green", 3}, {"blue", 4}, {"purple", 5}, {"pink", 6},
+            {"black", Neutral}, {"white", Neutral}, {"gray", Neutral}, {"grey", Neutral}, {"brown", Neutral},
+            {"beige", Neutral}, {"navy", Neutral}};
+        auto it = wheel.find(color);
+        return it != wheel.end() ? it->second : Unknown;
+    }
+
+    double colorPair(int a, int b)
+    {
+        if (a == Neutral || b == Neutral)
+            return 1.0;
+        if (a == Unknown || b == Unknown)
+            return 0.0;
+        if (a == b)
+            return 0.5; // monocrom
+        int d = std::abs(a - b);
+        d = std::min(d, 7 - d);
+        if (d == 1)
+            return 0.6; // culori vecine
+        if (d == 3)
+            return 0.4; // aproape complementare
+        return -0.4;
+    }
+
+    // cat de potrivit e un material pentru sezon
+    double materialFit(const std::string &material, Symbol season)
+    {
+        if (season == symbols::Vara)
+        {
+            if (material == "cotton" || material == "linen" || material == "silk")
+                return 0.5;
+            if (material == "wool" || material == "leather")
+                return -1.0;
+        }
+        else if (season == symbols::Iarna)
+        {
+            if (material == "wool" || material == "leather" || material == "denim")
+                return 0.5;
+            if (material == "linen" || material == "silk")
+                return -1.0;
+        }
+        else if (season == symbols::Primavara || season == symbols::Toamna)
+        {
+            if (material == "cotton" || material == "denim")
+                return 0.25;
+            if (material == "leather" && season == symbols::Toamna)
+                return 0.25;
+        }
+        return 0.0;
+    }
+
+    // acelasi material "vizibil" pe doua piese (ex. denim pe denim) nu arata bine
+    constexpr double SharedMaterialPenalty = -0.3;
+
+    bool neutralMaterial(const std::string &material)
+    {
+        return material == "cotton" || material == "polyester";
+    }
+
+    // ---- clase de articole echivalente ----
+
+    struct ItemClass
+    {
+        int color = Unknown;
+        std::uint64_t materials = 0; // un bit per material "vizibil"
+        double unary = 0.0;
+        std::vector<int> itemIds;
+    };
+
+    struct SlotData
+    {
+        std::vector<ItemClass> classes;
+    };
+
+    struct Entry
+    {
+        double score = 0.0;
+        std::array<std::uint32_t, MaxSlots> classes{};
+        std::uint64_t count = 0; // cate combinatii de articole reprezinta (produsul multiplicitatilor)
+    };
+
+    struct EntryGreater
+    {
+        bool operator()(const Entry &a, const Entry &b) const { return a.score > b.score; }
+    };
+
+    // heap min dupa scor care pastreaza cel putin `k` combinatii de articole
+    class TopK
+    {
+        std::priority_queue<Entry, std::vector<Entry>, EntryGreater> heap_;
+        std::uint64_t total_ = 0;
+        std::uint64_t k_;
+
+    public:
+        explicit TopK(std::size_t k) : k_(k) {}
+
+        bool full() const { return total_ >= k_; }
+        double threshold() const { return full() ? heap_.top().score : NoThreshold; }
+
+        void offer(const Entry &entry)
+        {
+            if (full() && entry.score <= threshold())
+                return;
+            heap_.push(entry);
+            total_ += entry.count;
+            while (!heap_.empty() && total_ - heap_.top().count >= k_)
+            {
+                total_ -= heap_.top().count;
+                heap_.pop();
+            }
+        }
+
+        std::vector<Entry> take()
+        {
+            std::vector<Entry> entries;
+            entries.reserve(heap_.size());
+            while (!heap_.empty())
+            {
+                entries.push_back(heap_.top());
+                heap_.pop();
+            }
+            total_ = 0;
+            return entries;
+        }
+    };
+
+    // pragul global: cel mai bun prag local al unui heap plin (creste monoton)
+    void raise(std::atomic<double> &shared, double value)
+    {
+        double current = shared.load(std::memory_order_relaxed);
+        while (value > current && !shared.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    class Search
+    {
+    public:
+        Search(const std::vector<SlotData> &slots, std::size_t k) : slots_(slots), k_(k)
+        {
+            const std::size_t n = slots_.size();
+            for (std::size_t s = 0; s < n; ++s)
+                for (std::size_t t = s + 1; t < n; ++t)
+                    buildPair(s, t);
+            buildLastOrder();
+        }
+
+        std::vector<Entry> run(unsigned threads)
+        {
+            // primul nivel, ordonat dupa bound: thread-urile iau clasele pe rand
+            Level first = expand(0, {}, 0.0);
+            std::atomic<std::size_t> next{0};
+            std::atomic<double> shared{NoThreshold};
+            std::vector<std::vector<Entry>> partial(threads);
+
+            auto worker = [&](unsigned index)
+            {
+                TopK top(k_);
+                std::array<std::uint32_t, MaxSlots> chosen{};
+                for (std::size_t i = next.fetch_add(1); i < first.size(); i = next.fetch_add(1))
+                {
+                    const auto &[bound, cls, gain] = first[i];
+                    if (bound <= std::max(top.threshold(), shared.load(std::memory_order_relaxed)) + Epsilon)
+                        break; // restul au bound si mai mic
+                    chosen[0] = cls;
+                    descend(1, chosen, gain, top, shared);
+                }
+                partial[index] = top.take();
+            };
+
+            if (threads <= 1)
+                worker(0);
+            else
+            {
+                std::vector<std::thread> pool;
+                pool.reserve(threads);
+                for (unsigned t = 0; t < threads; ++t)
+                    pool.emplace_back(worker, t);
+                for (auto &thread : pool)
+                    thread.join();
+            }
+
+            std::vector<Entry> merged;
+            for (auto &entries : partial)
+                merged.insert(merged.end(), entries.begin(), entries.end());
+            return merged;
+        }
+
+    private:
+        // (bound, clasa, castig) pentru fiecare clasa a unui nivel
+        using Level = std::vector<std::tuple<double, std::uint32_t, double>>;
+
+        struct PairTable
+        {
+            std::vector<double> scores; // [clasa din s][clasa din t]
+            std::vector<double> rowMax; // pentru fiecare clasa din s: cel mai bun partener din t
+            double max = NoThreshold;
+        };
+
+        void buildPair(std::size_t s, std::size_t t)
+        {
+            const auto &a = slots_[s].classes;
+            const auto &b = slots_[t].classes;
+            PairTable table;
+            table.scores.resize(a.size() * b.size());
+            table.rowMax.assign(a.size(), NoThreshold);
+            for (std::size_t i = 0; i < a.size(); ++i)
+                for (std::size_t j = 0; j < b.size(); ++j)
+                {
+                    double score = colorPair(a[i].color, b[j].color) +
+                                   SharedMaterialPenalty * std::popcount(a[i].materials & b[j].materials);
+                    table.scores[i * b.size() + j] = score;
+                    table.rowMax[i] = std::max(table.rowMax[i], score);
+                    table.max = std::max(table.max, score);
+                }
+            pairs_[s][t] = std::move(table);
+        }
+
+        // pentru fiecare clasa de pe penultimul nivel: clasele ultimului nivel, descrescator dupa
+        // unar + perechea cu ea; pe ultimul nivel se parcurg in ordinea asta pana la prag
+        void buildLastOrder()
+        {
+            const std::size_t last = slots_.size() - 1;
+            const auto &prev = slots_[last - 1].classes;
+            const auto &classes = slots_[last].classes;
+            lastOrder_.assign(prev.size(), {});
+            for (std::uint32_t p = 0; p < prev.size(); ++p)
+            {
+                auto &order = lastOrder_[p];
+                for (std::uint32_t c = 0; c < classes.size(); ++c)
+                    order.emplace_back(classes[c].unary + pairScore(last - 1, p, last, c), c);
+                std::sort(order.begin(), order.end(), std::greater<>());
+            }
+        }
+
+        double pairScore(std::size_t s, std::uint32_t a, std::size_t t, std::uint32_t b) const
+        {
+            return pairs_[s][t].scores[a * slots_[t].classes.size() + b];
+        }
+
+        // castigul clasei c pe nivelul `level` fata de clasele deja alese
+        double gain(std::size_t level, std::uint32_t c, const std::array<std::uint32_t, MaxSlots> &chosen) const
+        {
+            double g = slots_[level].classes[c].unary;
+            for (std::size_t l = 0; l < level; ++l)
+                g += pairScore(l, chosen[l], level, c);
+            return g;
+        }
+
+        // candidatii nivelului, fiecare cu o margine superioara pentru tot ce urmeaza
+        Level expand(std::size_t level, const std::array<std::uint32_t, MaxSlots> &chosen, double partial) const
+        {
+            const std::size_t n = slots_.size();
+
+            // nivelurile urmatoare: cel mai bun castig fata de ce s-a ales + perechi intre ele
+            double rest = 0.0;
+            for (std::size_t t = level + 1; t < n; ++t)
+            {
+                double best = NoThreshold;
+                for (std::uint32_t c = 0; c < slots_[t].classes.size(); ++c)
+                    best = std::max(best, gain(t, c, chosen));
+                rest += best;
+                for (std::size_t u = t + 1; u < n; ++u)
+                    rest += pairs_[t][u].max;
+            }
+
+            Level candidates;
+            candidates.reserve(slots_[level].classes.size());
+            for (std::uint32_t c = 0; c < slots_[level].classes.size(); ++c)
+            {
+                const double g = gain(level, c, chosen);
+                double bound = partial + g + rest;
+                for (std::size_t t = level + 1; t < n; ++t)
+                    bound += pairs_[level][t].rowMax[c];
+                candidates.emplace_back(bound, c, g);
+            }
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const auto &a, const auto &b) { return std::get<0>(a) > std::get<0>(b); });
+            return candidates;
+        }
+
+        void descend(std::size_t level, std::array<std::uint32_t, MaxSlots> &chosen, double partial,
+                     TopK &top, std::atomic<double> &shared) const
+        {
+            // slots_.size() <= MaxSlots; limita explicita tine indicii in chosen si la inlining
+            if (level + 1 >= MaxSlots || level + 1 >= slots_.size())
+            {
+                lastLevel(chosen, partial, top, shared);
+                return;
+            }
+
+            for (const auto &[bound, cls, g] : expand(level, chosen, partial))
+            {
+                if (bound <= std::max(top.threshold(), shared.load(std::memory_order_relaxed)) + Epsilon)
+                    break;
+                chosen[level] = cls;
+                descend(level + 1, chosen, partial + g, top, shared);
+            }
+        }
+
+        // ultimul nivel nu mai coboara: combinatiile complete merg direct in top
+        void lastLevel(std::array<std::uint32_t, MaxSlots> &chosen, double partial,
+                       TopK &top, std::atomic<double> &shared) const
+        {
+            const std::size_t last = slots_.size() - 1;
+            // perechile cu nivelurile de dinainte de penultimul intra in bound doar prin maximul lor
+            double slack = 0.0;
+            for (std::size_t l = 0; l + 1 < last; ++l)
+                slack += pairs_[l][last].rowMax[chosen[l]];
+
+            for (const auto &[base, cls] : lastOrder_[chosen[last - 1]])
+            {
+                if (partial + base + slack <= std::max(top.threshold(), shared.load(std::memory_order_relaxed)) + Epsilon)
+                    break;
+                double score = partial + base;
+                for (std::size_t l = 0; l + 1 < last; ++l)
+                    score += pairScore(l, chosen[l], last, cls);
+                chosen[last] = cls;
+                offer(chosen, score, top, shared);
+            }
+        }
+
+        void offer(const std::array<std::uint32_t, MaxSlots> &chosen, double score,
+                   TopK &top, std::atomic<double> &shared) const
+        {
+            Entry entry;
+            entry.score = score;
+            entry.classes = chosen;
+            entry.count = 1;
+            for (std::size_t s = 0; s < slots_.size(); ++s)
+                entry.count *= slots_[s].classes[chosen[s]].itemIds.size();
+            top.offer(entry);
+            if (top.full())
+                raise(shared, top.threshold());
+        }
+
+        const std::vector<SlotData> &slots_;
+        std::size_t k_;
+        std::vector<std::vector<std::pair<double, std::uint32_t>>> lastOrder_;
+        std::array<std::array<PairTable, MaxSlots>, MaxSlots> pairs_;
+    };
+}
+
+std::vector<OutfitGenerator::Result> OutfitGenerator::generate(std::span<const ItemRecord> items, const Options &options)
+{
+    std::vector<Result> results;
+    if (options.count == 0)
+        return results;
+
+    const SymbolTable &table = SymbolTable::getInstance();
+    const Symbol season = table.fold(options.season);
+    const bool rainy = options.rainy.value_or(season == symbols::Primavara || season == symbols::Toamna);
+
+    // geaca: obligatorie iarna sau pe ploaie (atunci impermeabila), altfel nu intra in outfit
+    const bool needsJacket = rainy || season == symbols::Iarna;
+    std::vector<Symbol> categories = {symbols::Top, symbols::Pants};
+    if (needsJacket)
+        categories.push_back(symbols::Jacket);
+    categories.push_back(symbols::Shoes);
+
+    // clase de echivalenta: articolele cu aceeasi (culoare pe roata, materiale vizibile, scor unar)
+    // au acelasi scor in orice combinatie
+    std::vector<SlotData> slots(categories.size());
+    std::vector<std::map<std::tuple<int, std::uint64_t, double>, std::uint32_t>> keys(categories.size());
+    std::map<Symbol, std::uint64_t> materialBits;
+
+    for (const auto &item : items)
+    {
+        const Symbol category = table.fold(item.category);
+        auto slot = std::find(categories.begin(), categories.end(), category);
+        if (slot == categories.end())
+            continue;
+        const std::size_t s = static_cast<std::size_t>(slot - categories.begin());
+
+        const auto *jacket = std::get_if<JacketData>(&item.payload);
+        const bool waterproof = jacket && jacket->waterproof;
+        if (category == symbols::Jacket && rainy && !waterproof)
+            continue;
+
+        std::vector<Symbol> materials;
+        for (Symbol m : item.materials)
+            materials.push_back(table.fold(m));
+        std::sort(materials.begin(), materials.end());
+        materials.erase(std::unique(materials.begin(), materials.end()), materials.end());
+
+        std::uint64_t mask = 0;
+        double fit = 0.0;
+        for (Symbol m : materials)
+        {
+            const std::string &name = table.name(m);
+            fit += materialFit(name, season);
+            if (neutralMaterial(name))
+                continue;
+            auto bit = materialBits.find(m);
+            if (bit == materialBits.end() && materialBits.size() < 64)
+                bit = materialBits.emplace(m, std::uint64_t(1) << materialBits.size()).first;
+            if (bit != materialBits.end())
+                mask |= bit->second;
+        }
+        double unary = materials.empty() ? 0.0 : fit / materials.size();
+        if (category == symbols::Jacket && waterproof && rainy)
+            unary += 0.5;
+
+        const int color = colorClass(table.name(table.fold(item.color)));
+        auto [it, inserted] = keys[s].try_emplace({color, mask, unary},
+                                                  static_cast<std::uint32_t>(slots[s].classes.size()));
+        if (inserted)
+            slots[s].classes.push_back({color, mask, unary, {}});
+        slots[s].classes[it->second].itemIds.push_back(item.id);
+    }
+
+    for (auto &slot : slots)
+    {
+        if (slot.classes.empty())
+            return results; // un slot obligatoriu fara articole: nicio combinatie valida
+        for (auto &cls : slot.classes)
+            std::sort(cls.itemIds.begin(), cls.itemIds.end());
+    }
+
+    unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<unsigned>(threads, static_cast<unsigned>(slots[0].classes.size()));
+
+    Search search(slots, options.count);
+    std::vector<Entry> entries = search.run(threads);
+
+    // ordine determinista: scor descrescator, apoi clasele
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b)
+              { return a.score != b.score ? a.score > b.score : a.classes < b.classes; });
+
+    // fiecare intrare se desface in combinatiile de articole pe care le reprezinta
+    for (const auto &entry : entries)
+    {
+        std::array<std::size_t, MaxSlots> pick{};
+        while (results.size() < options.count)
+        {
+            Result result;
+            result.score = entry.score;
+            for (std::size_t s = 0; s < slots.size(); ++s)
+                result.itemIds.push_back(slots[s].classes[entry.classes[s]].itemIds[pick[s]]);
+            results.push_back(std::move(result));
+
+            // urmatoarea combinatie (numarare in baza multiplicitatilor)
+            bool more = false;
+            for (std::size_t s = slots.size(); s-- > 0;)
+            {
+                if (++pick[s] < slots[s].classes[entry.classes[s]].itemIds.size())
+                {
+                    more = true;
+                    break;
+                }
+                pick[s] = 0;
+            }
+            if (!more)
+                break;
+        }
+        if (results.size() >= options.count)
+            break;
+    }
+    return results;
+}
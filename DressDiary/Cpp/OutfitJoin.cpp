@@ -0,0 +1,94 @@
+#include "OutfitJoin.hpp"
+#include <algorithm>
+
+void OutfitJoin::clear()
+{
+    components_.clear();
+    usedBy_.clear();
+}
+
+void OutfitJoin::reserve(std::size_t items, std::size_t outfits)
+{
+    usedBy_.reserve(items);
+    components_.reserve(outfits);
+}
+
+void OutfitJoin::replace(std::vector<Slot> &slots, Slot from, Slot to)
+{
+    auto it = std::find(slots.begin(), slots.end(), from);
+    if (it != slots.end())
+        *it = to;
+}
+
+void OutfitJoin::erase(std::vector<Slot> &slots, Slot value)
+{
+    slots.erase(std::remove(slots.begin(), slots.end(), value), slots.end());
+}
+
+// legaturile inverse pentru un outfit
+
+void OutfitJoin::link(Slot outfit)
+{
+    for (Slot item : components_[outfit])
+        usedBy_[item].push_back(outfit);
+}
+
+void OutfitJoin::unlink(Slot outfit)
+{
+    for (Slot item : components_[outfit])
+        erase(usedBy_[item], outfit);
+}
+
+// articole
+
+void OutfitJoin::pushItem()
+{
+    usedBy_.emplace_back();
+}
+
+void OutfitJoin::swapRemoveItem(std::size_t slot)
+{
+    const Slot removed = static_cast<Slot>(slot);
+    for (Slot outfit : usedBy_[removed])
+        erase(components_[outfit], removed);
+
+    const Slot last = static_cast<Slot>(usedBy_.size() - 1);
+    if (removed != last)
+    {
+        // outfit-urile care foloseau ultimul articol il gasesc acum in `slot`
+        for (Slot outfit : usedBy_[last])
+            replace(components_[outfit], last, removed);
+        usedBy_[removed] = std::move(usedBy_[last]);
+    }
+    usedBy_.pop_back();
+}
+
+// outfit-uri
+
+void OutfitJoin::pushOutfit(std::vector<Slot> itemSlots)
+{
+    components_.push_back(std::move(itemSlots));
+    link(static_cast<Slot>(components_.size() - 1));
+}
+
+void OutfitJoin::setOutfit(std::size_t slot, std::vector<Slot> itemSlots)
+{
+    unlink(static_cast<Slot>(slot));
+    components_[slot] = std::move(itemSlots);
+    link(static_cast<Slot>(slot));
+}
+
+void OutfitJoin::swapRemoveOutfit(std::size_t slot)
+{
+    const Slot removed = static_cast<Slot>(slot);
+    unlink(removed);
+
+    const Slot last = static_cast<Slot>(components_.size() - 1);
+    if (removed != last)
+    {
+        for (Slot item : components_[last])
+            replace(usedBy_[item], last, removed);
+        components_[removed] = std::move(components_[last]);
+    }
+    components_.pop_back();
+}
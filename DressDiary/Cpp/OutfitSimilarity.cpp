@@ -0,0 +1,122 @@
+#include "OutfitSimilarity.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    std::uint64_t mix(std::uint64_t x)
+    {
+        x = (x ^ (x >> 33)) * 0xFF51AFD7ED558CCDull;
+        x = (x ^ (x >> 33)) * 0xC4CEB9FE1A85EC53ull;
+        return x ^ (x >> 33);
+    }
+
+    // cele mai multe randuri pe banda (benzi mai selective) care inca gasesc
+    // o pereche cu similaritatea `threshold` cu probabilitate >= 99%
+    std::size_t rowsPerBand(double threshold)
+    {
+        for (std::size_t rows = OutfitSimilarity::Hashes / 4; rows > 1; rows /= 2)
+        {
+            const double bands = static_cast<double>(OutfitSimilarity::Hashes / rows);
+            const double hit = 1.0 - std::pow(1.0 - std::pow(threshold, static_cast<double>(rows)), bands);
+            if (hit >= 0.99)
+                return rows;
+        }
+        return 1;
+    }
+}
+
+OutfitSimilarity::Signature OutfitSimilarity::signature(std::span<const int> itemSet)
+{
+    Signature sig;
+    sig.fill(std::numeric_limits<std::uint64_t>::max());
+    for (std::size_t i = 0; i < itemSet.size(); ++i)
+    {
+        if (i > 0 && itemSet[i] == itemSet[i - 1])
+            continue;
+        const std::uint64_t base = Outfit::hashItem(itemSet[i]);
+        for (std::size_t h = 0; h < Hashes; ++h)
+            sig[h] = std::min(sig[h], mix(base + h * 0x9E3779B97F4A7C15ull));
+    }
+    return sig;
+}
+
+double OutfitSimilarity::jaccard(std::span<const int> a, std::span<const int> b)
+{
+    std::size_t common = 0, total = 0;
+    std::size_t i = 0, j = 0;
+    while (i < a.size() || j < b.size())
+    {
+        int value;
+        if (j == b.size() || (i < a.size() && a[i] < b[j]))
+            value = a[i];
+        else if (i == a.size() || b[j] < a[i])
+            value = b[j];
+        else
+        {
+            value = a[i];
+            ++common;
+        }
+        ++total;
+        while (i < a.size() && a[i] == value)
+            ++i;
+        while (j < b.size() && b[j] == value)
+            ++j;
+    }
+    return total ? static_cast<double>(common) / total : 0.0;
+}
+
+std::vector<OutfitSimilarity::Match>
+OutfitSimilarity::nearDuplicates(std::span<const std::shared_ptr<Outfit>> outfits, double threshold)
+{
+    threshold = std::clamp(threshold, std::numeric_limits<double>::min(), 1.0);
+
+    std::vector<std::uint32_t> live;
+    std::vector<Signature> signatures;
+    for (std::size_t i = 0; i < outfits.size(); ++i)
+    {
+        if (!outfits[i] || outfits[i]->getItemSet().empty())
+            continue;
+        live.push_back(static_cast<std::uint32_t>(i));
+        signatures.push_back(signature(outfits[i]->getItemSet()));
+    }
+
+    // candidati: aceeasi galeata pe cel putin o banda
+    const std::size_t rows = rowsPerBand(threshold);
+    std::unordered_set<std::uint64_t> candidates;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> buckets;
+    for (std::size_t band = 0; band < Hashes / rows; ++band)
+    {
+        buckets.clear();
+        for (std::uint32_t k = 0; k < live.size(); ++k)
+        {
+            std::uint64_t key = band;
+            for (std::size_t r = 0; r < rows; ++r)
+                key = mix(key ^ signatures[k][band * rows + r]);
+            buckets[key].push_back(k);
+        }
+        for (const auto &[key, members] : buckets)
+            for (std::size_t x = 0; x < members.size(); ++x)
+                for (std::size_t y = x + 1; y < members.size(); ++y)
+                    candidates.insert(static_cast<std::uint64_t>(members[x]) << 32 | members[y]);
+    }
+
+    // verificare exacta
+    std::vector<Match> matches;
+    for (std::uint64_t pair : candidates)
+    {
+        const std::size_t a = live[pair >> 32];
+        const std::size_t b = live[pair & 0xFFFFFFFFu];
+        const double similarity = jaccard(outfits[a]->getItemSet(), outfits[b]->getItemSet());
+        if (similarity >= threshold)
+            matches.push_back({a, b, similarity});
+    }
+    std::sort(matches.begin(), matches.end(), [](const Match &x, const Match &y)
+              { return x.jaccard != y.jaccard ? x.jaccard > y.jaccard
+                                              : std::tie(x.first, x.second) < std::tie(y.first, y.second); });
+    return matches;
+}
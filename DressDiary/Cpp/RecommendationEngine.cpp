@@ -0,0 +1,219 @@
+#include "RecommendationEngine.hpp"
+#include <algorithm>
+
+void RecommendationEngine::clear()
+{
+    state_.clear();
+    sampler_.clear();
+    outfitsByItem_.clear();
+    recent_.clear();
+    recentItems_.clear();
+    todayPick_.reset();
+}
+
+void RecommendationEngine::reserve(std::size_t outfits)
+{
+    state_.reserve(outfits);
+    sampler_.reserve(outfits);
+}
+
+Symbol RecommendationEngine::seasonForMonth(unsigned month)
+{
+    if (month >= 6 && month <= 8)
+        return symbols::Vara;
+    if (month >= 9 && month <= 11)
+        return symbols::Toamna;
+    if (month == 12 || month <= 2)
+        return symbols::Iarna;
+    return symbols::Primavara;
+}
+
+// scor
+
+RecommendationEngine::OutfitState RecommendationEngine::makeState(const Outfit &outfit) const
+{
+    OutfitState state;
+    state.season = SymbolTable::getInstance().fold(outfit.getSeasonId());
+    state.itemIds = outfit.getItemSet();
+    state.itemIds.erase(std::unique(state.itemIds.begin(), state.itemIds.end()), state.itemIds.end());
+    for (int id : state.itemIds)
+        if (recentItems_.count(id))
+            ++state.overlap;
+    return state;
+}
+
+// 0 zile -> minFactor, `fullDays` sau mai mult (ori niciodata) -> 1
+double RecommendationEngine::ageFactor(Day since, int fullDays) const
+{
+    if (since == Never || today_ == Never || fullDays <= 0)
+        return 1.0;
+    const int days = today_ - since;
+    if (days >= fullDays)
+        return 1.0;
+    return std::max(tuning_.minFactor, static_cast<double>(std::max(days, 0)) / fullDays);
+}
+
+double RecommendationEngine::score(const OutfitState &state) const
+{
+    // doar outfit-urile din sezonul curent sunt candidate
+    if (season_ == symbols::Empty || state.season != season_)
+        return 0.0;
+
+    double weight = ageFactor(state.lastWorn, tuning_.recoveryDays) *
+                    ageFactor(state.lastSuggested, tuning_.suggestionCooldown);
+    if (!state.itemIds.empty())
+    {
+        const double shared = static_cast<double>(state.overlap) / state.itemIds.size();
+        weight *= 1.0 - tuning_.overlapPenalty * shared;
+    }
+    return std::max(weight, 0.0);
+}
+
+// index articol -> outfit-uri
+
+void RecommendationEngine::link(std::size_t slot)
+{
+    for (int id : state_[slot].itemIds)
+        outfitsByItem_[id].push_back(slot);
+}
+
+void RecommendationEngine::unlink(std::size_t slot)
+{
+    for (int id : state_[slot].itemIds)
+    {
+        auto it = outfitsByItem_.find(id);
+        if (it == outfitsByItem_.end())
+            continue;
+        std::erase(it->second, slot);
+        if (it->second.empty())
+            outfitsByItem_.erase(it);
+    }
+}
+
+void RecommendationEngine::moveLinks(std::size_t from, std::size_t to)
+{
+    for (int id : state_[from].itemIds)
+    {
+        auto &slots = outfitsByItem_[id];
+        std::replace(slots.begin(), slots.end(), from, to);
+    }
+}
+
+// sincronizare
+
+void RecommendationEngine::pushOutfit(const Outfit &outfit)
+{
+    state_.push_back(makeState(outfit));
+    link(state_.size() - 1);
+    sampler_.push(score(state_.back()));
+}
+
+void RecommendationEngine::setOutfit(std::size_t slot, const Outfit &outfit)
+{
+    // istoricul ramane, se schimba doar sezonul / articolele
+    OutfitState updated = makeState(outfit);
+    updated.lastWorn = state_[slot].lastWorn;
+    updated.lastSuggested = state_[slot].lastSuggested;
+    updated.wearCount = state_[slot].wearCount;
+
+    unlink(slot);
+    state_[slot] = std::move(updated);
+    link(slot);
+    rescore(slot);
+}
+
+void RecommendationEngine::swapRemoveOutfit(std::size_t slot)
+{
+    const std::size_t last = state_.size() - 1;
+    unlink(slot);
+    if (slot != last)
+    {
+        moveLinks(last, slot);
+        state_[slot] = std::move(state_[last]);
+    }
+    state_.pop_back();
+    sampler_.swapRemove(slot);
+
+    if (todayPick_ == slot)
+        todayPick_.reset();
+    else if (todayPick_ == last)
+        todayPick_ = slot;
+}
+
+// istoric
+
+void RecommendationEngine::markWorn(std::size_t slot, Day day)
+{
+    auto &state = state_[slot];
+    ++state.wearCount;
+    if (state.lastWorn == Never || day > state.lastWorn)
+        state.lastWorn = day;
+    rescore(slot);
+}
+
+void RecommendationEngine::adjustOverlap(int itemId, int delta)
+{
+    auto it = outfitsByItem_.find(itemId);
+    if (it == outfitsByItem_.end())
+        return;
+    for (std::size_t slot : it->second)
+    {
+        state_[slot].overlap = static_cast<std::uint32_t>(static_cast<int>(state_[slot].overlap) + delta);
+        rescore(slot);
+    }
+}
+
+void RecommendationEngine::pushRecent(const std::vector<int> &itemIds)
+{
+    // doar outfit-urile care au articole comune cu sugestia isi schimba ponderea
+    for (int id : itemIds)
+        if (recentItems_[id]++ == 0)
+            adjustOverlap(id, +1);
+    recent_.push_back(itemIds);
+
+    while (recent_.size() > tuning_.recentWindow)
+    {
+        for (int id : recent_.front())
+        {
+            auto it = recentItems_.find(id);
+            if (it != recentItems_.end() && --it->second == 0)
+            {
+                recentItems_.erase(it);
+                adjustOverlap(id, -1);
+            }
+        }
+        recent_.pop_front();
+    }
+}
+
+void RecommendationEngine::setContext(Day today, Symbol season)
+{
+    season = SymbolTable::getInstance().fold(season);
+    if (today == today_ && season == season_)
+        return;
+    if (today != today_)
+        todayPick_.reset();
+    today_ = today;
+    season_ = season;
+
+    sampler_.assign([this](std::size_t slot) { return score(state_[slot]); });
+}
+
+std::optional<std::size_t> RecommendationEngine::suggest(Day today, Symbol season)
+{
+    setContext(today, season);
+    if (todayPick_)
+        return todayPick_;
+
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    auto slot = sampler_.sample(unit(rng_));
+    if (!slot)
+        return std::nullopt;
+
+    auto &state = state_[*slot];
+    state.lastSuggested = today;
+    rescore(*slot);
+    pushRecent(state.itemIds);
+    todayPick_ = slot;
+    return slot;
+}
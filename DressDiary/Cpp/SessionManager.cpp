@@ -0,0 +1,305 @@
+#include "SessionManager.hpp"
+#include "Metrics.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+SessionManager::Session::Session(Token token, std::shared_ptr<User> user)
+    : token_(std::move(token)), username_(user->getUsername()), user_(std::move(user)), lastUsed_(0)
+{
+    touch();
+}
+
+SessionManager::SessionManager(DataManager &data) : data_(data)
+{
+    data_.setItemsChangedCallback([this](const std::string &username, const DataManager::ItemsDelta &delta)
+                                  { dispatchItems(username, delta); });
+    data_.setOutfitsChangedCallback([this](const std::string &username, const DataManager::OutfitsDelta &delta)
+                                    { dispatchOutfits(username, delta); });
+}
+
+SessionManager::~SessionManager()
+{
+    data_.setItemsChangedCallback(nullptr);
+    data_.setOutfitsChangedCallback(nullptr);
+}
+
+SessionManager::TokenShard &SessionManager::tokenShard(const Token &token) const
+{
+    return tokens_[std::hash<Token>{}(token) % ShardCount];
+}
+
+SessionManager::UserShard &SessionManager::userShard(const std::string &username) const
+{
+    return users_[std::hash<std::string>{}(username) % ShardCount];
+}
+
+// 128 de biti aleatori, in hex
+SessionManager::Token SessionManager::generateToken()
+{
+    thread_local std::random_device device;
+    char token[33];
+    for (int i = 0; i < 4; ++i)
+        std::snprintf(token + i * 8, 9, "%08x", static_cast<unsigned>(device()));
+    return Token(token, 32);
+}
+
+SessionManager::Token SessionManager::login(const std::string &username, const std::string &password)
+{
+    DD_METRIC_SCOPE("SessionManager::login");
+    auto user = data_.loginUser(username, password);
+    return user ? open(std::move(user)) : Token();
+}
+
+SessionManager::Token SessionManager::recover(const std::string &username)
+{
+    DD_METRIC_SCOPE("SessionManager::recover");
+    auto user = data_.recoverUser(username);
+    return user ? open(std::move(user)) : Token();
+}
+
+SessionManager::Token SessionManager::open(std::shared_ptr<User> user)
+{
+    auto session = std::make_shared<Session>(generateToken(), std::move(user));
+    {
+        UserShard &shard = userShard(session->username());
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.sessions[session->username()].push_back(session);
+    }
+    {
+        TokenShard &shard = tokenShard(session->token());
+        std::unique_lock lock(shard.mutex);
+        shard.sessions.emplace(session->token(), session);
+    }
+
+    // garderoba tocmai a fost incarcata de login / recover
+    const std::size_t budget = getMemoryBudget();
+    const std::size_t resident = residentBytes_ += data_.getCacheBytes(session->username());
+    if (budget != 0 && resident > budget)
+        enforceMemoryBudget();
+    return session->token();
+}
+
+bool SessionManager::logout(const Token &token)
+{
+    SessionPtr session;
+    {
+        TokenShard &shard = tokenShard(token);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.sessions.find(token);
+        if (it == shard.sessions.end())
+            return false;
+        session = std::move(it->second);
+        shard.sessions.erase(it);
+    }
+    close(session);
+    return true;
+}
+
+// sesiunea e deja scoasa din shard-ul de token-uri
+void SessionManager::close(const SessionPtr &session)
+{
+    bool lastSession = false;
+    {
+        UserShard &shard = userShard(session->username());
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(session->username());
+        if (it == shard.sessions.end())
+            return;
+        std::erase(it->second, session);
+        if (it->second.empty())
+        {
+            shard.sessions.erase(it);
+            lastSession = true;
+        }
+    }
+    // in afara lock-ului: evictCache ia lock-urile DataManager
+    if (lastSession)
+        data_.evictCache(session->username());
+}
+
+SessionManager::SessionPtr SessionManager::find(const Token &token) const
+{
+    TokenShard &shard = tokenShard(token);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.sessions.find(token);
+    if (it == shard.sessions.end())
+        return nullptr;
+    it->second->touch();
+    return it->second;
+}
+
+std::shared_ptr<User> SessionManager::user(const Token &token) const
+{
+    SessionPtr session = find(token);
+    return session ? session->user() : nullptr;
+}
+
+std::string SessionManager::username(const Token &token) const
+{
+    SessionPtr session = find(token);
+    return session ? session->username() : std::string();
+}
+
+bool SessionManager::setCallbacks(const Token &token, ItemsCallback itemsChanged, OutfitsCallback outfitsChanged)
+{
+    SessionPtr session = find(token);
+    if (!session)
+        return false;
+    std::lock_guard<std::mutex> lock(session->callbackMutex_);
+    session->itemsChanged_ = std::move(itemsChanged);
+    session->outfitsChanged_ = std::move(outfitsChanged);
+    return true;
+}
+
+std::vector<SessionManager::SessionPtr> SessionManager::sessionsOf(const std::string &username) const
+{
+    UserShard &shard = userShard(username);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(username);
+    return it != shard.sessions.end() ? it->second : std::vector<SessionPtr>();
+}
+
+void SessionManager::dispatchItems(const std::string &username, const DataManager::ItemsDelta &delta)
+{
+    for (const SessionPtr &session : sessionsOf(username))
+    {
+        ItemsCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(session->callbackMutex_);
+            callback = session->itemsChanged_;
+        }
+        if (callback)
+            callback(delta);
+    }
+}
+
+void SessionManager::dispatchOutfits(const std::string &username, const DataManager::OutfitsDelta &delta)
+{
+    for (const SessionPtr &session : sessionsOf(username))
+    {
+        OutfitsCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(session->callbackMutex_);
+            callback = session->outfitsChanged_;
+        }
+        if (callback)
+            callback(delta);
+    }
+}
+
+void SessionManager::setMemoryBudget(std::size_t bytes)
+{
+    memoryBudget_.store(bytes, std::memory_order_relaxed);
+    if (bytes != 0)
+        enforceMemoryBudget();
+}
+
+std::size_t SessionManager::enforceMemoryBudget()
+{
+    const std::size_t budget = getMemoryBudget();
+    if (budget == 0)
+        return 0;
+    std::unique_lock<std::mutex> running(budgetMutex_, std::try_to_lock);
+    if (!running.owns_lock())
+        return 0;
+    DD_METRIC_SCOPE("SessionManager::enforceMemoryBudget");
+
+    struct Resident
+    {
+        std::string username;
+        Clock::time_point lastUsed;
+        std::size_t bytes;
+    };
+    std::vector<Resident> residents;
+    std::size_t total = 0;
+    for (UserShard &shard : users_)
+    {
+        std::vector<std::pair<std::string, Clock::time_point>> users;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            users.reserve(shard.sessions.size());
+            for (const auto &[username, sessions] : shard.sessions)
+            {
+                Clock::time_point lastUsed{};
+                for (const SessionPtr &session : sessions)
+                    lastUsed = std::max(lastUsed, session->lastUsed());
+                users.emplace_back(username, lastUsed);
+            }
+        }
+        // getCacheBytes ia lock-urile DataManager: in afara lock-ului shard-ului
+        for (auto &[username, lastUsed] : users)
+        {
+            const std::size_t bytes = data_.getCacheBytes(username);
+            if (bytes == 0)
+                continue;
+            total += bytes;
+            residents.push_back({std::move(username), lastUsed, bytes});
+        }
+    }
+
+    // se elibereaza pana sub 90% din buget, ca urmatoarele login-uri sa nu refaca imediat calculul
+    const std::size_t target = budget - budget / 10;
+    std::size_t evicted = 0;
+    if (total > budget)
+    {
+        std::sort(residents.begin(), residents.end(),
+                  [](const Resident &a, const Resident &b) { return a.lastUsed < b.lastUsed; });
+        // cel folosit cel mai recent ramane, chiar daca singur depaseste bugetul
+        for (std::size_t i = 0; i + 1 < residents.size() && total > target; ++i)
+        {
+            data_.evictCache(residents[i].username);
+            total -= residents[i].bytes;
+            ++evicted;
+        }
+        DD_METRIC_COUNT("SessionManager.evictions", evicted);
+    }
+    residentBytes_.store(total);
+    return evicted;
+}
+
+std::size_t SessionManager::expireIdle(Clock::duration idleFor)
+{
+    DD_METRIC_SCOPE("SessionManager::expireIdle");
+    const Clock::time_point cutoff = Clock::now() - idleFor;
+    std::vector<SessionPtr> expired;
+    for (TokenShard &shard : tokens_)
+    {
+        std::unique_lock lock(shard.mutex);
+        for (auto it = shard.sessions.begin(); it != shard.sessions.end();)
+        {
+            if (it->second->lastUsed() <= cutoff)
+            {
+                expired.push_back(std::move(it->second));
+                it = shard.sessions.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+    for (const SessionPtr &session : expired)
+        close(session);
+    return expired.size();
+}
+
+std::size_t SessionManager::sessionCount() const
+{
+    std::size_t count = 0;
+    for (const TokenShard &shard : tokens_)
+    {
+        std::shared_lock lock(shard.mutex);
+        count += shard.sessions.size();
+    }
+    return count;
+}
+
+std::size_t SessionManager::userCount() const
+{
+    std::size_t count = 0;
+    for (const UserShard &shard : users_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        count += shard.sessions.size();
+    }
+    return count;
+}
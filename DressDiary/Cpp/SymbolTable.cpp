@@ -0,0 +1,63 @@
+#include "SymbolTable.hpp"
+#include "Utilities.hpp"
+#include <stdexcept>
+
+SymbolTable::SymbolTable()
+{
+    // ordinea trebuie sa corespunda constantelor din namespace-ul symbols
+    for (const char *value : {"", "pants", "jacket", "top", "shoes", "primavara", "vara", "toamna", "iarna"})
+        intern(value);
+}
+
+SymbolTable::~SymbolTable()
+{
+    for (auto &chunk : chunks_)
+        delete[] chunk.load();
+}
+
+Symbol SymbolTable::insertLocked(std::string_view value)
+{
+    auto it = lookup_.find(value);
+    if (it != lookup_.end())
+        return it->second;
+
+    // forma cu litere mici se interneaza inainte, ca intrarea sa fie completa cand o publicam
+    const std::string lower = toLowerAscii(std::string(value));
+    const Symbol folded = lower != value ? insertLocked(lower) : size_.load(std::memory_order_relaxed);
+
+    const Symbol id = size_.load(std::memory_order_relaxed);
+    const std::size_t chunk = id >> ChunkBits;
+    if (chunk >= MaxChunks)
+        throw std::length_error("SymbolTable is full");
+    if (!chunks_[chunk].load(std::memory_order_relaxed))
+        chunks_[chunk].store(new Entry[ChunkSize], std::memory_order_release);
+
+    Entry &e = chunks_[chunk].load(std::memory_order_relaxed)[id & (ChunkSize - 1)];
+    e.text.assign(value);
+    e.folded = folded;
+    lookup_.emplace(e.text, id);
+    // publicam intrarea abia dupa ce este completa
+    size_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+Symbol SymbolTable::intern(std::string_view value)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = lookup_.find(value);
+        if (it != lookup_.end())
+            return it->second;
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return insertLocked(value);
+}
+
+std::optional<Symbol> SymbolTable::find(std::string_view value) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = lookup_.find(value);
+    if (it == lookup_.end())
+        return std::nullopt;
+    return it->second;
+}
@@ -0,0 +1,183 @@
+#include "SyntheticWardrobe.hpp"
+#include "DataManager.hpp"
+#include "ItemFactory.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+    // splitmix64: secventa identica pe orice compilator / biblioteca standard
+    class Rng
+    {
+        std::uint64_t state_;
+
+    public:
+        explicit Rng(std::uint64_t seed) : state_(seed) {}
+
+        std::uint64_t next()
+        {
+            std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // in [0, 1)
+        double unit() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+        // in [low, high]
+        std::size_t range(std::size_t low, std::size_t high)
+        {
+            return high <= low ? low : low + static_cast<std::size_t>(next() % (high - low + 1));
+        }
+    };
+
+    // valorile internate o singura data, cu ponderile cumulate pentru extragere
+    class Distribution
+    {
+        std::vector<Symbol> values_;
+        std::vector<double> cumulative_;
+
+    public:
+        explicit Distribution(const std::vector<SyntheticWardrobe::Weighted> &weighted)
+        {
+            double total = 0.0;
+            for (const auto &w : weighted)
+            {
+                if (w.weight <= 0.0)
+                    continue;
+                total += w.weight;
+                values_.push_back(SymbolTable::getInstance().intern(w.value));
+                cumulative_.push_back(total);
+            }
+        }
+
+        bool empty() const { return values_.empty(); }
+        std::size_t size() const { return values_.size(); }
+
+        Symbol sample(Rng &rng) const
+        {
+            if (values_.empty())
+                return symbols::Empty;
+            double target = rng.unit() * cumulative_.back();
+            auto it = std::upper_bound(cumulative_.begin(), cumulative_.end(), target);
+            return values_[std::min<std::size_t>(it - cumulative_.begin(), values_.size() - 1)];
+        }
+    };
+
+    ItemPayload makePayload(Symbol category, Rng &rng)
+    {
+        static const Distribution waists({{"S", 1}, {"M", 2}, {"L", 1}});
+        static const Distribution sleeves({{"scurta", 2}, {"lunga", 2}, {"fara", 1}});
+        static const Distribution necklines({{"rotund", 3}, {"V", 2}, {"guler", 1}});
+
+        ItemPayload payload = defaultPayload(category);
+        std::visit(overloaded{
+                       [](std::monostate) {},
+                       [&](PantsData &pants)
+                       {
+                           pants.lungime = 90.0f + static_cast<float>(rng.range(0, 200)) / 10.0f;
+                           pants.talie = waists.sample(rng);
+                       },
+                       [&](TopData &top)
+                       {
+                           top.maneca = sleeves.sample(rng);
+                           top.decolteu = necklines.sample(rng);
+                       },
+                       [&](JacketData &jacket) { jacket.waterproof = rng.unit() < 0.4; },
+                       [&](ShoesData &shoes) { shoes.size = static_cast<float>(rng.range(36, 46)); }},
+                   payload);
+        return payload;
+    }
+}
+
+SyntheticWardrobe::Wardrobe SyntheticWardrobe::generate(const Config &config)
+{
+    Rng rng(config.seed);
+    const Distribution categories(config.categories);
+    const Distribution colors(config.colors);
+    const Distribution materials(config.materials);
+    const Distribution seasons(config.seasons);
+
+    Wardrobe wardrobe;
+    wardrobe.items.reserve(config.itemCount);
+    for (std::size_t i = 0; i < config.itemCount; ++i)
+    {
+        ItemRecord item;
+        item.id = config.firstItemId + static_cast<int>(i);
+        item.category = categories.sample(rng);
+        item.color = colors.sample(rng);
+
+        std::size_t materialCount = rng.range(config.minMaterials, std::min(config.maxMaterials, materials.size()));
+        std::vector<Symbol> picked;
+        for (std::size_t attempt = 0; picked.size() < materialCount && attempt < materialCount * 4; ++attempt)
+        {
+            Symbol material = materials.sample(rng);
+            if (std::find(picked.begin(), picked.end(), material) == picked.end())
+                picked.push_back(material);
+        }
+        item.materials = MaterialSet(picked);
+        item.payload = makePayload(item.category, rng);
+
+        if (config.imageBytes > 0)
+        {
+            std::vector<std::uint8_t> bytes(config.imageBytes);
+            for (std::size_t b = 0; b < bytes.size(); b += 8)
+            {
+                std::uint64_t word = rng.next();
+                for (std::size_t k = 0; k < 8 && b + k < bytes.size(); ++k)
+                    bytes[b + k] = static_cast<std::uint8_t>(word >> (8 * k));
+            }
+            item.image = ImageBlob(std::move(bytes));
+        }
+        wardrobe.items.push_back(std::move(item));
+    }
+
+    wardrobe.outfits.reserve(config.outfitCount);
+    for (std::size_t i = 0; i < config.outfitCount; ++i)
+    {
+        std::vector<int> itemIds;
+        if (!wardrobe.items.empty())
+        {
+            std::size_t count = rng.range(config.minItemsPerOutfit, config.maxItemsPerOutfit);
+            for (std::size_t k = 0; k < count; ++k)
+                itemIds.push_back(wardrobe.items[rng.range(0, wardrobe.items.size() - 1)].id);
+        }
+        int offset = config.dateSpanDays > 0 ? static_cast<int>(rng.range(0, config.dateSpanDays - 1)) : 0;
+        Date dateAdded = config.lastDate - offset;
+        std::string season = SymbolTable::getInstance().name(seasons.sample(rng));
+
+        wardrobe.outfits.push_back(ItemFactory::createOutfit(
+            "synthetic-" + std::to_string(config.seed) + "-" + std::to_string(i),
+            "Outfit " + std::to_string(i + 1), dateAdded, season, {}, itemIds));
+    }
+    return wardrobe;
+}
+
+bool SyntheticWardrobe::populate(DataManager &manager, const std::string &username, const Wardrobe &wardrobe)
+{
+    // id-urile noi vin din generatorul backend-ului, ca sa nu se suprapuna cu articolele existente
+    std::unordered_map<int, int> idMap;
+    std::vector<ItemRecord> items = wardrobe.items;
+    for (auto &item : items)
+    {
+        int id = manager.generateNextClothingItemId();
+        idMap[item.id] = id;
+        item.id = id;
+    }
+    if (!manager.saveClothingItems(username, std::span<const ItemRecord>(items)))
+        return false;
+
+    for (const auto &outfit : wardrobe.outfits)
+    {
+        std::vector<int> itemIds;
+        itemIds.reserve(outfit->getItemIds().size());
+        for (int id : outfit->getItemIds())
+            itemIds.push_back(idMap.count(id) ? idMap[id] : id);
+        auto stored = ItemFactory::createOutfit(manager.generateNextOutfitId(), outfit->getName(), outfit->getDateAdded(),
+                                                outfit->getSeason(), {}, itemIds);
+        if (!manager.saveOutfit(username, *stored))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,137 @@
+#include "WardrobeIndex.hpp"
+#include "Utilities.hpp"
+
+void WardrobeIndex::add(Postings &postings, Symbol value, std::size_t slot)
+{
+    value = SymbolTable::getInstance().fold(value);
+    if (value >= postings.size())
+        postings.resize(value + 1);
+    postings[value].set(slot);
+}
+
+void WardrobeIndex::remove(Postings &postings, Symbol value, std::size_t slot)
+{
+    value = SymbolTable::getInstance().fold(value);
+    if (value < postings.size())
+        postings[value].reset(slot);
+}
+
+Bitset WardrobeIndex::anyOf(const Postings &postings, const std::vector<Symbol> &values, std::size_t size)
+{
+    const auto &table = SymbolTable::getInstance();
+    Bitset result(size);
+    for (Symbol value : values)
+    {
+        // fold() ar duce un id necunoscut in symbols::Empty, adica in articolele fara valoare
+        if (value >= table.size())
+            continue;
+        value = table.fold(value);
+        if (value < postings.size())
+            result |= postings[value];
+    }
+    return result;
+}
+
+std::vector<Symbol> WardrobeIndex::toSymbols(const std::vector<std::string> &values)
+{
+    std::vector<Symbol> symbols;
+    symbols.reserve(values.size());
+    for (const auto &value : values)
+    {
+        auto symbol = SymbolTable::getInstance().find(toLowerAscii(value));
+        symbols.push_back(symbol ? *symbol : Unknown);
+    }
+    return symbols;
+}
+
+// articole
+
+void WardrobeIndex::insertItem(std::size_t slot, const ItemRecord &item)
+{
+    add(colors_, item.color, slot);
+    add(categories_, item.category, slot);
+    for (Symbol m : item.materials)
+        add(materials_, m, slot);
+    liveItems_.set(slot);
+}
+
+void WardrobeIndex::eraseItem(std::size_t slot, const ItemRecord &item)
+{
+    remove(colors_, item.color, slot);
+    remove(categories_, item.category, slot);
+    for (Symbol m : item.materials)
+        remove(materials_, m, slot);
+    liveItems_.reset(slot);
+}
+
+void WardrobeIndex::moveItem(std::size_t from, std::size_t to, const ItemRecord &item)
+{
+    eraseItem(from, item);
+    insertItem(to, item);
+}
+
+// outfit-uri
+
+void WardrobeIndex::insertOutfit(std::size_t slot, const Outfit &outfit)
+{
+    add(seasons_, outfit.getSeasonId(), slot);
+    liveOutfits_.set(slot);
+}
+
+void WardrobeIndex::eraseOutfit(std::size_t slot, const Outfit &outfit)
+{
+    remove(seasons_, outfit.getSeasonId(), slot);
+    liveOutfits_.reset(slot);
+}
+
+void WardrobeIndex::moveOutfit(std::size_t from, std::size_t to, const Outfit &outfit)
+{
+    eraseOutfit(from, outfit);
+    insertOutfit(to, outfit);
+}
+
+void WardrobeIndex::clear()
+{
+    colors_.clear();
+    materials_.clear();
+    categories_.clear();
+    seasons_.clear();
+    liveItems_ = Bitset();
+    liveOutfits_ = Bitset();
+}
+
+// interogari
+
+Bitset WardrobeIndex::query(const std::vector<std::string> &colors,
+                            const std::vector<std::string> &materials,
+                            const std::vector<std::string> &categories) const
+{
+    return query(toSymbols(colors), toSymbols(materials), toSymbols(categories));
+}
+
+Bitset WardrobeIndex::queryOutfits(const std::vector<std::string> &seasons) const
+{
+    return queryOutfits(toSymbols(seasons));
+}
+
+Bitset WardrobeIndex::query(const std::vector<Symbol> &colors,
+                            const std::vector<Symbol> &materials,
+                            const std::vector<Symbol> &categories) const
+{
+    Bitset result = liveItems_;
+    if (!colors.empty())
+        result &= anyOf(colors_, colors, liveItems_.size());
+    if (!materials.empty())
+        result &= anyOf(materials_, materials, liveItems_.size());
+    if (!categories.empty())
+        result &= anyOf(categories_, categories, liveItems_.size());
+    return result;
+}
+
+Bitset WardrobeIndex::queryOutfits(const std::vector<Symbol> &seasons) const
+{
+    Bitset result = liveOutfits_;
+    if (!seasons.empty())
+        result &= anyOf(seasons_, seasons, liveOutfits_.size());
+    return result;
+}
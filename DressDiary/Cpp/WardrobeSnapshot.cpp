@@ -0,0 +1,428 @@
+#include "WardrobeSnapshot.hpp"
+#include "ItemFactory.hpp"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr char Magic[8] = {'D', 'D', 'S', 'N', 'A', 'P', '\r', '\n'};
+    constexpr std::size_t ChecksumStart = offsetof(WardrobeSnapshot::Header, revision);
+
+    std::size_t align8(std::size_t n) { return (n + 7) & ~std::size_t(7); }
+
+    // valori distincte -> index, in ordinea primei aparitii
+    class StringPool
+    {
+        std::vector<std::string_view> values_;
+        std::unordered_map<std::string_view, std::uint32_t> index_;
+
+    public:
+        std::uint32_t add(std::string_view value)
+        {
+            auto [it, inserted] = index_.try_emplace(value, static_cast<std::uint32_t>(values_.size()));
+            if (inserted)
+                values_.push_back(value);
+            return it->second;
+        }
+
+        std::size_t size() const { return values_.size(); }
+
+        std::vector<std::uint32_t> offsets() const
+        {
+            std::vector<std::uint32_t> result;
+            result.reserve(values_.size() + 1);
+            std::uint32_t at = 0;
+            result.push_back(at);
+            for (auto value : values_)
+                result.push_back(at += static_cast<std::uint32_t>(value.size()));
+            return result;
+        }
+
+        std::string bytes() const
+        {
+            std::string result;
+            for (auto value : values_)
+                result.append(value);
+            return result;
+        }
+    };
+
+    class SectionWriter
+    {
+        std::vector<std::uint8_t> &out;
+        WardrobeSnapshot::Header &header;
+
+    public:
+        SectionWriter(std::vector<std::uint8_t> &out_, WardrobeSnapshot::Header &header_) : out(out_), header(header_) {}
+
+        template <typename T>
+        void write(WardrobeSnapshot::Section section, std::span<const T> values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            out.resize(align8(out.size()));
+            header.sections[static_cast<std::size_t>(section)] = {out.size(), values.size()};
+            const auto *begin = reinterpret_cast<const std::uint8_t *>(values.data());
+            out.insert(out.end(), begin, begin + values.size_bytes());
+        }
+
+        void write(WardrobeSnapshot::Section section, std::string_view bytes)
+        {
+            write(section, std::span<const char>(bytes.data(), bytes.size()));
+        }
+    };
+}
+
+std::uint64_t WardrobeSnapshot::checksum(std::span<const std::uint8_t> bytes)
+{
+    // FNV-1a pe cuvinte de 64 de biti (coada pe bytes), cu amestec final
+    std::uint64_t h = 0xCBF29CE484222325ull;
+    std::size_t i = 0;
+    for (; i + 8 <= bytes.size(); i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes.data() + i, sizeof(word));
+        h = (h ^ word) * 0x100000001B3ull;
+    }
+    for (; i < bytes.size(); ++i)
+        h = (h ^ bytes[i]) * 0x100000001B3ull;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+}
+
+std::string WardrobeSnapshot::fileName(const std::string &username)
+{
+    static const char hex[] = "0123456789abcdef";
+    std::string name;
+    for (unsigned char c : username)
+    {
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+            name.push_back(static_cast<char>(c));
+        else
+        {
+            name.push_back('%');
+            name.push_back(hex[c >> 4]);
+            name.push_back(hex[c & 15]);
+        }
+    }
+    return name + ".ddsnap";
+}
+
+// scriere
+
+std::vector<std::uint8_t> WardrobeSnapshot::encode(const Contents &contents)
+{
+    const SymbolTable &table = SymbolTable::getInstance();
+    StringPool symbols, texts;
+    const auto symbolOf = [&](Symbol s) { return symbols.add(table.name(s)); };
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.headerSize = sizeof(Header);
+    header.revision = contents.revision;
+    header.username = texts.add(contents.username);
+    header.flags = contents.embedImages ? static_cast<std::uint32_t>(AllImagesEmbedded) : 0;
+
+    std::vector<ItemEntry> items;
+    std::vector<std::uint32_t> materials;
+    std::vector<const ImageBlob *> images;
+    std::uint64_t imageBytes = 0;
+    items.reserve(contents.items.size());
+    for (const ItemRecord &item : contents.items)
+    {
+        ItemEntry entry{};
+        entry.id = item.id;
+        entry.color = symbolOf(item.color);
+        entry.category = symbolOf(item.category);
+        entry.materialsBegin = static_cast<std::uint32_t>(materials.size());
+        entry.materialsCount = static_cast<std::uint32_t>(item.materials.size());
+        for (Symbol m : item.materials)
+            materials.push_back(symbolOf(m));
+        entry.pantWaist = entry.topSleeveType = entry.topNeckline = NoString;
+        entry.kind = static_cast<std::uint8_t>(item.payload.index());
+        std::visit(overloaded{
+                       [](std::monostate) {},
+                       [&](const PantsData &p)
+                       {
+                           entry.pantLength = p.lungime;
+                           entry.pantWaist = symbolOf(p.talie);
+                       },
+                       [&](const TopData &t)
+                       {
+                           entry.topSleeveType = symbolOf(t.maneca);
+                           entry.topNeckline = symbolOf(t.decolteu);
+                       },
+                       [&](const JacketData &j) { entry.jacketWaterproof = j.waterproof ? 1 : 0; },
+                       [&](const ShoesData &s) { entry.shoeSize = s.size; },
+                   },
+                   item.payload);
+
+        const std::string &key = item.image.key();
+        entry.imageKey = key.empty() ? NoString : texts.add(key);
+        // imaginile fara cheie n-au alta sursa la citire, deci intra in fisier
+        if ((contents.embedImages || key.empty()) && item.image.hasSource() && !item.image.empty())
+        {
+            entry.imageOffset = imageBytes;
+            entry.imageSize = item.image.size();
+            imageBytes += align8(entry.imageSize);
+            images.push_back(&item.image);
+        }
+        items.push_back(entry);
+    }
+
+    std::vector<OutfitEntry> outfits;
+    std::vector<std::int32_t> outfitItems;
+    std::vector<PlacementEntry> placements;
+    outfits.reserve(contents.outfits.size());
+    for (const auto &outfit : contents.outfits)
+    {
+        OutfitEntry entry{};
+        entry.id = texts.add(outfit->getId());
+        entry.name = texts.add(outfit->getName());
+        entry.season = symbolOf(outfit->getSeasonId());
+        entry.dateAdded = outfit->getDateAdded().dayNumber();
+        entry.itemsBegin = static_cast<std::uint32_t>(outfitItems.size());
+        entry.itemsCount = static_cast<std::uint32_t>(outfit->getItemIds().size());
+        outfitItems.insert(outfitItems.end(), outfit->getItemIds().begin(), outfit->getItemIds().end());
+        entry.layoutBegin = static_cast<std::uint32_t>(placements.size());
+        entry.layoutCount = static_cast<std::uint32_t>(outfit->getLayout().size());
+        for (const auto &p : outfit->getLayout())
+            placements.push_back(PlacementEntry{p.itemId, 0, p.normalizedX, p.normalizedY});
+        outfits.push_back(entry);
+    }
+
+    const std::vector<std::uint32_t> symbolOffsets = symbols.offsets();
+    const std::vector<std::uint32_t> textOffsets = texts.offsets();
+
+    std::vector<std::uint8_t> out(sizeof(Header));
+    SectionWriter w(out, header);
+    w.write<ItemEntry>(Section::Items, items);
+    w.write<std::uint32_t>(Section::Materials, materials);
+    w.write<OutfitEntry>(Section::Outfits, outfits);
+    w.write<std::int32_t>(Section::OutfitItems, outfitItems);
+    w.write<PlacementEntry>(Section::Placements, placements);
+    w.write<WearRecord>(Section::Wears, contents.wears);
+    w.write<std::uint32_t>(Section::Symbols, symbolOffsets);
+    w.write(Section::SymbolBytes, symbols.bytes());
+    w.write<std::uint32_t>(Section::Texts, textOffsets);
+    w.write(Section::TextBytes, texts.bytes());
+
+    // imaginile se copiaza direct la locul lor
+    out.resize(align8(out.size()));
+    header.sections[static_cast<std::size_t>(Section::ImageBytes)] = {out.size(), imageBytes};
+    const std::size_t imagesAt = out.size();
+    out.resize(imagesAt + imageBytes);
+    std::size_t next = 0;
+    for (const ItemEntry &entry : items)
+        if (entry.imageSize > 0)
+        {
+            const ImageBlob &image = *images[next++];
+            std::memcpy(out.data() + imagesAt + entry.imageOffset, image.data(), entry.imageSize);
+        }
+
+    header.fileSize = out.size();
+    std::memcpy(out.data(), &header, sizeof(Header));
+    header.checksum = checksum(std::span<const std::uint8_t>(out).subspan(ChecksumStart));
+    std::memcpy(out.data(), &header, sizeof(Header));
+    return out;
+}
+
+bool WardrobeSnapshot::writeFile(const std::string &path, std::span<const std::uint8_t> bytes)
+{
+    std::error_code ec;
+    const fs::path target(path);
+    fs::create_directories(target.parent_path(), ec);
+    const std::string tmp = path + ".tmp";
+
+    // continutul ajunge pe disc inainte de rename: dupa o cadere ramane fie fisierul vechi,
+    // fie cel nou complet, niciodata un nume nou peste date lipsa
+    const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return false;
+    bool ok = true;
+    for (std::size_t done = 0; ok && done < bytes.size();)
+    {
+        const ssize_t n = ::write(fd, bytes.data() + done, bytes.size() - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        ok = n > 0;
+        done += ok ? static_cast<std::size_t>(n) : 0;
+    }
+    ok = ok && ::fsync(fd) == 0;
+    ok = ::close(fd) == 0 && ok;
+    if (!ok)
+    {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    fs::rename(tmp, path, ec);
+    if (ec)
+        return false;
+
+    // si rename-ul insusi (intrarea din director)
+    const fs::path dir = target.has_parent_path() ? target.parent_path() : fs::path(".");
+    const int dirFd = ::open(dir.c_str(), O_RDONLY | O_CLOEXEC);
+    if (dirFd < 0)
+        return false;
+    ok = ::fsync(dirFd) == 0;
+    ::close(dirFd);
+    return ok;
+}
+
+// citire
+
+std::optional<WardrobeSnapshot> WardrobeSnapshot::open(const std::string &path)
+{
+    return validated(ImageBlob::mapFile(path));
+}
+
+std::optional<WardrobeSnapshot> WardrobeSnapshot::fromBytes(std::vector<std::uint8_t> bytes)
+{
+    return validated(ImageBlob(std::move(bytes)));
+}
+
+std::optional<WardrobeSnapshot> WardrobeSnapshot::validated(ImageBlob bytes)
+{
+    const std::span<const std::uint8_t> data = bytes.bytes();
+    if (data.size() < sizeof(Header) || reinterpret_cast<std::uintptr_t>(data.data()) % 8 != 0)
+        return std::nullopt;
+    Header header;
+    std::memcpy(&header, data.data(), sizeof(Header));
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version ||
+        header.headerSize != sizeof(Header) || header.fileSize != data.size())
+        return std::nullopt;
+    if (header.checksum != checksum(data.subspan(ChecksumStart)))
+        return std::nullopt;
+
+    // fiecare sectiune trebuie sa fie aliniata si in fisier
+    constexpr std::size_t elementSize[] = {sizeof(ItemEntry), 4, sizeof(OutfitEntry), 4, sizeof(PlacementEntry),
+                                           sizeof(WearRecord), 4, 1, 4, 1, 1};
+    static_assert(std::size(elementSize) == static_cast<std::size_t>(Section::Count));
+    for (std::size_t s = 0; s < static_cast<std::size_t>(Section::Count); ++s)
+    {
+        const SectionRange &range = header.sections[s];
+        if (range.offset % 8 != 0 || range.offset < sizeof(Header) || range.offset > data.size() ||
+            range.count > (data.size() - range.offset) / elementSize[s])
+            return std::nullopt;
+    }
+
+    // offset-urile string-urilor: crescatoare si in pool (o data pe fisier, nu per record)
+    WardrobeSnapshot snapshot(std::move(bytes));
+    for (auto [offsets, pool] : {std::pair{Section::Symbols, Section::SymbolBytes}, std::pair{Section::Texts, Section::TextBytes}})
+    {
+        auto values = snapshot.section<std::uint32_t>(offsets);
+        if (values.empty() || values.front() != 0)
+            return std::nullopt;
+        for (std::size_t i = 1; i < values.size(); ++i)
+            if (values[i] < values[i - 1])
+                return std::nullopt;
+        if (values.back() > header.sections[static_cast<std::size_t>(pool)].count)
+            return std::nullopt;
+    }
+    return snapshot;
+}
+
+std::string_view WardrobeSnapshot::string(Section offsets, Section bytes, std::uint32_t index) const
+{
+    auto values = section<std::uint32_t>(offsets);
+    if (index == NoString || index + 1 >= values.size())
+        return {};
+    auto pool = section<char>(bytes);
+    return std::string_view(pool.data() + values[index], values[index + 1] - values[index]);
+}
+
+std::vector<ItemRecord> WardrobeSnapshot::items(const BlobStore *blobs) const
+{
+    auto entries = itemEntries();
+    auto materials = section<std::uint32_t>(Section::Materials);
+    auto images = section<std::uint8_t>(Section::ImageBytes);
+
+    // fiecare simbol se interneaza o singura data
+    SymbolTable &table = SymbolTable::getInstance();
+    std::vector<Symbol> symbols(section<std::uint32_t>(Section::Symbols).size() - 1);
+    for (std::size_t i = 0; i < symbols.size(); ++i)
+        symbols[i] = table.intern(symbol(static_cast<std::uint32_t>(i)));
+    const auto symbolAt = [&](std::uint32_t index) { return index < symbols.size() ? symbols[index] : symbols::Empty; };
+
+    // imaginile incluse tin in viata maparea
+    auto owner = std::make_shared<const ImageBlob>(bytes_);
+
+    std::vector<ItemRecord> result;
+    result.reserve(entries.size());
+    for (const ItemEntry &entry : entries)
+    {
+        ItemRecord item;
+        item.id = entry.id;
+        item.color = symbolAt(entry.color);
+        item.category = symbolAt(entry.category);
+        if (entry.materialsBegin <= materials.size() && entry.materialsCount <= materials.size() - entry.materialsBegin)
+            for (std::uint32_t m : materials.subspan(entry.materialsBegin, entry.materialsCount))
+                item.materials.push_back(symbolAt(m));
+
+        switch (entry.kind)
+        {
+        case 1:
+            item.payload = PantsData{entry.pantLength, symbolAt(entry.pantWaist)};
+            break;
+        case 2:
+            item.payload = TopData{symbolAt(entry.topSleeveType), symbolAt(entry.topNeckline)};
+            break;
+        case 3:
+            item.payload = JacketData{entry.jacketWaterproof != 0};
+            break;
+        case 4:
+            item.payload = ShoesData{entry.shoeSize};
+            break;
+        default:
+            item.payload = std::monostate{};
+            break;
+        }
+        static_assert(std::is_same_v<std::variant_alternative_t<4, ItemPayload>, ShoesData>);
+
+        // cheia din depozit daca exista acolo; altfel imaginea inclusa (din mapare, fara copiere)
+        const std::string_view key = text(entry.imageKey);
+        if (!key.empty() && blobs && blobs->contains(std::string(key)))
+            item.image = blobs->open(std::string(key));
+        else if (entry.imageSize > 0 && entry.imageOffset <= images.size() && entry.imageSize <= images.size() - entry.imageOffset)
+            item.image = ImageBlob::wrap(images.data() + entry.imageOffset, entry.imageSize, owner);
+        result.push_back(std::move(item));
+    }
+    return result;
+}
+
+std::vector<std::shared_ptr<Outfit>> WardrobeSnapshot::outfits() const
+{
+    auto entries = outfitEntries();
+    auto itemIds = section<std::int32_t>(Section::OutfitItems);
+    auto placements = section<PlacementEntry>(Section::Placements);
+
+    std::vector<std::shared_ptr<Outfit>> result;
+    result.reserve(entries.size());
+    std::vector<int> ids;
+    std::vector<OutfitItemPlacement> layout;
+    for (const OutfitEntry &entry : entries)
+    {
+        ids.clear();
+        layout.clear();
+        if (entry.itemsBegin <= itemIds.size() && entry.itemsCount <= itemIds.size() - entry.itemsBegin)
+        {
+            auto range = itemIds.subspan(entry.itemsBegin, entry.itemsCount);
+            ids.assign(range.begin(), range.end());
+        }
+        if (entry.layoutBegin <= placements.size() && entry.layoutCount <= placements.size() - entry.layoutBegin)
+            for (const PlacementEntry &p : placements.subspan(entry.layoutBegin, entry.layoutCount))
+                layout.push_back(OutfitItemPlacement{p.itemId, p.normalizedX, p.normalizedY});
+        result.push_back(ItemFactory::createOutfit(std::string(text(entry.id)), std::string(text(entry.name)),
+                                                   Date::fromDayNumber(entry.dateAdded), std::string(symbol(entry.season)),
+                                                   {}, ids, layout));
+    }
+    return result;
+}
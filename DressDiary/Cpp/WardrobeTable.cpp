@@ -0,0 +1,225 @@
+#include "WardrobeTable.hpp"
+#include <algorithm>
+
+WardrobeTable WardrobeTable::fromItems(const std::vector<std::shared_ptr<ClothingItem>> &items)
+{
+    WardrobeTable table;
+    table.reserve(items.size());
+    for (const auto &item : items)
+        if (item)
+            table.push(item->toRecord());
+    return table;
+}
+
+void WardrobeTable::clear()
+{
+    ids_.clear();
+    colors_.clear();
+    categories_.clear();
+    materialMasks_.clear();
+    images_.clear();
+    materialBits_.clear();
+    materialSymbols_.clear();
+}
+
+void WardrobeTable::reserve(std::size_t n)
+{
+    ids_.reserve(n);
+    colors_.reserve(n);
+    categories_.reserve(n);
+    for (auto &column : materialMasks_)
+        column.reserve(n);
+    images_.reserve(n);
+}
+
+// materiale
+
+WardrobeTable::MaterialBit WardrobeTable::materialBit(Symbol material)
+{
+    material = SymbolTable::getInstance().fold(material);
+    if (material < materialBits_.size() && materialBits_[material].mask)
+        return materialBits_[material];
+
+    const std::size_t index = materialSymbols_.size();
+    MaterialBit bit;
+    bit.column = static_cast<std::uint32_t>(index / 64);
+    bit.mask = std::uint64_t(1) << (index % 64);
+    if (bit.column >= materialMasks_.size())
+        materialMasks_.emplace_back(ids_.size(), 0);
+
+    if (material >= materialBits_.size())
+        materialBits_.resize(material + 1);
+    materialBits_[material] = bit;
+    materialSymbols_.push_back(material);
+    return bit;
+}
+
+const WardrobeTable::MaterialBit *WardrobeTable::findMaterialBit(Symbol material) const
+{
+    material = SymbolTable::getInstance().fold(material);
+    if (material >= materialBits_.size() || !materialBits_[material].mask)
+        return nullptr;
+    return &materialBits_[material];
+}
+
+void WardrobeTable::writeMaterials(std::size_t slot, const MaterialSet &materials)
+{
+    for (auto &column : materialMasks_)
+        column[slot] = 0;
+    for (Symbol m : materials)
+    {
+        MaterialBit bit = materialBit(m);
+        materialMasks_[bit.column][slot] |= bit.mask;
+    }
+}
+
+// sincronizare
+
+void WardrobeTable::push(const ItemRecord &item)
+{
+    const auto &table = SymbolTable::getInstance();
+    ids_.push_back(item.id);
+    colors_.push_back(table.fold(item.color));
+    categories_.push_back(table.fold(item.category));
+    for (auto &column : materialMasks_)
+        column.push_back(0);
+    images_.push_back(item.image);
+    writeMaterials(ids_.size() - 1, item.materials);
+}
+
+void WardrobeTable::set(std::size_t slot, const ItemRecord &item)
+{
+    const auto &table = SymbolTable::getInstance();
+    ids_[slot] = item.id;
+    colors_[slot] = table.fold(item.color);
+    categories_[slot] = table.fold(item.category);
+    images_[slot] = item.image;
+    writeMaterials(slot, item.materials);
+}
+
+void WardrobeTable::swapRemove(std::size_t slot)
+{
+    const std::size_t last = ids_.size() - 1;
+    if (slot != last)
+    {
+        ids_[slot] = ids_[last];
+        colors_[slot] = colors_[last];
+        categories_[slot] = categories_[last];
+        for (auto &column : materialMasks_)
+            column[slot] = column[last];
+        images_[slot] = std::move(images_[last]);
+    }
+    ids_.pop_back();
+    colors_.pop_back();
+    categories_.pop_back();
+    for (auto &column : materialMasks_)
+        column.pop_back();
+    images_.pop_back();
+}
+
+// scanari
+
+std::size_t WardrobeTable::count(Symbol color, Symbol category) const
+{
+    const auto &table = SymbolTable::getInstance();
+    color = table.fold(color);
+    category = table.fold(category);
+
+    const std::size_t n = ids_.size();
+    const Symbol *colors = colors_.data();
+    const Symbol *categories = categories_.data();
+    std::size_t hits = 0;
+
+    if (color != symbols::Empty && category != symbols::Empty)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            hits += static_cast<std::size_t>((colors[i] == color) & (categories[i] == category));
+    }
+    else if (color != symbols::Empty)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            hits += static_cast<std::size_t>(colors[i] == color);
+    }
+    else if (category != symbols::Empty)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            hits += static_cast<std::size_t>(categories[i] == category);
+    }
+    else
+        hits = n;
+    return hits;
+}
+
+std::size_t WardrobeTable::countMaterial(Symbol material) const
+{
+    const MaterialBit *bit = findMaterialBit(material);
+    if (!bit)
+        return 0;
+
+    const std::uint64_t *masks = materialMasks_[bit->column].data();
+    const std::uint64_t mask = bit->mask;
+    std::size_t hits = 0;
+    for (std::size_t i = 0, n = ids_.size(); i < n; ++i)
+        hits += static_cast<std::size_t>((masks[i] & mask) != 0);
+    return hits;
+}
+
+std::vector<int> WardrobeTable::selectIds(Symbol color, Symbol category) const
+{
+    const auto &table = SymbolTable::getInstance();
+    color = table.fold(color);
+    category = table.fold(category);
+
+    std::vector<int> result;
+    result.reserve(count(color, category));
+    for (std::size_t i = 0, n = ids_.size(); i < n; ++i)
+        if ((color == symbols::Empty || colors_[i] == color) &&
+            (category == symbols::Empty || categories_[i] == category))
+            result.push_back(ids_[i]);
+    return result;
+}
+
+// histograme
+
+std::vector<std::pair<Symbol, std::size_t>> WardrobeTable::histogram(const std::vector<Symbol> &column)
+{
+    std::vector<std::pair<Symbol, std::size_t>> result;
+    if (column.empty())
+        return result;
+
+    // simbolurile sunt dense, deci numaram direct intr-un vector
+    std::vector<std::size_t> counts(*std::max_element(column.begin(), column.end()) + 1, 0);
+    for (Symbol value : column)
+        ++counts[value];
+
+    for (std::size_t value = 0; value < counts.size(); ++value)
+        if (counts[value])
+            result.emplace_back(static_cast<Symbol>(value), counts[value]);
+    std::stable_sort(result.begin(), result.end(),
+                     [](const auto &a, const auto &b) { return a.second > b.second; });
+    return result;
+}
+
+std::vector<std::pair<Symbol, std::size_t>> WardrobeTable::colorHistogram() const
+{
+    return histogram(colors_);
+}
+
+std::vector<std::pair<Symbol, std::size_t>> WardrobeTable::categoryHistogram() const
+{
+    return histogram(categories_);
+}
+
+std::vector<std::pair<Symbol, std::size_t>> WardrobeTable::materialHistogram() const
+{
+    std::vector<std::pair<Symbol, std::size_t>> result;
+    for (Symbol material : materialSymbols_)
+    {
+        const std::size_t hits = countMaterial(material);
+        if (hits)
+            result.emplace_back(material, hits);
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const auto &a, const auto &b) { return a.second > b.second; });
+    return result;
+}
@@ -0,0 +1,309 @@
+#include "WearLog.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <unistd.h>
+
+std::uint64_t WearLog::outfitKey(std::string_view outfitId)
+{
+    std::uint64_t h = 0xCBF29CE484222325ull;
+    for (char c : outfitId)
+    {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001B3ull;
+    }
+    return h == WearRecord::NoOutfit ? 1 : h;
+}
+
+std::vector<WearRecord> WearLog::forOutfit(Date day, const Outfit &outfit)
+{
+    const std::uint64_t key = outfitKey(outfit.getId());
+    const auto &itemSet = outfit.getItemSet();
+    std::vector<WearRecord> records;
+    records.reserve(itemSet.size() + 1);
+    records.push_back(WearRecord{day.dayNumber(), WearRecord::NoItem, key});
+    for (std::size_t i = 0; i < itemSet.size(); ++i)
+        if (i == 0 || itemSet[i] != itemSet[i - 1])
+            records.push_back(WearRecord{day.dayNumber(), itemSet[i], key});
+    return records;
+}
+
+WearRecord WearLog::forItem(Date day, int itemId)
+{
+    return WearRecord{day.dayNumber(), itemId, WearRecord::NoOutfit};
+}
+
+// fisier
+
+namespace
+{
+    constexpr std::size_t RecordBytes = 16;
+
+    void encode(const WearRecord &record, std::uint8_t *out)
+    {
+        const auto day = static_cast<std::uint32_t>(record.day);
+        const auto itemId = static_cast<std::uint32_t>(record.itemId);
+        for (int i = 0; i < 4; ++i)
+        {
+            out[i] = static_cast<std::uint8_t>(day >> (8 * i));
+            out[4 + i] = static_cast<std::uint8_t>(itemId >> (8 * i));
+        }
+        for (int i = 0; i < 8; ++i)
+            out[8 + i] = static_cast<std::uint8_t>(record.outfitKey >> (8 * i));
+    }
+
+    WearRecord decode(const std::uint8_t *in)
+    {
+        std::uint32_t day = 0, itemId = 0;
+        std::uint64_t key = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            day |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+            itemId |= static_cast<std::uint32_t>(in[4 + i]) << (8 * i);
+        }
+        for (int i = 0; i < 8; ++i)
+            key |= static_cast<std::uint64_t>(in[8 + i]) << (8 * i);
+        return WearRecord{static_cast<std::int32_t>(day), static_cast<std::int32_t>(itemId), key};
+    }
+}
+
+bool WearLog::appendToFile(const std::string &path, std::span<const WearRecord> records)
+{
+    std::vector<std::uint8_t> bytes(records.size() * RecordBytes);
+    for (std::size_t i = 0; i < records.size(); ++i)
+        encode(records[i], bytes.data() + i * RecordBytes);
+
+    std::FILE *out = std::fopen(path.c_str(), "ab");
+    if (!out)
+        return false;
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), out) == bytes.size();
+    // pe disc inainte ca versiunea care le include sa poata valida un snapshot
+    ok = ok && std::fflush(out) == 0 && ::fsync(::fileno(out)) == 0;
+    ok = std::fclose(out) == 0 && ok;
+    return ok;
+}
+
+std::vector<WearRecord> WearLog::readFile(const std::string &path)
+{
+    std::vector<WearRecord> records;
+    std::FILE *in = std::fopen(path.c_str(), "rb");
+    if (!in)
+        return records;
+    std::uint8_t buffer[RecordBytes * 256];
+    std::size_t pending = 0;
+    for (;;)
+    {
+        std::size_t read = std::fread(buffer + pending, 1, sizeof(buffer) - pending, in);
+        if (read == 0)
+            break;
+        pending += read;
+        std::size_t whole = pending / RecordBytes;
+        for (std::size_t i = 0; i < whole; ++i)
+            records.push_back(decode(buffer + i * RecordBytes));
+        pending -= whole * RecordBytes;
+        std::copy(buffer + whole * RecordBytes, buffer + whole * RecordBytes + pending, buffer);
+    }
+    std::fclose(in);
+    return records;
+}
+
+void WearLog::clear()
+{
+    records_.clear();
+    byDay_.clear();
+    items_.clear();
+    neverWorn_.clear();
+    byColor_.clear();
+    byCategory_.clear();
+    totalOutfitWears_ = 0;
+    totalItemWears_ = 0;
+    outfitIds_.clear();
+    outfitTotals_.clear();
+    windowEnd_ = Date();
+    windowCounts_.clear();
+    ranking_.clear();
+}
+
+void WearLog::reserve(std::size_t records)
+{
+    records_.reserve(records);
+    byDay_.reserve(records);
+}
+
+// garderoba
+
+void WearLog::trackItem(const ItemRecord &item)
+{
+    const SymbolTable &table = SymbolTable::getInstance();
+    ItemState &state = items_[item.id];
+    if (state.tracked)
+        addToDistribution(state, -static_cast<std::int64_t>(state.wear.wears));
+    // un id refolosit (backend-ul l-a dat din nou dupa stergere) nu mosteneste purtarile vechi
+    if (state.retired)
+        state = ItemState{};
+    state.color = table.fold(item.color);
+    state.category = table.fold(item.category);
+    state.tracked = true;
+    addToDistribution(state, state.wear.wears);
+    if (state.wear.wears == 0)
+        neverWorn_.insert(item.id);
+}
+
+void WearLog::untrackItem(int itemId)
+{
+    auto it = items_.find(itemId);
+    if (it == items_.end() || !it->second.tracked)
+        return;
+    addToDistribution(it->second, -static_cast<std::int64_t>(it->second.wear.wears));
+    it->second.tracked = false;
+    it->second.retired = true;
+    neverWorn_.erase(itemId);
+    // istoricul articolului ramane (purtarile vechi se numara in continuare)
+    if (it->second.wear.wears == 0)
+        items_.erase(it);
+}
+
+void WearLog::trackOutfit(const std::string &outfitId)
+{
+    outfitIds_[outfitKey(outfitId)] = outfitId;
+}
+
+void WearLog::untrackOutfit(const std::string &outfitId)
+{
+    outfitIds_.erase(outfitKey(outfitId));
+}
+
+void WearLog::addToDistribution(const ItemState &state, std::int64_t delta)
+{
+    if (delta == 0)
+        return;
+    for (auto [counts, symbol] : {std::pair{&byColor_, state.color}, std::pair{&byCategory_, state.category}})
+    {
+        std::size_t &value = (*counts)[symbol];
+        value = static_cast<std::size_t>(static_cast<std::int64_t>(value) + delta);
+        if (value == 0)
+            counts->erase(symbol);
+    }
+}
+
+// inregistrari
+
+void WearLog::append(std::span<const WearRecord> records)
+{
+    for (const WearRecord &record : records)
+    {
+        const auto position = static_cast<std::uint32_t>(records_.size());
+        records_.push_back(record);
+        // de obicei ziua e cea mai noua, deci inserarea e la final
+        auto at = std::upper_bound(byDay_.begin(), byDay_.end(), record.day,
+                                   [this](std::int32_t day, std::uint32_t p) { return day < records_[p].day; });
+        byDay_.insert(at, position);
+        count(record);
+    }
+}
+
+void WearLog::count(const WearRecord &record)
+{
+    const Date day = record.date();
+    if (record.isOutfit())
+    {
+        ++totalOutfitWears_;
+        ++outfitTotals_[record.outfitKey];
+        if (windowEnd_.empty() || day > windowEnd_)
+            advanceTo(day);
+        if (day > windowEnd_ - windowDays_)
+            addToWindow(record.outfitKey, +1);
+        return;
+    }
+
+    ++totalItemWears_;
+    ItemState &state = items_[record.itemId];
+    ItemWear &wear = state.wear;
+    if (state.tracked)
+    {
+        if (wear.wears == 0)
+            neverWorn_.erase(record.itemId);
+        addToDistribution(state, +1);
+    }
+    ++wear.wears;
+    if (wear.firstWorn.empty() || day < wear.firstWorn)
+        wear.firstWorn = day;
+    if (day > wear.lastWorn)
+        wear.lastWorn = day;
+}
+
+std::vector<std::uint32_t>::const_iterator WearLog::lowerBound(Date day) const
+{
+    return std::lower_bound(byDay_.begin(), byDay_.end(), day.dayNumber(),
+                            [this](std::uint32_t p, std::int32_t d) { return records_[p].day < d; });
+}
+
+// fereastra glisanta
+
+void WearLog::addToWindow(std::uint64_t key, int delta)
+{
+    std::uint32_t &value = windowCounts_[key];
+    if (value > 0)
+        ranking_.erase({value, key});
+    value = static_cast<std::uint32_t>(static_cast<int>(value) + delta);
+    if (value > 0)
+        ranking_.insert({value, key});
+    else
+        windowCounts_.erase(key);
+}
+
+void WearLog::advanceTo(Date day)
+{
+    if (day.empty() || (!windowEnd_.empty() && day <= windowEnd_))
+        return;
+    if (!windowEnd_.empty())
+    {
+        // scoate doar zilele care ies din fereastra (prin indexul pe date)
+        const Date oldStart = windowEnd_ - (windowDays_ - 1);
+        const Date newStart = day - (windowDays_ - 1);
+        for (auto it = lowerBound(oldStart); it != byDay_.end() && records_[*it].day < newStart.dayNumber(); ++it)
+            if (records_[*it].isOutfit())
+                addToWindow(records_[*it].outfitKey, -1);
+    }
+    windowEnd_ = day;
+}
+
+std::vector<WearLog::OutfitWears> WearLog::mostWornOutfits(std::size_t count) const
+{
+    std::vector<OutfitWears> result;
+    for (auto it = ranking_.rbegin(); it != ranking_.rend() && result.size() < count; ++it)
+    {
+        auto outfit = outfitIds_.find(it->second);
+        if (outfit != outfitIds_.end())
+            result.push_back(OutfitWears{outfit->second, it->first});
+    }
+    return result;
+}
+
+// citiri
+
+WearLog::ItemWear WearLog::itemWear(int itemId) const
+{
+    auto it = items_.find(itemId);
+    return it == items_.end() ? ItemWear{} : it->second.wear;
+}
+
+std::uint32_t WearLog::outfitWears(const std::string &outfitId) const
+{
+    auto it = outfitTotals_.find(outfitKey(outfitId));
+    return it == outfitTotals_.end() ? 0 : it->second;
+}
+
+std::vector<int> WearLog::neverWornItems() const
+{
+    std::vector<int> ids(neverWorn_.begin(), neverWorn_.end());
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+WearLog::Distribution WearLog::sorted(const std::unordered_map<Symbol, std::size_t> &counts)
+{
+    Distribution result(counts.begin(), counts.end());
+    std::sort(result.begin(), result.end(),
+              [](const auto &a, const auto &b) { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+    return result;
+}
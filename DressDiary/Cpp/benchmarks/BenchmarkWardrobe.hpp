@@ -0,0 +1,60 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include "DataManager.hpp"
+#include "NativeBackend.hpp"
+#include "SyntheticWardrobe.hpp"
+
+// Garderobele folosite de benchmark-uri: cate un user pentru fiecare dimensiune, populat o singura
+// data (SyntheticWardrobe, seed fix) in DataManager, pe un NativeBackend doar in memorie.
+namespace bench
+{
+    // dimensiunile obisnuite: 10^2..10^5 articole
+    inline void wardrobeSizes(benchmark::internal::Benchmark *b)
+    {
+        b->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+    }
+
+    inline SyntheticWardrobe::Config config(std::size_t items, std::size_t imageBytes = 0)
+    {
+        SyntheticWardrobe::Config config;
+        config.seed = 42;
+        config.itemCount = items;
+        config.outfitCount = items / 5;
+        config.imageBytes = imageBytes;
+        return config;
+    }
+
+    // username-ul garderobei cu `items` articole, fiecare cu `imageBytes` de imagine (creata la primul apel)
+    inline const std::string &wardrobe(std::size_t items, std::size_t imageBytes = 0)
+    {
+        static std::mutex mutex;
+        static std::map<std::pair<std::size_t, std::size_t>, std::string> users;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = users.find({items, imageBytes});
+        if (it != users.end())
+            return it->second;
+
+        DataManager &dm = DataManager::getInstance();
+        if (users.empty())
+        {
+            dm.setBackend(std::make_shared<NativeBackend>());
+            dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Allow);
+        }
+        std::string username = "bench-" + std::to_string(items);
+        if (imageBytes != 0)
+            username += "-img" + std::to_string(imageBytes);
+        dm.createUser(username, username, "");
+        dm.loginUser(username, "");
+        SyntheticWardrobe::populate(dm, username, SyntheticWardrobe::generate(config(items, imageBytes)));
+        dm.waitForPersistence();
+        return users.emplace(std::make_pair(items, imageBytes), username).first->second;
+    }
+}
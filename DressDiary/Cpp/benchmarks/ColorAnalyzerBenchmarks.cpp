@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "ColorAnalyzer.hpp"
+#include "Executor.hpp"
+
+// Analiza culorilor pe imagini sintetice deja decodate (fara decoder), 1024 x 768:
+// nucleele (reducere, cuantizare) si analiza completa, fiecare in varianta SIMD compilata
+// (ColorAnalyzer::kernelName) si scalara, plus un lot pe un Executor (ca cel din DataManager).
+// Contorul MP/s e debitul in megapixeli ai imaginii de intrare.
+
+namespace
+{
+    constexpr std::size_t Width = 1024;
+    constexpr std::size_t Height = 768;
+    constexpr std::size_t BatchImages = 8;
+
+    // fundal deschis, un dreptunghi colorat in centru, zgomot pe toata imaginea
+    RgbaImage syntheticImage(std::uint64_t seed)
+    {
+        const auto next = [&seed]
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            return static_cast<std::uint32_t>(seed >> 33);
+        };
+        RgbaImage image;
+        image.width = Width;
+        image.height = Height;
+        image.pixels.resize(Width * Height * 4);
+        const std::uint32_t fill = next();
+        for (std::size_t y = 0; y < Height; ++y)
+            for (std::size_t x = 0; x < Width; ++x)
+            {
+                const bool inside = x > Width / 4 && x < Width * 3 / 4 && y > Height / 5 && y < Height * 4 / 5;
+                const std::uint32_t noise = next() & 0x1F;
+                std::uint8_t *p = image.pixels.data() + (y * Width + x) * 4;
+                for (int c = 0; c < 3; ++c)
+                    p[c] = inside ? static_cast<std::uint8_t>(((fill >> (c * 8)) & 0xE0) | noise)
+                                  : static_cast<std::uint8_t>(224 + (noise >> 2));
+                p[3] = 255;
+            }
+        return image;
+    }
+
+    const RgbaImage &image()
+    {
+        static const RgbaImage cached = syntheticImage(1);
+        return cached;
+    }
+
+    void setMegapixels(benchmark::State &state, std::size_t images)
+    {
+        state.counters["MP/s"] = benchmark::Counter(static_cast<double>(state.iterations() * images) * Width * Height / 1e6,
+                                                    benchmark::Counter::kIsRate);
+    }
+
+    void BM_ColorDownsample(benchmark::State &state, ColorAnalyzer::Kernel kernel)
+    {
+        const RgbaImage &src = image();
+        RgbaImage dst;
+        for (auto _ : state)
+        {
+            ColorAnalyzer::downsample(src, ColorAnalyzer::SampleSide, dst, kernel);
+            benchmark::DoNotOptimize(dst.pixels.data());
+        }
+        setMegapixels(state, 1);
+    }
+    BENCHMARK_CAPTURE(BM_ColorDownsample, simd, ColorAnalyzer::Kernel::Simd)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_ColorDownsample, scalar, ColorAnalyzer::Kernel::Scalar)->Unit(benchmark::kMicrosecond);
+
+    // pe imaginea intreaga (in analiza ruleaza doar pe esantionul redus), ca debitul sa fie comparabil
+    void BM_ColorQuantize(benchmark::State &state, ColorAnalyzer::Kernel kernel)
+    {
+        const RgbaImage &src = image();
+        std::vector<std::uint16_t> bins(src.pixelCount());
+        for (auto _ : state)
+        {
+            ColorAnalyzer::quantize(src.pixels.data(), bins.size(), bins.data(), kernel);
+            benchmark::DoNotOptimize(bins.data());
+        }
+        setMegapixels(state, 1);
+    }
+    BENCHMARK_CAPTURE(BM_ColorQuantize, simd, ColorAnalyzer::Kernel::Simd)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_ColorQuantize, scalar, ColorAnalyzer::Kernel::Scalar)->Unit(benchmark::kMicrosecond);
+
+    void BM_ColorAnalyzePixels(benchmark::State &state, ColorAnalyzer::Kernel kernel)
+    {
+        const RgbaImage &src = image();
+        for (auto _ : state)
+        {
+            auto analysis = ColorAnalyzer::analyzePixels(src, kernel);
+            benchmark::DoNotOptimize(analysis.colors.data());
+        }
+        setMegapixels(state, 1);
+    }
+    BENCHMARK_CAPTURE(BM_ColorAnalyzePixels, simd, ColorAnalyzer::Kernel::Simd)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_ColorAnalyzePixels, scalar, ColorAnalyzer::Kernel::Scalar)->Unit(benchmark::kMicrosecond);
+
+    void BM_ColorAnalyzePixelsBatch(benchmark::State &state)
+    {
+        static const std::vector<RgbaImage> images = []
+        {
+            std::vector<RgbaImage> result;
+            for (std::size_t i = 0; i < BatchImages; ++i)
+                result.push_back(syntheticImage(i + 1));
+            return result;
+        }();
+        static Executor executor;
+        for (auto _ : state)
+        {
+            auto results = ColorAnalyzer::analyzePixelsBatch(images, executor);
+            benchmark::DoNotOptimize(results.data());
+        }
+        setMegapixels(state, images.size());
+    }
+    BENCHMARK(BM_ColorAnalyzePixelsBatch)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
@@ -0,0 +1,173 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "BenchmarkWardrobe.hpp"
+#include "Date.hpp"
+#include "Outfit.hpp"
+#include "SymbolTable.hpp"
+#include "Utilities.hpp"
+
+// Caile principale ale nucleului la 10^2..10^5 articole (outfit-uri = articole / 5).
+// Rezultatele in JSON: --benchmark_format=json sau tinta benchmark-json din CMake.
+
+namespace
+{
+    void BM_GetClothingItems(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.getClothingItems(user));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_GetClothingItems)->Apply(bench::wardrobeSizes);
+
+    void BM_GetItemRecords(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.getItemRecords(user));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_GetItemRecords)->Apply(bench::wardrobeSizes);
+
+    void BM_GetOutfits(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.getOutfits(user));
+        state.SetItemsProcessed(state.iterations() * dm.getOutfitCount(user));
+    }
+    BENCHMARK(BM_GetOutfits)->Apply(bench::wardrobeSizes);
+
+    void BM_GetResolvedOutfits(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.getResolvedOutfits(user));
+        state.SetItemsProcessed(state.iterations() * dm.getOutfitCount(user));
+    }
+    BENCHMARK(BM_GetResolvedOutfits)->Apply(bench::wardrobeSizes);
+
+    void BM_GetTodaySuggestion(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.getTodaySuggestion(user));
+    }
+    BENCHMARK(BM_GetTodaySuggestion)->Apply(bench::wardrobeSizes);
+
+    // filtre
+
+    void BM_FilterClothingItems(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        const std::vector<std::string> colors = {"black", "blue"};
+        const std::vector<std::string> materials = {"cotton"};
+        const std::vector<std::string> categories = {"top", "pants"};
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.filterClothingItems(user, colors, materials, categories));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_FilterClothingItems)->Apply(bench::wardrobeSizes);
+
+    void BM_FilterClothingItemsBySymbol(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        auto &table = SymbolTable::getInstance();
+        const std::vector<Symbol> colors = {table.intern("black"), table.intern("blue")};
+        const std::vector<Symbol> categories = {symbols::Top, symbols::Pants};
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.filterClothingItemsBySymbol(user, colors, {}, categories));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_FilterClothingItemsBySymbol)->Apply(bench::wardrobeSizes);
+
+    void BM_FilterOutfits(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        const std::vector<std::string> seasons = {"vara", "primavara"};
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.filterOutfits(user, seasons));
+        state.SetItemsProcessed(state.iterations() * dm.getOutfitCount(user));
+    }
+    BENCHMARK(BM_FilterOutfits)->Apply(bench::wardrobeSizes);
+
+    // Outfit::operator==: fiecare outfit cu o copie (comparatie completa) si cu urmatorul
+    // (de obicei doar hash-ul difera)
+    void BM_OutfitEquality(benchmark::State &state)
+    {
+        const auto wardrobe = SyntheticWardrobe::generate(bench::config(state.range(0)));
+        std::vector<Outfit> copies;
+        copies.reserve(wardrobe.outfits.size());
+        for (const auto &outfit : wardrobe.outfits)
+            copies.push_back(*outfit);
+
+        for (auto _ : state)
+        {
+            std::size_t equal = 0;
+            for (std::size_t i = 0; i < copies.size(); ++i)
+            {
+                equal += *wardrobe.outfits[i] == copies[i];
+                equal += *wardrobe.outfits[i] == copies[(i + 1) % copies.size()];
+            }
+            benchmark::DoNotOptimize(equal);
+        }
+        state.SetItemsProcessed(state.iterations() * copies.size() * 2);
+    }
+    BENCHMARK(BM_OutfitEquality)->Apply(bench::wardrobeSizes);
+
+    // date
+
+    std::vector<std::string> dateStrings(std::size_t count)
+    {
+        std::vector<std::string> dates;
+        dates.reserve(count);
+        const Date first = *Date::parse("01-01-2020");
+        for (std::size_t i = 0; i < count; ++i)
+            dates.push_back((first + static_cast<int>(i % 3650)).toString());
+        return dates;
+    }
+
+    void BM_ParseDMY(benchmark::State &state)
+    {
+        const auto dates = dateStrings(state.range(0));
+        for (auto _ : state)
+            for (const auto &date : dates)
+                benchmark::DoNotOptimize(parseDMY(date));
+        state.SetItemsProcessed(state.iterations() * dates.size());
+    }
+    BENCHMARK(BM_ParseDMY)->Apply(bench::wardrobeSizes);
+
+    void BM_DaysBetween(benchmark::State &state)
+    {
+        const auto dates = dateStrings(state.range(0));
+        for (auto _ : state)
+            for (std::size_t i = 1; i < dates.size(); ++i)
+                benchmark::DoNotOptimize(daysBetween(dates[i - 1], dates[i]));
+        state.SetItemsProcessed(state.iterations() * dates.size());
+    }
+    BENCHMARK(BM_DaysBetween)->Apply(bench::wardrobeSizes);
+
+    // aceeasi diferenta pe Date (fara parsare)
+    void BM_DateDifference(benchmark::State &state)
+    {
+        std::vector<Date> dates;
+        for (const auto &text : dateStrings(state.range(0)))
+            dates.push_back(*Date::parse(text));
+        for (auto _ : state)
+            for (std::size_t i = 1; i < dates.size(); ++i)
+                benchmark::DoNotOptimize(dates[i] - dates[i - 1]);
+        state.SetItemsProcessed(state.iterations() * dates.size());
+    }
+    BENCHMARK(BM_DateDifference)->Apply(bench::wardrobeSizes);
+}
+
+BENCHMARK_MAIN();
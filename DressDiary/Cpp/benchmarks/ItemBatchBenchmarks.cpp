@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+#include "BenchmarkWardrobe.hpp"
+#include "ItemBatch.hpp"
+#include "Items.hpp"
+
+// Conversia pentru bridge a 5.000 de articole cu imagini de 4 KB.
+// Inainte: un dictionar per articol (ca dictFromClothingItem) - fiecare string convertit,
+// materialele copiate prin valoare, imaginea copiata, dynamic_pointer_cast pe fiecare tip.
+// Dupa: getItemBatch + pool-ul de string-uri convertit o singura data; imaginile raman
+// buffer-ele din cache (ca dataWithBytesNoCopy).
+
+namespace
+{
+    constexpr std::size_t Items = 5000;
+    constexpr std::size_t ImageBytes = 4096;
+
+    using Value = std::variant<int, float, bool, std::string, std::vector<std::string>, std::vector<std::uint8_t>>;
+    using Dictionary = std::map<std::string, Value>;
+
+    Dictionary dictFromClothingItem(const std::shared_ptr<ClothingItem> &item)
+    {
+        Dictionary dict;
+        dict["id"] = item->getId();
+        dict["category"] = std::string(item->getCategory());
+        dict["color"] = std::string(item->getColor());
+        dict["materials"] = item->getMaterials();
+        const ImageBlob &image = item->getImage();
+        dict["image"] = std::vector<std::uint8_t>(image.data(), image.data() + image.size());
+        if (auto pants = std::dynamic_pointer_cast<Pants>(item))
+        {
+            dict["pantLength"] = pants->getLungime();
+            dict["pantWaist"] = std::string(pants->getTalie());
+        }
+        if (auto jacket = std::dynamic_pointer_cast<Jacket>(item))
+            dict["jacketWaterproof"] = jacket->isWaterproof();
+        if (auto top = std::dynamic_pointer_cast<Top>(item))
+        {
+            dict["topSleeveType"] = std::string(top->getManeca());
+            dict["topNeckline"] = std::string(top->getDecolteu());
+        }
+        return dict;
+    }
+
+    void BM_BridgeDictionaries(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(Items, ImageBytes);
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+        {
+            std::vector<Dictionary> dicts;
+            const auto items = dm.getClothingItems(user);
+            dicts.reserve(items.size());
+            for (const auto &item : items)
+                dicts.push_back(dictFromClothingItem(item));
+            benchmark::DoNotOptimize(dicts.data());
+        }
+        state.SetItemsProcessed(state.iterations() * Items);
+    }
+    BENCHMARK(BM_BridgeDictionaries)->Unit(benchmark::kMicrosecond);
+
+    void BM_BridgeItemBatch(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(Items, ImageBytes);
+        DataManager &dm = DataManager::getInstance();
+        auto &table = SymbolTable::getInstance();
+        for (auto _ : state)
+        {
+            const ItemBatch batch = dm.getItemBatch(user);
+            std::vector<std::string> strings;
+            strings.reserve(batch.strings().size());
+            for (Symbol symbol : batch.strings())
+                strings.push_back(table.name(symbol));
+            std::size_t imageBytes = 0;
+            for (std::size_t i = 0; i < batch.size(); ++i)
+                imageBytes += batch.image(i).size();
+            benchmark::DoNotOptimize(strings.data());
+            benchmark::DoNotOptimize(imageBytes);
+        }
+        state.SetItemsProcessed(state.iterations() * Items);
+    }
+    BENCHMARK(BM_BridgeItemBatch)->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "BenchmarkWardrobe.hpp"
+#include "OutfitGenerator.hpp"
+
+// Cele mai bune 20 de outfit-uri compuse din garderoba (cazul de referinta: 1.000 de articole,
+// ~10^11 combinatii brute). Vara = 3 sloturi; toamna = 4 (jacheta impermeabila, fiind ploioasa).
+// Timpul real, nu CPU: generatorul ruleaza pe toate core-urile.
+
+namespace
+{
+    void BM_GenerateOutfits(benchmark::State &state)
+    {
+        const auto wardrobe = SyntheticWardrobe::generate(bench::config(state.range(0)));
+        OutfitGenerator::Options options;
+        options.season = static_cast<Symbol>(state.range(1));
+        options.count = 20;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(OutfitGenerator::generate(wardrobe.items, options));
+        state.SetLabel(SymbolTable::getInstance().name(options.season));
+    }
+    BENCHMARK(BM_GenerateOutfits)
+        ->ArgsProduct({{100, 1000, 10000}, {symbols::Vara, symbols::Toamna}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+    // prin DataManager (sezonul curent, articolele din cache)
+    void BM_DataManagerGenerateOutfits(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.generateOutfits(user, 20));
+    }
+    BENCHMARK(BM_DataManagerGenerateOutfits)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
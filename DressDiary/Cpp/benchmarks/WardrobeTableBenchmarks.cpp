@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include "BenchmarkWardrobe.hpp"
+#include "WardrobeTable.hpp"
+
+// Numaratorile pe WardrobeTable (coloane) fata de parcurgerea vectorului de shared_ptr<ClothingItem>
+// (un pointer urmarit per articol), pana la 10^5 articole. Aceleasi simboluri in ambele variante,
+// deci diferenta vine doar din layout.
+
+namespace
+{
+    void BM_CountPointerWalk(benchmark::State &state)
+    {
+        const auto items = DataManager::getInstance().getClothingItems(bench::wardrobe(state.range(0)));
+        auto &table = SymbolTable::getInstance();
+        const Symbol black = table.intern("black");
+        for (auto _ : state)
+        {
+            std::size_t count = 0;
+            for (const auto &item : items)
+                count += item->getColorId() == black && item->getCategoryId() == symbols::Top;
+            benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * items.size());
+    }
+    BENCHMARK(BM_CountPointerWalk)->Apply(bench::wardrobeSizes);
+
+    void BM_CountTable(benchmark::State &state)
+    {
+        const auto table = WardrobeTable::fromItems(DataManager::getInstance().getClothingItems(bench::wardrobe(state.range(0))));
+        const Symbol black = SymbolTable::getInstance().intern("black");
+        for (auto _ : state)
+            benchmark::DoNotOptimize(table.count(black, symbols::Top));
+        state.SetItemsProcessed(state.iterations() * table.size());
+    }
+    BENCHMARK(BM_CountTable)->Apply(bench::wardrobeSizes);
+
+    void BM_CountMaterialPointerWalk(benchmark::State &state)
+    {
+        const auto items = DataManager::getInstance().getClothingItems(bench::wardrobe(state.range(0)));
+        const Symbol cotton = SymbolTable::getInstance().intern("cotton");
+        for (auto _ : state)
+        {
+            std::size_t count = 0;
+            for (const auto &item : items)
+            {
+                const auto &materials = item->getMaterialIds();
+                count += std::find(materials.begin(), materials.end(), cotton) != materials.end();
+            }
+            benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * items.size());
+    }
+    BENCHMARK(BM_CountMaterialPointerWalk)->Apply(bench::wardrobeSizes);
+
+    void BM_CountMaterialTable(benchmark::State &state)
+    {
+        const auto table = WardrobeTable::fromItems(DataManager::getInstance().getClothingItems(bench::wardrobe(state.range(0))));
+        const Symbol cotton = SymbolTable::getInstance().intern("cotton");
+        for (auto _ : state)
+            benchmark::DoNotOptimize(table.countMaterial(cotton));
+        state.SetItemsProcessed(state.iterations() * table.size());
+    }
+    BENCHMARK(BM_CountMaterialTable)->Apply(bench::wardrobeSizes);
+
+    // prin API-ul DataManager (lock partajat + conversia numelor in simboluri)
+    void BM_CountClothingItems(benchmark::State &state)
+    {
+        const std::string &user = bench::wardrobe(state.range(0));
+        DataManager &dm = DataManager::getInstance();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(dm.countClothingItems(user, "black", "top"));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_CountClothingItems)->Apply(bench::wardrobeSizes);
+}
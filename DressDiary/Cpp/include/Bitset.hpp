@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Bitset dinamic compact (64 de slot-uri pe cuvant), folosit pentru posting lists.
+class Bitset
+{
+    std::vector<std::uint64_t> words;
+    std::size_t bits = 0;
+
+public:
+    Bitset() = default;
+    explicit Bitset(std::size_t size, bool value = false)
+    {
+        resize(size);
+        if (value)
+            fill();
+    }
+
+    std::size_t size() const { return bits; }
+
+    // slot-urile noi sunt 0
+    void resize(std::size_t size)
+    {
+        words.resize((size + 63) / 64, 0);
+        bits = size;
+        trim();
+    }
+
+    void fill()
+    {
+        std::fill(words.begin(), words.end(), ~std::uint64_t(0));
+        trim();
+    }
+
+    void set(std::size_t i)
+    {
+        if (i >= bits)
+            resize(i + 1);
+        words[i / 64] |= std::uint64_t(1) << (i % 64);
+    }
+
+    void reset(std::size_t i)
+    {
+        if (i < bits)
+            words[i / 64] &= ~(std::uint64_t(1) << (i % 64));
+    }
+
+    bool test(std::size_t i) const
+    {
+        return i < bits && (words[i / 64] >> (i % 64)) & 1;
+    }
+
+    std::size_t count() const
+    {
+        std::size_t n = 0;
+        for (std::uint64_t w : words)
+            n += static_cast<std::size_t>(std::popcount(w));
+        return n;
+    }
+
+    bool none() const
+    {
+        return std::all_of(words.begin(), words.end(), [](std::uint64_t w) { return w == 0; });
+    }
+
+    Bitset &operator&=(const Bitset &other)
+    {
+        const std::size_t n = std::min(words.size(), other.words.size());
+        for (std::size_t i = 0; i < n; ++i)
+            words[i] &= other.words[i];
+        std::fill(words.begin() + n, words.end(), 0);
+        return *this;
+    }
+
+    Bitset &operator|=(const Bitset &other)
+    {
+        if (other.bits > bits)
+            resize(other.bits);
+        for (std::size_t i = 0; i < other.words.size(); ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    // apeleaza f(slot) pentru fiecare bit setat, in ordine crescatoare
+    template <typename F>
+    void forEach(F &&f) const
+    {
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            std::uint64_t word = words[w];
+            while (word)
+            {
+                const int bit = std::countr_zero(word);
+                f(w * 64 + static_cast<std::size_t>(bit));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    // bitii de dupa `bits` din ultimul cuvant raman mereu 0
+    void trim()
+    {
+        if (bits % 64 && !words.empty())
+            words.back() &= (std::uint64_t(1) << (bits % 64)) - 1;
+    }
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ImageBlob.hpp"
+
+// Depozit de imagini adresat dupa continut (content-addressed).
+// Fiecare imagine este salvata o singura data pe disc, sub cheia data de hash-ul
+// continutului, si este numarata (refcount) pentru fiecare articol care o foloseste.
+// La prima salvare se genereaza si un thumbnail, folosit de listari (carduri, colaje).
+//
+// Structura pe disc:
+//   <root>/objects/<ab>/<cheie>   imaginea originala
+//   <root>/thumbs/<ab>/<cheie>    thumbnail-ul (daca exista generator)
+//   <root>/refs.idx               cheie, refcount si dimensiune pentru fiecare blob
+class BlobStore
+{
+public:
+    // primeste imaginea originala si intoarce bytes-ii thumbnail-ului (gol = fara thumbnail)
+    using ThumbnailGenerator = std::function<std::vector<std::uint8_t>(std::span<const std::uint8_t>)>;
+
+    struct Stats
+    {
+        std::uint64_t puts = 0;              // apeluri put() in sesiunea curenta
+        std::uint64_t dedupHits = 0;         // put() care au refolosit un blob existent
+        std::uint64_t uniqueBlobs = 0;
+        std::uint64_t bytesStored = 0;       // bytes originale pe disc
+        std::uint64_t thumbnailBytes = 0;
+        std::uint64_t bytesDeduplicated = 0; // bytes care ar fi fost scrise in plus fara deduplicare
+    };
+
+    explicit BlobStore(std::string rootDir);
+
+    BlobStore(const BlobStore &) = delete;
+    BlobStore &operator=(const BlobStore &) = delete;
+
+    // salveaza continutul (sau refoloseste blob-ul identic) si incrementeaza refcount-ul;
+    // intoarce cheia sau "" la eroare
+    std::string put(std::span<const std::uint8_t> bytes);
+
+    // refcount +1 / -1; la 0 fisierele sunt sterse
+    bool retain(const std::string &key);
+    bool release(const std::string &key);
+
+    // imaginea originala, mapata lazy din fisier
+    ImageBlob open(const std::string &key) const;
+
+    // thumbnail-ul; daca nu exista, imaginea originala
+    ImageBlob openThumbnail(const std::string &key) const;
+
+    bool contains(const std::string &key) const;
+    std::uint32_t refCount(const std::string &key) const;
+
+    Stats stats() const;
+
+    void setThumbnailGenerator(ThumbnailGenerator generator);
+
+    // cheia de continut: 128 biti in hex (32 caractere)
+    static std::string hashKey(std::span<const std::uint8_t> bytes);
+
+private:
+    struct Entry
+    {
+        std::uint32_t refs = 0;
+        std::uint64_t size = 0;
+        std::uint64_t thumbSize = 0;
+    };
+
+    std::string objectPath(const std::string &key) const;
+    std::string thumbPath(const std::string &key) const;
+    void loadIndex();
+    bool saveIndex() const;
+
+    std::string root_;
+    ThumbnailGenerator thumbnailGenerator_ = nullptr;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::uint64_t puts_ = 0;
+    std::uint64_t dedupHits_ = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+// operatia a fost anulata inainte sa se termine (ajunge la apelant prin std::future::get)
+class OperationCancelled : public std::runtime_error
+{
+public:
+    OperationCancelled() : std::runtime_error("operation cancelled") {}
+};
+
+// Semnal de anulare partajat: copiile aceluiasi token vad acelasi cancel().
+// Cine lanseaza operatia pastreaza o copie si apeleaza cancel() (ex. la inchiderea unui view);
+// operatia verifica isCancelled() intre pasi si se opreste cu OperationCancelled.
+class CancellationToken
+{
+    std::shared_ptr<std::atomic<bool>> cancelled_ = std::make_shared<std::atomic<bool>>(false);
+
+public:
+    void cancel() const { cancelled_->store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled_->load(std::memory_order_relaxed); }
+
+    void throwIfCancelled() const
+    {
+        if (isCancelled())
+            throw OperationCancelled();
+    }
+};
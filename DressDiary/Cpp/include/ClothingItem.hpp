@@ -4,26 +4,70 @@
 #include <vector>
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
+#include "ImageBlob.hpp"
+#include "SymbolTable.hpp"
+#include "ItemRecord.hpp"
 
 class ClothingItem
 {
     int id;
-    std::string color;
-    std::vector<std::string> materials;
-    std::string category;
-    std::vector<uint8_t> image;     // imaginea este transformata in biti in swift
+    // valorile sunt internate in SymbolTable; articolul tine doar id-urile
+    Symbol color;
+    std::vector<Symbol> materials;
+    Symbol category;
+    ImageBlob image;     // imaginea este transformata in biti in swift; partajata, incarcata lazy
 
 public:
-    ClothingItem(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const std::vector<std::uint8_t> &image_)
-        : id(id_), color(color_), materials(materials_), category(category_), image(image_) {}
+    ClothingItem(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, ImageBlob image_)
+        : id(id_), color(SymbolTable::getInstance().intern(color_)), category(SymbolTable::getInstance().intern(category_)), image(std::move(image_))
+    {
+        materials.reserve(materials_.size());
+        for (const auto &m : materials_)
+            materials.push_back(SymbolTable::getInstance().intern(m));
+    }
     virtual ~ClothingItem() = default;
 
+    // Prototype: copie polimorfica (pastreaza tipul concret)
+    virtual std::shared_ptr<ClothingItem> clone() const { return std::make_shared<ClothingItem>(*this); }
+
+    // campurile specifice tipului concret, ca alternativa din ItemPayload
+    virtual ItemPayload payload() const { return defaultPayload(category); }
+
+    // adaptor catre reprezentarea plata folosita de cache si de backend-uri
+    ItemRecord toRecord() const
+    {
+        ItemRecord record;
+        record.id = id;
+        record.color = color;
+        record.category = category;
+        record.materials.assign(materials);
+        record.image = image;
+        record.payload = payload();
+        return record;
+    }
+
     // getters
     int getId() const { return id; }
-    std::string getColor() const { return color; }
-    const std::vector<std::string>& getMaterials() const { return materials; }
-    std::string getCategory() const { return category; }
-    const std::vector<uint8_t>& getImage() const { return image; }
+    const std::string& getColor() const { return SymbolTable::getInstance().name(color); }
+    std::vector<std::string> getMaterials() const
+    {
+        std::vector<std::string> names;
+        names.reserve(materials.size());
+        for (Symbol m : materials)
+            names.push_back(SymbolTable::getInstance().name(m));
+        return names;
+    }
+    const std::string& getCategory() const { return SymbolTable::getInstance().name(category); }
+
+    // id-uri internate, pentru comparatii si filtre
+    Symbol getColorId() const { return color; }
+    const std::vector<Symbol>& getMaterialIds() const { return materials; }
+    Symbol getCategoryId() const { return category; }
+    const ImageBlob& getImage() const { return image; }
+
+    // folosit la salvare, cand imaginea este mutata in BlobStore
+    void setImage(ImageBlob newImage) { image = std::move(newImage); }
 
     // pentru removeItem
     bool operator== (int otherId) const {
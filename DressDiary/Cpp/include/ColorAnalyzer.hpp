@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <vector>
+#include "Executor.hpp"
+#include "ImageBlob.hpp"
+
+// Pixeli RGBA8 (alfa premultiplicat sau nu), randuri contigue: stride = width * 4.
+struct RgbaImage
+{
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::vector<std::uint8_t> pixels;
+
+    std::size_t pixelCount() const { return width * height; }
+};
+
+// Culorile dominante ale unei imagini, in vocabularul aplicatiei (red, orange, yellow, green,
+// blue, purple, pink, brown, black, white, gray), pentru completarea automata a culorii.
+//
+// Etape: decodare (prin hook, la cel mult DecodeMaxSide pe latura lunga) -> reducere cu filtru
+// box la cel mult SampleSide -> cuantizare la 4 biti pe canal (4096 de bin-uri) -> histograma ->
+// numele culorii pentru fiecare bin (tabel precalculat, HSV). Reducerea si cuantizarea au nuclee
+// SSE2 / NEON (DRESSDIARY_SIMD=0 le forteaza pe cele scalare). Se numara doar pixelii opaci din
+// zona centrala; culoarea care domina marginea (fundalul) e ignorata daca mai ramane destul.
+//
+// Decodarea nu e in nucleu: pe iOS bridge-ul instaleaza un decoder ImageIO (JPEG, HEIC, PNG).
+class ColorAnalyzer
+{
+public:
+    // Simd = nucleul SSE2 / NEON compilat (scalar daca nu exista, vezi kernelName); Scalar il ocoleste
+    enum class Kernel
+    {
+        Simd,
+        Scalar
+    };
+
+    static constexpr std::size_t DecodeMaxSide = 256;
+    static constexpr std::size_t SampleSide = 64;
+
+    // decodeaza `bytes` in `out`, cu latura lunga de cel mult `maxSide`; false daca nu poate
+    using Decoder = std::function<bool(std::span<const std::uint8_t> bytes, std::size_t maxSide, RgbaImage &out)>;
+
+    struct Swatch
+    {
+        std::string name; // din vocabularul aplicatiei
+        float share = 0;  // fractiunea din pixelii numarati
+        std::uint8_t r = 0, g = 0, b = 0; // media pixelilor cu aceasta culoare
+    };
+
+    struct Analysis
+    {
+        std::vector<Swatch> colors; // descrescator dupa pondere
+        std::size_t width = 0;      // imaginea analizata (dupa decodare)
+        std::size_t height = 0;
+
+        bool empty() const { return colors.empty(); }
+        // culoarea sugerata ("" daca imaginea nu a putut fi analizata)
+        std::string dominant() const { return colors.empty() ? std::string() : colors.front().name; }
+    };
+
+    static ColorAnalyzer &getInstance()
+    {
+        static ColorAnalyzer instance;
+        return instance;
+    }
+
+    void setDecoder(Decoder decoder)
+    {
+        std::unique_lock lock(mutex_);
+        decoder_ = std::move(decoder);
+    }
+
+    bool hasDecoder() const
+    {
+        std::shared_lock lock(mutex_);
+        return decoder_ != nullptr;
+    }
+
+    // rezultat gol fara decoder sau daca imaginea nu se poate decoda
+    Analysis analyze(std::span<const std::uint8_t> encoded) const;
+    Analysis analyze(const ImageBlob &image) const { return analyze(image.bytes()); }
+    static Analysis analyzePixels(const RgbaImage &image, Kernel kernel = Kernel::Simd);
+
+    // loturi impartite intre thread-ul apelant si thread-urile lui `executor` (in aplicatie cel din
+    // DataManager::getExecutor); rezultatele sunt in ordinea imaginilor. Se poate apela si dintr-un
+    // job al aceluiasi executor: apelantul nu asteapta job-uri care n-au pornit.
+    std::vector<Analysis> analyzeBatch(std::span<const ImageBlob> images, Executor &executor) const;
+    static std::vector<Analysis> analyzePixelsBatch(std::span<const RgbaImage> images, Executor &executor);
+
+    // nucleele (publice pentru benchmark-uri si teste); rezultatul nu depinde de varianta
+    // media pe blocuri f x f, cu f ales astfel incat latura lunga a rezultatului <= maxSide
+    static void downsample(const RgbaImage &src, std::size_t maxSide, RgbaImage &dst, Kernel kernel = Kernel::Simd);
+    // bin-ul fiecarui pixel (r4 << 8 | g4 << 4 | b4), sau TransparentBin pentru alfa < 128
+    static constexpr std::uint16_t TransparentBin = 4096;
+    static void quantize(const std::uint8_t *rgba, std::size_t pixels, std::uint16_t *bins, Kernel kernel = Kernel::Simd);
+    // "sse2", "neon" sau "scalar"
+    static const char *kernelName();
+
+private:
+    ColorAnalyzer() = default;
+    ColorAnalyzer(const ColorAnalyzer &) = delete;
+    ColorAnalyzer &operator=(const ColorAnalyzer &) = delete;
+
+    mutable std::shared_mutex mutex_;
+    Decoder decoder_;
+};
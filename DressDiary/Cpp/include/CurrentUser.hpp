@@ -1,9 +1,16 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
 #include "User.hpp"
+#include "SessionManager.hpp"
 
-// design pattern - Singleton
+// design pattern - Singleton (Facade peste SessionManager)
+// Aplicația are un singur utilizator logat: aici stă doar tokenul sesiunii lui,
+// restul (userul, garderoba) e în SessionManager / DataManager.
 
 class CurrentUser {
     CurrentUser() = default;
@@ -11,8 +18,26 @@ class CurrentUser {
     CurrentUser(const CurrentUser&) = delete;
     CurrentUser& operator=(const CurrentUser&) = delete;
 
-    std::shared_ptr<User> user_ = nullptr;
-    
+    // citit din mai multe thread-uri (UI, job-urile din fundal)
+    mutable std::shared_mutex mutex_;
+    SessionManager::Token token_;
+
+    // înlocuiește sesiunea curentă; pe cea veche o închide
+    bool setToken(SessionManager::Token token) {
+        if (token.empty()) {
+            return false;
+        }
+        SessionManager::Token previous;
+        {
+            std::unique_lock lock(mutex_);
+            previous = std::exchange(token_, std::move(token));
+        }
+        if (!previous.empty()) {
+            SessionManager::getInstance().logout(previous);
+        }
+        return true;
+    }
+
 public:
     // Returnează instanța unică
     static CurrentUser& getInstance() {
@@ -20,18 +45,40 @@ public:
         return instance;
     }
 
-    // Setează utilizatorul curent (stochează shared_ptr<User>)
-    void setUser(std::shared_ptr<User> user) {
-        user_ = std::move(user);
+    // Deschide o sesiune nouă (false dacă userul nu există sau parola e greșită)
+    bool login(const std::string& username, const std::string& password) {
+        return setToken(SessionManager::getInstance().login(username, password));
+    }
+
+    // Restaurează sesiunea la pornirea aplicației (fără parolă)
+    bool recover(const std::string& username) {
+        return setToken(SessionManager::getInstance().recover(username));
+    }
+
+    // Închide sesiunea curentă
+    void logout() {
+        SessionManager::Token previous;
+        {
+            std::unique_lock lock(mutex_);
+            previous = std::exchange(token_, SessionManager::Token());
+        }
+        if (!previous.empty()) {
+            SessionManager::getInstance().logout(previous);
+        }
+    }
+
+    SessionManager::Token getToken() const {
+        std::shared_lock lock(mutex_);
+        return token_;
     }
 
     // Obține pointerul la utilizatorul curent (poate fi nullptr dacă nu e logat nimeni)
     std::shared_ptr<User> getUser() const {
-        return user_;
+        return SessionManager::getInstance().user(getToken());
     }
 
     // Verifică dacă există un utilizator logat
     bool hasUser() const {
-        return user_ != nullptr;
+        return getUser() != nullptr;
     }
 };
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+
+// Cursor pe pagini peste o colectie a unui user, in ordinea crescatoare a cheii (id-ul).
+// Cheia e stabila: fiecare pagina incepe strict dupa ultima cheie intoarsa, deci adaugarile
+// sau stergerile dintre pagini nu duc la elemente duble sau sarite.
+// resumeToken() e ultima cheie intoarsa; un cursor deschis cu ea continua de unde a ramas acesta.
+template <typename Key, typename Value>
+class PageCursor
+{
+public:
+    // pagina cu cel mult `limit` elemente cu cheia > after, crescator dupa cheie
+    using FetchPage = std::function<std::vector<Value>(const Key &after, std::size_t limit)>;
+    using KeyOf = Key (*)(const Value &);
+
+    PageCursor(FetchPage fetch, KeyOf keyOf, Key after)
+        : fetch_(std::move(fetch)), keyOf_(keyOf), after_(std::move(after)) {}
+
+    // urmatoarele cel mult `batch` elemente; goala dupa ce colectia s-a terminat
+    std::vector<Value> next(std::size_t batch)
+    {
+        if (done_ || batch == 0)
+            return {};
+        std::vector<Value> page = fetch_(after_, batch);
+        if (page.size() < batch)
+            done_ = true;
+        if (!page.empty())
+            after_ = keyOf_(page.back());
+        return page;
+    }
+
+    bool done() const { return done_; }
+    const Key &resumeToken() const { return after_; }
+
+private:
+    FetchPage fetch_;
+    KeyOf keyOf_;
+    Key after_;
+    bool done_ = false;
+};
+
+using ItemCursor = PageCursor<int, ItemRecord>;
+using OutfitCursor = PageCursor<std::string, std::shared_ptr<Outfit>>;
@@ -1,12 +1,40 @@
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 #include <memory>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
+#include <span>
 #include "User.hpp"
 #include "ClothingItem.hpp"
+#include "ItemRecord.hpp"
 #include "Outfit.hpp"
+#include "StorageBackend.hpp"
+#include "BlobStore.hpp"
+#include "WardrobeIndex.hpp"
+#include "WardrobeTable.hpp"
+#include "OutfitJoin.hpp"
+#include "RecommendationEngine.hpp"
+#include "OutfitGenerator.hpp"
+#include "OutfitSimilarity.hpp"
+#include "PersistenceWorker.hpp"
+#include "Executor.hpp"
+#include "CancellationToken.hpp"
+#include "Cursor.hpp"
+#include "ItemBatch.hpp"
+#include "WearLog.hpp"
+#include "WardrobeSnapshot.hpp"
 
 class DataManager
 {
@@ -14,12 +42,256 @@ class DataManager
     DataManager(const DataManager &) = delete;
     DataManager &operator=(const DataManager &) = delete;
 
-    using ItemsChangedCallback = std::function<void()>;
-    using OutfitsChangedCallback = std::function<void()>;
+public:
+    // ce s-a schimbat efectiv in cache (trimis observatorilor)
+    struct ItemsDelta
+    {
+        std::vector<int> added;
+        std::vector<int> updated;
+        std::vector<int> removed;
+
+        bool empty() const { return added.empty() && updated.empty() && removed.empty(); }
+    };
+
+    struct OutfitsDelta
+    {
+        std::vector<std::string> added;
+        std::vector<std::string> updated;
+        std::vector<std::string> removed;
+
+        bool empty() const { return added.empty() && updated.empty() && removed.empty(); }
+    };
+
+    // outfit impreuna cu articolele lui (in ordinea id-urilor din outfit), rezolvate prin join
+    struct ResolvedOutfit
+    {
+        std::shared_ptr<Outfit> outfit;
+        std::vector<ItemRecord> items;
+    };
+
+    // ce face saveOutfit cand exista deja un alt outfit cu exact aceleasi articole
+    enum class DuplicateOutfitPolicy
+    {
+        Allow,  // se salveaza (duplicatul se poate semnala cu findDuplicateOutfit)
+        Reject, // saveOutfit intoarce false
+    };
+
+    // doua outfit-uri cu multimile de articole asemanatoare (Jaccard)
+    struct NearDuplicate
+    {
+        std::string first;
+        std::string second;
+        double jaccard = 0.0;
+    };
+
+    // primesc si username-ul: un singur observator poate servi mai multi useri (vezi SessionManager)
+    using ItemsChangedCallback = std::function<void(const std::string &username, const ItemsDelta &)>;
+    using OutfitsChangedCallback = std::function<void(const std::string &username, const OutfitsDelta &)>;
+
+private:
+    // Concurenta: `mutex_` pazeste configuratia (backend, imagini, politici, callback-uri).
+    // Operatiile pe garderoba unui user il iau partajat si apoi lock-ul shard-ului userului
+    // (partajat pentru citiri, exclusiv pentru modificari), deci userii din shard-uri diferite
+    // nu se asteapta intre ei; cine ia `mutex_` exclusiv are astfel si toate shard-urile.
+    // Modificarile actualizeaza cache-ul imediat si pun scrierea in backend in coada
+    // `worker_` (un singur thread, in ordine); rezultatul scrierii vine printr-un std::future.
+    // Daca scrierea esueaza, cache-ul userului e marcat invalid si se reincarca la urmatorul acces.
+    mutable std::shared_mutex mutex_;
 
     ItemsChangedCallback itemsChangedCallback_ = nullptr;
     OutfitsChangedCallback outfitsChangedCallback_ = nullptr;
 
+    // backend-ul de persistenta (Core Data pe iOS, NativeBackend in rest)
+    std::shared_ptr<StorageBackend> backend_ = nullptr;
+
+    // depozitul de imagini (optional); cand exista, saveClothingItem scrie imaginile prin el
+    std::shared_ptr<BlobStore> blobStore_ = nullptr;
+
+    DuplicateOutfitPolicy duplicatePolicy_ = DuplicateOutfitPolicy::Allow;
+
+    // cache write-behind per user: umplut o data la login/recover,
+    // apoi actualizat doar de operatiile de save/delete
+    struct WardrobeCache
+    {
+        // userul rezolvat de backend; toate operatiile de persistenta il primesc direct
+        UserHandlePtr user;
+
+        // record-uri plate, contigue: o singura alocare pentru toata garderoba
+        std::vector<ItemRecord> items;
+        std::unordered_map<int, std::size_t> itemSlots;
+        std::vector<std::shared_ptr<Outfit>> outfits;
+        std::unordered_map<std::string, std::size_t> outfitSlots;
+
+        // id-urile in ordine crescatoare: paginile cursoarelor fara sortare
+        std::set<int> itemOrder;
+        std::set<std::string> outfitOrder;
+
+        // index secundar peste aceleasi slot-uri ca vectorii de mai sus
+        WardrobeIndex index;
+
+        // coloanele articolelor (aceleasi slot-uri ca `items`), pentru scanari si statistici
+        WardrobeTable table;
+
+        // outfit -> articole si articol -> outfit-uri, peste aceleasi slot-uri
+        OutfitJoin join;
+
+        // ponderile pentru sugestia zilei (aceleasi slot-uri ca `outfits`) si istoricul purtarilor
+        RecommendationEngine recommender;
+
+        // hash-ul multimii de articole -> outfit-urile cu acel hash (duplicate in O(1))
+        std::unordered_map<std::uint64_t, std::vector<std::string>> outfitsByItemSet;
+
+        // istoricul purtarilor si statisticile tinute la zi peste el
+        WearLog wear;
+    };
+
+    // cache-urile si handle-urile rezolvate (o singura cautare a userului pe sesiune),
+    // impartite dupa hash-ul username-ului
+    struct UserShard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, WardrobeCache> caches;
+        std::unordered_map<std::string, UserHandlePtr> handles;
+    };
+    static constexpr std::size_t ShardCount = 32;
+    mutable std::array<UserShard, ShardCount> shards_;
+
+    UserShard &shardFor(const std::string &username) const
+    {
+        return shards_[std::hash<std::string>{}(username) % ShardCount];
+    }
+
+    // lock-urile unei operatii pe garderoba userului, in ordinea configuratie -> shard
+    struct ReadLock
+    {
+        std::shared_lock<std::shared_mutex> config;
+        std::shared_lock<std::shared_mutex> shard;
+    };
+    struct WriteLock
+    {
+        std::shared_lock<std::shared_mutex> config;
+        std::unique_lock<std::shared_mutex> shard;
+    };
+    ReadLock readLock(const std::string &username) const
+    {
+        return {std::shared_lock(mutex_), std::shared_lock(shardFor(username).mutex)};
+    }
+    WriteLock writeLock(const std::string &username) const
+    {
+        return {std::shared_lock(mutex_), std::unique_lock(shardFor(username).mutex)};
+    }
+
+    // userii ale caror scrieri au esuat in backend (cache-ul lor trebuie reincarcat);
+    // are lock separat fiindca il scrie worker-ul, care nu ia niciodata `mutex_`
+    mutable std::mutex staleMutex_;
+    std::unordered_set<std::string> staleUsers_;
+
+    // directorul snapshot-urilor (gol = fara snapshot-uri)
+    std::string snapshotDir_;
+
+    // rescrierile de snapshot puse in executor (cel mult una in asteptare per user);
+    // lock separat fiindca job-urile il iau fara `mutex_`
+    std::mutex snapshotMutex_;
+    std::condition_variable snapshotIdle_;
+    std::unordered_set<std::string> snapshotPending_;
+    std::size_t snapshotJobs_ = 0;
+    // scrieri esuate per user: un snapshot capturat inainte de un esec nu se mai scrie
+    std::unordered_map<std::string, std::uint64_t> snapshotFailures_;
+    // ultima versiune scrisa / incarcata per user; serializeaza scrierea fisierelor
+    std::mutex snapshotWriteMutex_;
+    std::unordered_map<std::string, std::uint64_t> snapshotRevisions_;
+
+    // intoarce handle-ul userului, rezolvandu-l prin backend la primul acces (nullptr daca nu exista)
+    UserHandlePtr handleFor(const std::string &username);
+
+    // intoarce cache-ul userului, incarcandu-l din backend la primul acces (cere writeLock)
+    WardrobeCache *cacheFor(const std::string &username);
+    void loadCache(const UserHandlePtr &user);
+    // garderoba din snapshot, doar daca are versiunea curenta a backend-ului (cere writeLock)
+    bool loadSnapshot(const UserHandle &user, WardrobeCache &cache, std::vector<std::shared_ptr<Outfit>> &outfits,
+                      std::vector<WearRecord> &wears);
+    // cache-ul deja incarcat si valid, fara incarcare (ajunge readLock)
+    const WardrobeCache *findCache(const std::string &username) const;
+
+    void markStale(const std::string &username);
+    bool isStale(const std::string &username) const;
+    bool takeStale(const std::string &username);
+
+    // pune scrierea in coada worker-ului; la succes elibereaza imaginile inlocuite / sterse
+    // (`releasedKeys`), la esec pe cele noi (`imageKeys`) si invalideaza cache-ul
+    std::future<bool> persist(const std::string &username, std::function<bool(StorageBackend &)> write,
+                              std::vector<std::string> imageKeys = {}, std::vector<std::string> releasedKeys = {});
+    static std::future<bool> ready(bool value);
+
+    // persist pentru modificarile garderobei: programeaza si rescrierea snapshot-ului
+    std::future<bool> persistWardrobe(const std::string &username, std::function<bool(StorageBackend &)> write,
+                                      std::vector<std::string> imageKeys = {},
+                                      std::vector<std::string> releasedKeys = {});
+    // cere writeLock; scrierea ruleaza in executor, dupa scrierile deja in coada
+    void scheduleSnapshot(const std::string &username);
+    void writeSnapshot(const std::string &username);
+    std::string snapshotPath(const std::string &username) const;
+
+    // citire sub lock partajat; doar primul acces (incarcarea cache-ului) ia lock-ul exclusiv
+    template <typename F>
+    auto readCache(const std::string &username, F &&read) -> std::invoke_result_t<F &, const WardrobeCache &>
+    {
+        {
+            ReadLock lock = readLock(username);
+            if (const WardrobeCache *cache = findCache(username))
+                return read(*cache);
+        }
+        WriteLock lock = writeLock(username);
+        const WardrobeCache *cache = cacheFor(username);
+        return cache ? read(*cache) : std::invoke_result_t<F &, const WardrobeCache &>{};
+    }
+
+    // operatii care modifica doar starea din memorie (ex. istoricul sugestiilor)
+    template <typename F>
+    auto writeCache(const std::string &username, F &&write) -> std::invoke_result_t<F &, WardrobeCache &>
+    {
+        WriteLock lock = writeLock(username);
+        WardrobeCache *cache = cacheFor(username);
+        return cache ? write(*cache) : std::invoke_result_t<F &, WardrobeCache &>{};
+    }
+
+    // pasii comuni operatiilor simple si celor pe loturi (nu notifica)
+    std::string storeImage(ItemRecord &item);
+    // cheile imaginilor care nu mai sunt folosite se adauga in `releasedKeys`: se elibereaza
+    // doar dupa ce scrierea reuseste (altfel reincarcarea ar gasi randul vechi fara imagine)
+    void cacheItem(WardrobeCache &cache, ItemRecord &&item, ItemsDelta &delta, std::vector<std::string> &releasedKeys);
+    // scoate articolul si din outfit-urile care il folosesc (doar acelea, prin join)
+    void uncacheItem(WardrobeCache &cache, int itemId, ItemsDelta &delta, OutfitsDelta &outfitsDelta,
+                     std::vector<std::string> &releasedKeys);
+    // `linked` = linkedItemIds(cache, outfit)
+    void cacheOutfit(WardrobeCache &cache, const Outfit &outfit, const std::vector<int> &linked, OutfitsDelta &delta);
+    void uncacheOutfit(WardrobeCache &cache, const std::string &outfitId, OutfitsDelta &delta);
+
+    static std::vector<OutfitJoin::Slot> itemSlotsOf(const WardrobeCache &cache, const Outfit &outfit);
+    static ResolvedOutfit resolveOutfit(const WardrobeCache &cache, std::size_t slot);
+
+    // articolele outfit-ului care exista in cache, sortate si fara duplicate (ca in backend)
+    static std::vector<int> linkedItemIds(const WardrobeCache &cache, const Outfit &outfit);
+    static void indexItemSet(WardrobeCache &cache, const Outfit &outfit);
+    static void unindexItemSet(WardrobeCache &cache, const Outfit &outfit);
+    // alt outfit (id diferit de `exceptId`) cu exact multimea `itemSet` (sortata)
+    static std::shared_ptr<Outfit> duplicateOf(const WardrobeCache &cache, const std::vector<int> &itemSet,
+                                               const std::string &exceptId);
+    // cu DuplicateOutfitPolicy::Reject: un outfit din lot (multimea i = itemSets[i]) dubleaza
+    // un outfit din cache sau unul anterior din lot
+    bool rejectsOutfits(const WardrobeCache &cache, std::span<const Outfit> outfits,
+                        const std::vector<std::vector<int>> &itemSets) const;
+
+    // se apeleaza dupa eliberarea lock-ului (callback-urile pot citi din DataManager)
+    void notifyItems(const std::string &username, const ItemsDelta &delta);
+    void notifyOutfits(const std::string &username, const OutfitsDelta &delta);
+
+    // la distrugere termina scrierile din coada cat timp restul starii exista
+    PersistenceWorker worker_;
+
+    // variantele *Async; ultimul membru: job-urile lui folosesc si worker_, deci se opreste primul
+    Executor executor_;
+
 public:
     // aplicatia propriu zisa
     static DataManager &getInstance() noexcept
@@ -28,44 +300,261 @@ public:
         return instance;
     }
 
+    // Strategy: schimba backend-ul de persistenta folosit de toate operatiile
+    // (scrierile deja in coada se termina pe backend-ul vechi)
+    void setBackend(std::shared_ptr<StorageBackend> backend)
+    {
+        std::unique_lock lock(mutex_);
+        backend_ = std::move(backend);
+        for (UserShard &shard : shards_)
+        {
+            shard.caches.clear();
+            shard.handles.clear();
+        }
+    }
+
+    std::shared_ptr<StorageBackend> getBackend() const
+    {
+        std::shared_lock lock(mutex_);
+        return backend_;
+    }
+
+    void setBlobStore(std::shared_ptr<BlobStore> store)
+    {
+        std::unique_lock lock(mutex_);
+        blobStore_ = std::move(store);
+    }
+
+    std::shared_ptr<BlobStore> getBlobStore() const
+    {
+        std::shared_lock lock(mutex_);
+        return blobStore_;
+    }
+
+    // Snapshot-uri (WardrobeSnapshot): cu un director setat, cache-ul unui user se incarca din
+    // snapshot-ul lui (mapat, fara fetch-uri) cand acesta are versiunea curenta a backend-ului,
+    // iar dupa fiecare modificare a garderobei snapshot-ul se rescrie in fundal
+    void setSnapshotDirectory(std::string dir)
+    {
+        std::unique_lock lock(mutex_);
+        snapshotDir_ = std::move(dir);
+    }
+
+    // asteapta rescrierile de snapshot programate pana acum
+    void waitForSnapshots()
+    {
+        std::unique_lock lock(snapshotMutex_);
+        snapshotIdle_.wait(lock, [this] { return snapshotJobs_ == 0; });
+    }
+
+    void setDuplicateOutfitPolicy(DuplicateOutfitPolicy policy)
+    {
+        std::unique_lock lock(mutex_);
+        duplicatePolicy_ = policy;
+    }
+
+    DuplicateOutfitPolicy getDuplicateOutfitPolicy() const
+    {
+        std::shared_lock lock(mutex_);
+        return duplicatePolicy_;
+    }
+
+    // asteapta pana cand toate scrierile trimise pana acum au ajuns in backend
+    void waitForPersistence()
+    {
+        worker_.drain();
+    }
+
+    // thumbnail-ul imaginii pentru listari (sau imaginea completa daca nu exista)
+    ImageBlob getThumbnail(const ImageBlob &image) const;
+
     // create user (cand faci sign in)
     bool createUser(const std::string &username, const std::string &name, const std::string &password);
 
     // logIn
     std::shared_ptr<User> loginUser(const std::string &username, const std::string &password);
 
-    // clothing items for each user
+    // restaureaza sesiunea la pornirea aplicatiei (fara parola)
+    std::shared_ptr<User> recoverUser(const std::string &username);
+
+    // handle-ul rezolvat la login / recover (nullptr daca userul nu exista)
+    UserHandlePtr getUserHandle(const std::string &username)
+    {
+        WriteLock lock = writeLock(username);
+        return handleFor(username);
+    }
+
+    // cate cautari ale userului in backend au fost evitate prin handle-uri
+    std::uint64_t getUserLookupsSaved() const
+    {
+        std::shared_lock lock(mutex_);
+        return backend_ ? backend_->userLookupsSaved() : 0;
+    }
+
+    // preferinta tema
+    bool updateDarkMode(const std::string &username, bool isDarkMode);
+    std::future<bool> submitUpdateDarkMode(const std::string &username, bool isDarkMode);
+
+    // id-uri noi pentru articole / outfit-uri
+    int generateNextClothingItemId();
+    std::string generateNextOutfitId();
+
+    // clothing items for each user (copie a record-urilor din cache)
+    std::vector<ItemRecord>
+    getItemRecords(const std::string &username);
+
+    // toate articolele intr-un lot compact pentru bridge, construit direct din cache (fara copii de record-uri)
+    ItemBatch getItemBatch(const std::string &username);
+
+    // adaptor pentru codul care lucreaza cu ierarhia ClothingItem (aloca un obiect per articol)
     std::vector<std::shared_ptr<ClothingItem>>
     getClothingItems(const std::string &username);
 
+    // Cursoare pe pagini, crescator dupa id. Cu cache-ul incarcat paginile vin din indexul
+    // ordonat al cache-ului; altfel direct din backend (range scan), fara sa incarce toata garderoba.
+    // `resumeAfter` e resumeToken() al unui cursor anterior.
+    static constexpr int ItemCursorStart = std::numeric_limits<int>::min();
+    ItemCursor openItemCursor(const std::string &username, int resumeAfter = ItemCursorStart);
+    OutfitCursor openOutfitCursor(const std::string &username, std::string resumeAfter = {});
+
+    // o singura pagina: cel mult `limit` elemente cu id > afterId
+    std::vector<ItemRecord> getItemRecordPage(const std::string &username, int afterId, std::size_t limit);
+    std::vector<std::shared_ptr<Outfit>> getOutfitPage(const std::string &username, const std::string &afterId,
+                                                       std::size_t limit);
+
+    // Variante asincrone: ruleaza pe un Executor intern si intorc un std::future.
+    // Anularea token-ului opreste lucrul ramas (copierea se verifica pe bucati),
+    // iar get() pe future arunca OperationCancelled.
+    std::future<std::vector<ItemRecord>>
+    getItemRecordsAsync(const std::string &username, CancellationToken token = {});
+    std::future<std::vector<std::shared_ptr<ClothingItem>>>
+    getClothingItemsAsync(const std::string &username, CancellationToken token = {});
+    std::future<std::vector<ResolvedOutfit>>
+    getResolvedOutfitsAsync(const std::string &username, CancellationToken token = {});
+    std::future<std::shared_ptr<Outfit>>
+    getTodaySuggestionAsync(const std::string &username, CancellationToken token = {});
+    // anularea conteaza doar pana cand scrierea intra in coada de persistenta
+    std::future<bool>
+    saveOutfitAsync(const std::string &username, Outfit outfit, CancellationToken token = {});
+
+    // formele sincrone cu anulare (folosite de variantele asincrone si de bridge)
+    std::vector<ItemRecord>
+    getItemRecords(const std::string &username, const CancellationToken &token);
+    std::vector<ResolvedOutfit>
+    getResolvedOutfits(const std::string &username, const CancellationToken &token);
+
+    // pool-ul pe care ruleaza variantele asincrone (ex. conversiile din bridge)
+    Executor &getExecutor()
+    {
+        return executor_;
+    }
+
+    // Modificarile au doua forme: cea sincrona intoarce rezultatul scrierii in backend,
+    // iar submit* intoarce imediat (cache-ul e deja actualizat) cu un future pentru scriere.
+
     // saves a clothing item
-    bool saveClothingItem(const std::string &username, const ClothingItem &item);
+    bool saveItemRecord(const std::string &username, ItemRecord item);
+    std::future<bool> submitSaveItemRecord(const std::string &username, ItemRecord item);
+
+    // adaptor: ItemFactory::create<T>(...) -> record
+    bool saveClothingItem(const std::string &username, const ClothingItem &item)
+    {
+        return saveItemRecord(username, item.toRecord());
+    }
 
     // delete clothing item
     bool deleteClothingItem(const std::string &username, int itemId);
+    std::future<bool> submitDeleteClothingItem(const std::string &username, int itemId);
+
+    // loturi (ex. import): un singur commit in backend si o singura notificare cu toate id-urile
+    bool saveClothingItems(const std::string &username, std::span<const ItemRecord> items);
+    bool saveClothingItems(const std::string &username, std::span<const std::shared_ptr<ClothingItem>> items);
+    bool deleteClothingItems(const std::string &username, std::span<const int> itemIds);
+    std::future<bool> submitSaveClothingItems(const std::string &username, std::span<const ItemRecord> items);
+    std::future<bool> submitDeleteClothingItems(const std::string &username, std::span<const int> itemIds);
 
-    // outfits for each user
+    // outfits for each user (servite din cache; obiectele sunt partajate, nu le modificati)
     std::vector<std::shared_ptr<Outfit>>
     getOutfits(const std::string &username);
 
-    // save outfit
+    // filtrare prin index: OR intre valorile unui atribut, AND intre atribute (lista goala = orice)
+    std::vector<ItemRecord>
+    filterClothingItems(const std::string &username,
+                        const std::vector<std::string> &colors,
+                        const std::vector<std::string> &materials,
+                        const std::vector<std::string> &categories);
+
+    std::vector<std::shared_ptr<Outfit>>
+    filterOutfits(const std::string &username, const std::vector<std::string> &seasons);
+
+    // outfit-urile cu articolele deja rezolvate (o singura trecere peste outfit-uri)
+    std::vector<ResolvedOutfit>
+    getResolvedOutfits(const std::string &username);
+
+    std::vector<ResolvedOutfit>
+    filterResolvedOutfits(const std::string &username, const std::vector<std::string> &seasons);
+
+    // articolele unui outfit (gol daca outfit-ul nu exista)
+    std::vector<ItemRecord>
+    getOutfitItems(const std::string &username, const std::string &outfitId);
+
+    // variante pe simboluri internate (fara conversii de string-uri)
+    std::vector<ItemRecord>
+    filterClothingItemsBySymbol(const std::string &username,
+                                const std::vector<Symbol> &colors,
+                                const std::vector<Symbol> &materials,
+                                const std::vector<Symbol> &categories);
+
+    std::vector<std::shared_ptr<Outfit>>
+    filterOutfitsBySymbol(const std::string &username, const std::vector<Symbol> &seasons);
+
+    // save outfit (cu DuplicateOutfitPolicy::Reject, esueaza daca alt outfit are aceleasi articole)
     bool saveOutfit(const std::string &username, const Outfit &outfit);
+    std::future<bool> submitSaveOutfit(const std::string &username, const Outfit &outfit);
+    // mai multe outfit-uri intr-o singura scriere; cu DuplicateOutfitPolicy::Reject nu se salveaza
+    // niciunul daca unul ar dubla alt outfit (deja salvat sau din acelasi lot)
+    bool saveOutfits(const std::string &username, std::span<const std::shared_ptr<Outfit>> outfits);
+    std::future<bool> submitSaveOutfits(const std::string &username, std::span<const std::shared_ptr<Outfit>> outfits);
+
+    // outfit-ul salvat (alt id) cu exact aceleasi articole ca `outfit`, sau nullptr
+    std::shared_ptr<Outfit> findDuplicateOutfit(const std::string &username, const Outfit &outfit);
+
+    // perechile de outfit-uri cu similaritatea Jaccard a articolelor >= threshold (MinHash + verificare exacta)
+    std::vector<NearDuplicate> findNearDuplicateOutfits(const std::string &username, double threshold = 0.8);
 
     // delete outfit
     bool deleteOutfit(const std::string &username, const std::string &outfitId);
+    bool deleteOutfits(const std::string &username, std::span<const std::string> outfitIds);
+    std::future<bool> submitDeleteOutfit(const std::string &username, const std::string &outfitId);
+    std::future<bool> submitDeleteOutfits(const std::string &username, std::span<const std::string> outfitIds);
 
-    // today's suggestion
+    // today's suggestion: esantionare ponderata dupa sezon, purtari si sugestii recente
+    // (aceeasi sugestie pe parcursul zilei)
     std::shared_ptr<Outfit> getTodaySuggestion(const std::string &username);
 
+    // inregistreaza purtarea unui outfit ("DD-MM-YYYY"; gol = azi): intra in jurnalul de purtari
+    // (persistat) si in ponderile sugestiilor; false daca outfit-ul / articolul nu exista
+    bool markOutfitWorn(const std::string &username, const std::string &outfitId, const std::string &date = "");
+    bool markOutfitWorn(const std::string &username, const std::string &outfitId, Date day);
+    std::future<bool> submitMarkOutfitWorn(const std::string &username, const std::string &outfitId, Date day);
+    // un articol purtat separat (nu ca parte a unui outfit)
+    bool markItemWorn(const std::string &username, int itemId, Date day);
+    std::future<bool> submitMarkItemWorn(const std::string &username, int itemId, Date day);
+
+    // outfit-uri noi compuse din articolele user-ului, pentru sezonul curent (cele mai bune `count`)
+    std::vector<OutfitGenerator::Result> generateOutfits(const std::string &username, std::size_t count = 20);
+
     // Observer: înregistrează callback la schimbarea articolelor
     void setItemsChangedCallback(ItemsChangedCallback cb)
     {
+        std::unique_lock lock(mutex_);
         itemsChangedCallback_ = std::move(cb);
     }
 
     // Observer: înregistrează callback la schimbarea outfit-urilor
     void setOutfitsChangedCallback(OutfitsChangedCallback cb)
     {
+        std::unique_lock lock(mutex_);
         outfitsChangedCallback_ = std::move(cb);
     }
 
@@ -74,4 +563,53 @@ public:
 
     // Returnează numărul de outfit-uri pentru user
     std::size_t getOutfitCount(const std::string &username);
+
+    // statistici calculate prin scanarea coloanelor din WardrobeTable (string gol = orice valoare)
+    std::size_t countClothingItems(const std::string &username, const std::string &color, const std::string &category);
+    std::size_t countClothingItemsWithMaterial(const std::string &username, const std::string &material);
+
+    // (valoare, numar de articole), ordonate descrescator dupa numar
+    using Histogram = std::vector<std::pair<std::string, std::size_t>>;
+    Histogram getColorHistogram(const std::string &username);
+    Histogram getCategoryHistogram(const std::string &username);
+    Histogram getMaterialHistogram(const std::string &username);
+
+    // statisticile de purtare, citite din agregatele WearLog (fara reparcurgerea istoricului)
+    struct WearStats
+    {
+        std::uint64_t outfitWears = 0;
+        std::uint64_t itemWears = 0;
+        std::size_t neverWorn = 0; // articole existente niciodata purtate
+        // cele mai purtate outfit-uri in ultimele `windowDays` zile, descrescator
+        std::vector<std::pair<std::shared_ptr<Outfit>, std::uint32_t>> mostWorn;
+        int windowDays = 0;
+        Histogram colors; // purtari pe culoare / categorie (articolele existente)
+        Histogram categories;
+    };
+    WearStats getWearStats(const std::string &username, std::size_t mostWornCount = 5);
+    // purtarile unui articol (pentru cost per purtare)
+    WearLog::ItemWear getItemWear(const std::string &username, int itemId);
+    std::vector<int> getNeverWornItems(const std::string &username);
+    // inregistrarile din [from, to], crescator dupa zi
+    std::vector<WearRecord> getWearRecords(const std::string &username, Date from, Date to);
+
+    // export: garderoba (cu toate imaginile incluse) intr-un fisier WardrobeSnapshot
+    bool exportWardrobe(const std::string &username, const std::string &path);
+    // import: adauga userului garderoba din fisier, cu id-uri noi pentru articole si outfit-uri;
+    // false daca fisierul nu e valid sau o scriere a esuat
+    bool importWardrobe(const std::string &username, const std::string &path);
+
+    // elibereaza cache-ul si handle-ul unui user (ex. la logout)
+    void evictCache(const std::string &username)
+    {
+        WriteLock lock = writeLock(username);
+        UserShard &shard = shardFor(username);
+        shard.caches.erase(username);
+        shard.handles.erase(username);
+        // cache-ul se reincarca oricum la urmatorul acces
+        takeStale(username);
+    }
+
+    // memoria estimata a cache-ului unui user (0 daca nu e incarcat); nu il incarca
+    std::size_t getCacheBytes(const std::string &username) const;
 };
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Data calendaristica (fara ora) ca numar de zile de la 01-01-1970: un int32, trivial copiabil.
+// Comparatiile, sortarea si diferentele in zile sunt operatii pe intregi; forma text
+// "DD-MM-YYYY" apare doar la granita (Core Data, log-ul NativeBackend, bridge-ul catre Swift).
+// Default-constructed = data lipsa (ex. userul nu s-a logat niciodata); e mai mica decat orice data.
+class Date
+{
+public:
+    struct Civil
+    {
+        int year;
+        unsigned month; // 1-12
+        unsigned day;   // 1-31
+    };
+
+    // lungimea formei text "DD-MM-YYYY"
+    static constexpr std::size_t TextLength = 10;
+
+    constexpr Date() = default;
+
+    static constexpr Date fromDayNumber(std::int32_t days) { return Date(days); }
+
+    // nullopt pentru o data care nu exista in calendar (ex. 29-02-2023)
+    static constexpr std::optional<Date> fromCivil(int year, unsigned month, unsigned day)
+    {
+        if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month))
+            return std::nullopt;
+        return Date(daysFromCivil(year, month, day));
+    }
+
+    // "DD-MM-YYYY" (an cu 4 cifre), fara exceptii; nullopt daca textul nu e o data valida
+    static constexpr std::optional<Date> parse(std::string_view text)
+    {
+        if (text.size() != TextLength || text[2] != '-' || text[5] != '-')
+            return std::nullopt;
+        int d = 0, m = 0, y = 0;
+        if (!digits(text.substr(0, 2), d) || !digits(text.substr(3, 2), m) || !digits(text.substr(6, 4), y))
+            return std::nullopt;
+        return fromCivil(y, static_cast<unsigned>(m), static_cast<unsigned>(d));
+    }
+
+    // conversie din forma veche (string-uri din Core Data / log): text gol sau invalid -> data lipsa
+    static constexpr Date fromString(std::string_view text) { return parse(text).value_or(Date()); }
+
+    // data de azi (LOCAL TIME)
+    static Date today()
+    {
+        std::time_t now = std::time(nullptr);
+        std::tm tm{};
+#if defined(_WIN32)
+        localtime_s(&tm, &now);
+#else
+        localtime_r(&now, &tm);
+#endif
+        return Date(daysFromCivil(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1), static_cast<unsigned>(tm.tm_mday)));
+    }
+
+    constexpr bool empty() const { return days_ == None; }
+    constexpr std::int32_t dayNumber() const { return days_; }
+
+    constexpr Civil civil() const
+    {
+        // algoritmul civil_from_days (H. Hinnant), exact pentru tot intervalul int32
+        const std::int64_t z = static_cast<std::int64_t>(days_) + 719468;
+        const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const std::int64_t doe = z - era * 146097;
+        const std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const std::int64_t mp = (5 * doy + 2) / 153;
+        const unsigned day = static_cast<unsigned>(doy - (153 * mp + 2) / 5 + 1);
+        const unsigned month = static_cast<unsigned>(mp < 10 ? mp + 3 : mp - 9);
+        return Civil{static_cast<int>(yoe + era * 400 + (month <= 2)), month, day};
+    }
+
+    // "DD-MM-YYYY" fara alocare; anul se scrie pe 4 cifre (0000-9999)
+    constexpr std::array<char, TextLength> format() const
+    {
+        const Civil c = civil();
+        const unsigned y = static_cast<unsigned>(c.year < 0 ? 0 : c.year % 10000);
+        return {static_cast<char>('0' + c.day / 10), static_cast<char>('0' + c.day % 10), '-',
+                static_cast<char>('0' + c.month / 10), static_cast<char>('0' + c.month % 10), '-',
+                static_cast<char>('0' + y / 1000), static_cast<char>('0' + y / 100 % 10),
+                static_cast<char>('0' + y / 10 % 10), static_cast<char>('0' + y % 10)};
+    }
+
+    // forma veche; "" pentru data lipsa
+    std::string toString() const
+    {
+        if (empty())
+            return {};
+        const auto text = format();
+        return std::string(text.data(), text.size());
+    }
+
+    friend constexpr bool operator==(Date, Date) = default;
+    friend constexpr std::strong_ordering operator<=>(Date, Date) = default;
+
+    // zile intre doua date (a - b)
+    friend constexpr int operator-(Date a, Date b) { return a.days_ - b.days_; }
+    friend constexpr Date operator+(Date date, int days) { return Date(date.days_ + days); }
+    friend constexpr Date operator-(Date date, int days) { return Date(date.days_ - days); }
+
+private:
+    static constexpr std::int32_t None = std::numeric_limits<std::int32_t>::min();
+
+    constexpr explicit Date(std::int32_t days) : days_(days) {}
+
+    static constexpr bool isLeap(int year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+
+    static constexpr unsigned daysInMonth(int year, unsigned month)
+    {
+        constexpr unsigned lengths[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return month == 2 && isLeap(year) ? 29 : lengths[month - 1];
+    }
+
+    // algoritmul days_from_civil (H. Hinnant)
+    static constexpr std::int32_t daysFromCivil(int year, unsigned month, unsigned day)
+    {
+        const std::int64_t y = static_cast<std::int64_t>(year) - (month <= 2);
+        const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const std::int64_t yoe = y - era * 400;
+        const std::int64_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return static_cast<std::int32_t>(era * 146097 + doe - 719468);
+    }
+
+    static constexpr bool digits(std::string_view text, int &out)
+    {
+        out = 0;
+        for (char c : text)
+        {
+            if (c < '0' || c > '9')
+                return false;
+            out = out * 10 + (c - '0');
+        }
+        return true;
+    }
+
+    std::int32_t days_ = None;
+};
+
+static_assert(std::is_trivially_copyable_v<Date> && sizeof(Date) == sizeof(std::int32_t));
+static_assert(Date::parse("01-01-1970")->dayNumber() == 0);
+static_assert(Date::parse("29-02-2024") && !Date::parse("29-02-2023") && !Date::parse("1-01-2024"));
+static_assert(*Date::parse("01-03-2024") - *Date::parse("28-02-2024") == 2);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "CancellationToken.hpp"
+
+// Pool mic de thread-uri pentru variantele asincrone ale API-ului (citiri, conversii).
+// Spre deosebire de PersistenceWorker, job-urile pot rula in paralel si nu au ordine garantata.
+// Un job al carui token a fost anulat cat a stat in coada nu mai ruleaza: future-ul
+// primeste OperationCancelled. Odata pornit, job-ul isi verifica singur token-ul.
+class Executor
+{
+public:
+    // 0 = dupa numarul de nuclee (cel putin 2, cel mult 4: restul raman pentru UI)
+    explicit Executor(unsigned threads = 0);
+    ~Executor();
+
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+
+    template <typename F>
+    auto submit(CancellationToken token, F &&work) -> std::future<std::invoke_result_t<F &>>
+    {
+        using Result = std::invoke_result_t<F &>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            [token, work = std::forward<F>(work)]() mutable -> Result
+            {
+                token.throwIfCancelled();
+                return work();
+            });
+        std::future<Result> done = task->get_future();
+        enqueue([task] { (*task)(); });
+        return done;
+    }
+
+    template <typename F>
+    auto submit(F &&work) -> std::future<std::invoke_result_t<F &>>
+    {
+        return submit(CancellationToken(), std::forward<F>(work));
+    }
+
+    std::size_t threadCount() const { return threads_.size(); }
+
+private:
+    void enqueue(std::function<void()> job);
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+};
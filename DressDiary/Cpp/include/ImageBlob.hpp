@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+// Imagine imutabila, partajata prin reference counting.
+// Copierea unui ImageBlob copiaza doar un shared_ptr; bufferul nu este duplicat.
+// Continutul poate fi incarcat lazy (la primul acces), poate impacheta fara copiere
+// un buffer extern (ex. NSData) sau poate fi un fisier mapat in memorie.
+class ImageBlob
+{
+public:
+    using Loader = std::function<ImageBlob()>;
+
+private:
+    struct State
+    {
+        mutable std::once_flag once;
+        mutable Loader loader;
+        mutable const std::uint8_t *data = nullptr;
+        mutable std::size_t size = 0;
+        // tine in viata memoria la care arata `data`
+        mutable std::shared_ptr<const void> owner;
+        // cheia din BlobStore (goala daca imaginea nu provine dintr-un depozit)
+        std::string key;
+
+        void ensureLoaded() const
+        {
+            std::call_once(once, [this]
+            {
+                if (!loader)
+                    return;
+                ImageBlob loaded = loader();
+                loader = nullptr;
+                if (loaded.state_ && loaded.state_.get() != this)
+                {
+                    loaded.state_->ensureLoaded();
+                    data = loaded.state_->data;
+                    size = loaded.state_->size;
+                    owner = loaded.state_->owner;
+                }
+            });
+        }
+    };
+
+    std::shared_ptr<const State> state_;
+
+    static std::shared_ptr<State> makeLoaded(const std::uint8_t *data, std::size_t size, std::shared_ptr<const void> owner)
+    {
+        auto st = std::make_shared<State>();
+        st->data = data;
+        st->size = size;
+        st->owner = std::move(owner);
+        // marcam once_flag ca executat
+        std::call_once(st->once, [] {});
+        return st;
+    }
+
+public:
+    ImageBlob() = default;
+
+    // compatibilitate cu codul care construia articole din std::vector<uint8_t>
+    ImageBlob(std::vector<std::uint8_t> bytes)
+    {
+        if (bytes.empty())
+            return;
+        auto buffer = std::make_shared<const std::vector<std::uint8_t>>(std::move(bytes));
+        state_ = makeLoaded(buffer->data(), buffer->size(), buffer);
+    }
+
+    // impacheteaza fara copiere un buffer extern; `owner` il tine in viata
+    static ImageBlob wrap(const std::uint8_t *data, std::size_t size, std::shared_ptr<const void> owner)
+    {
+        ImageBlob blob;
+        if (data && size > 0)
+            blob.state_ = makeLoaded(data, size, std::move(owner));
+        return blob;
+    }
+
+    // continutul este produs de `loader` abia la primul acces (data/size/bytes)
+    static ImageBlob lazy(Loader loader, std::string key = "")
+    {
+        ImageBlob blob;
+        auto st = std::make_shared<State>();
+        st->loader = std::move(loader);
+        st->key = std::move(key);
+        blob.state_ = std::move(st);
+        return blob;
+    }
+
+    // mapeaza (lazy) un fisier in memorie; fisierul nu este citit pana la primul acces
+    static ImageBlob mapFile(const std::string &path, std::string key = "")
+    {
+        return lazy([path]() -> ImageBlob
+        {
+#if !defined(_WIN32)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return {};
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+            {
+                ::close(fd);
+                return {};
+            }
+            std::size_t length = static_cast<std::size_t>(st.st_size);
+            void *addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (addr == MAP_FAILED)
+                return {};
+            std::shared_ptr<const void> mapping(addr, [length](const void *p)
+            {
+                ::munmap(const_cast<void *>(p), length);
+            });
+            return wrap(static_cast<const std::uint8_t *>(addr), length, std::move(mapping));
+#else
+            std::ifstream in(path, std::ios::binary);
+            std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            return ImageBlob(std::move(bytes));
+#endif
+        }, std::move(key));
+    }
+
+    // acces (declanseaza incarcarea daca blob-ul e lazy)
+    const std::uint8_t *data() const
+    {
+        if (!state_)
+            return nullptr;
+        state_->ensureLoaded();
+        return state_->data;
+    }
+
+    std::size_t size() const
+    {
+        if (!state_)
+            return 0;
+        state_->ensureLoaded();
+        return state_->size;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    std::span<const std::uint8_t> bytes() const { return {data(), size()}; }
+
+    // true daca exista o imagine asociata (nu declanseaza incarcarea)
+    bool hasSource() const { return state_ != nullptr; }
+
+    // cheia de continut din BlobStore (nu declanseaza incarcarea)
+    const std::string &key() const
+    {
+        static const std::string none;
+        return state_ ? state_->key : none;
+    }
+
+    // copie explicita (doar unde e nevoie de un buffer proprietar)
+    std::vector<std::uint8_t> toVector() const
+    {
+        auto b = bytes();
+        return std::vector<std::uint8_t>(b.begin(), b.end());
+    }
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "ImageBlob.hpp"
+#include "ItemRecord.hpp"
+#include "SymbolTable.hpp"
+
+// Lot de articole pentru bridge: un singur buffer de record-uri cu layout fix, in loc de
+// un obiect (sau un dictionar) per articol. Campurile text sunt indecsi intr-un pool de
+// simboluri distincte, deci fiecare valoare se converteste o singura data pe lot.
+// Imaginile raman ImageBlob-urile din cache (buffer partajat, fara copiere).
+class ItemBatch
+{
+public:
+    // aceeasi ordine ca alternativele din ItemPayload
+    enum class Kind : std::uint8_t
+    {
+        None,
+        Pants,
+        Top,
+        Jacket,
+        Shoes
+    };
+
+    static constexpr std::uint32_t NoString = UINT32_MAX;
+
+    struct Record
+    {
+        std::int32_t id;
+        std::uint32_t category; // index in strings()
+        std::uint32_t color;
+        std::uint32_t materialsBegin; // interval in materialIndices()
+        std::uint32_t materialsCount;
+        std::uint32_t pantWaist; // NoString daca nu e pants
+        std::uint32_t topSleeveType;
+        std::uint32_t topNeckline;
+        float pantLength;
+        float shoeSize;
+        Kind kind;
+        bool jacketWaterproof;
+    };
+    static_assert(std::is_trivially_copyable_v<Record>);
+
+    ItemBatch() = default;
+    explicit ItemBatch(std::span<const ItemRecord> items);
+
+    void reserve(std::size_t count);
+    void push(const ItemRecord &item);
+
+    std::size_t size() const { return records_.size(); }
+    bool empty() const { return records_.empty(); }
+    const Record &operator[](std::size_t i) const { return records_[i]; }
+    std::span<const Record> records() const { return records_; }
+
+    // simbolurile distincte din lot, in ordinea primei aparitii
+    std::span<const Symbol> strings() const { return strings_; }
+    std::span<const std::uint32_t> materials(const Record &record) const
+    {
+        return std::span<const std::uint32_t>(materials_).subspan(record.materialsBegin, record.materialsCount);
+    }
+    const ImageBlob &image(std::size_t i) const { return images_[i]; }
+
+private:
+    std::uint32_t intern(Symbol symbol);
+
+    std::vector<Record> records_;
+    std::vector<std::uint32_t> materials_;
+    std::vector<ImageBlob> images_;
+    std::vector<Symbol> strings_;
+    std::unordered_map<Symbol, std::uint32_t> stringIndex_;
+};
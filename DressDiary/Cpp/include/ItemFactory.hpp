@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include "ClothingItem.hpp"
+#include "ItemRecord.hpp"
 #include "Items.hpp"
 #include "Outfit.hpp"
 
@@ -15,11 +16,62 @@ public:
         return std::make_shared<T>(std::forward<Args>(args)...);
     }
 
+    // record plat pentru cache / backend-uri; payload-ul lipsa devine cel implicit al categoriei
+    static ItemRecord createRecord(int id,
+                                   const std::string &color,
+                                   const std::vector<std::string> &materials,
+                                   const std::string &category,
+                                   ImageBlob image,
+                                   ItemPayload payload = std::monostate{})
+    {
+        auto &table = SymbolTable::getInstance();
+        ItemRecord record;
+        record.id = id;
+        record.color = table.intern(color);
+        record.category = table.intern(category);
+        for (const auto &m : materials)
+            record.materials.push_back(table.intern(m));
+        record.image = std::move(image);
+        record.payload = std::holds_alternative<std::monostate>(payload) ? defaultPayload(record.category)
+                                                                          : std::move(payload);
+        // aceeasi rotunjire ca in constructorii Pants / Shoes
+        if (auto *pants = std::get_if<PantsData>(&record.payload))
+            pants->lungime = roundToOneDecimal(pants->lungime);
+        else if (auto *shoes = std::get_if<ShoesData>(&record.payload))
+            shoes->size = roundToOneDecimal(shoes->size);
+        return record;
+    }
+
+    // adaptor invers: record -> ierarhia ClothingItem (pentru codul care lucreaza cu obiecte)
+    static std::shared_ptr<ClothingItem> fromRecord(const ItemRecord &r)
+    {
+        const auto &table = SymbolTable::getInstance();
+        const std::string &color = r.colorName();
+        const std::string &category = r.categoryName();
+        const std::vector<std::string> mats = r.materialNames();
+        return std::visit(overloaded{
+            [&](std::monostate) -> std::shared_ptr<ClothingItem> {
+                return create<ClothingItem>(r.id, color, mats, category, r.image);
+            },
+            [&](const PantsData &p) -> std::shared_ptr<ClothingItem> {
+                return create<Pants>(r.id, color, mats, category, r.image, p.lungime, table.name(p.talie));
+            },
+            [&](const TopData &t) -> std::shared_ptr<ClothingItem> {
+                return create<Top>(r.id, color, mats, category, r.image, table.name(t.maneca), table.name(t.decolteu));
+            },
+            [&](const JacketData &j) -> std::shared_ptr<ClothingItem> {
+                return create<Jacket>(r.id, color, mats, category, r.image, j.waterproof);
+            },
+            [&](const ShoesData &sh) -> std::shared_ptr<ClothingItem> {
+                return create<Shoes>(r.id, color, mats, category, r.image, sh.size);
+            }}, r.payload);
+    }
+
     // crearea unui outfit
     static std::shared_ptr<Outfit> createOutfit(
         const std::string& id,
         const std::string& name,
-        const std::string& dateAdded,
+        Date dateAdded,
         const std::string& season,
         const std::vector<std::shared_ptr<ClothingItem>>& items = {},
         const std::vector<int>& itemIds = {},
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+#include "ImageBlob.hpp"
+#include "SymbolTable.hpp"
+
+// campurile specifice fiecarei categorii (valorile text sunt internate)
+struct PantsData
+{
+    float lungime = 0.0f;
+    Symbol talie = symbols::Empty;
+};
+
+struct TopData
+{
+    Symbol maneca = symbols::Empty;
+    Symbol decolteu = symbols::Empty;
+};
+
+struct JacketData
+{
+    bool waterproof = false;
+};
+
+struct ShoesData
+{
+    float size = 0.0f;
+};
+
+// monostate = categorie fara campuri specifice
+using ItemPayload = std::variant<std::monostate, PantsData, TopData, JacketData, ShoesData>;
+
+// payload-ul implicit pentru o categorie
+inline ItemPayload defaultPayload(Symbol category)
+{
+    switch (category)
+    {
+    case symbols::Pants:
+        return PantsData{};
+    case symbols::Top:
+        return TopData{};
+    case symbols::Jacket:
+        return JacketData{};
+    case symbols::Shoes:
+        return ShoesData{};
+    default:
+        return std::monostate{};
+    }
+}
+
+// std::visit cu cate o lambda pentru fiecare alternativa
+template <typename... Fs>
+struct overloaded : Fs...
+{
+    using Fs::operator()...;
+};
+template <typename... Fs>
+overloaded(Fs...) -> overloaded<Fs...>;
+
+// Lista de materiale cu primele valori tinute inline; de obicei un articol
+// are 1-3 materiale, deci nu se aloca nimic pe heap.
+class MaterialSet
+{
+    static constexpr std::size_t InlineCapacity = 4;
+
+    std::array<Symbol, InlineCapacity> inline_{};
+    std::uint32_t size_ = 0;
+    std::vector<Symbol> overflow_; // toate valorile, doar cand size_ > InlineCapacity
+
+public:
+    MaterialSet() = default;
+    MaterialSet(std::span<const Symbol> values) { assign(values); }
+
+    void assign(std::span<const Symbol> values)
+    {
+        clear();
+        for (Symbol value : values)
+            push_back(value);
+    }
+
+    void push_back(Symbol value)
+    {
+        if (size_ < InlineCapacity)
+            inline_[size_] = value;
+        else
+        {
+            if (size_ == InlineCapacity)
+                overflow_.assign(inline_.begin(), inline_.end());
+            overflow_.push_back(value);
+        }
+        ++size_;
+    }
+
+    void clear()
+    {
+        size_ = 0;
+        overflow_.clear();
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const Symbol *begin() const { return size_ <= InlineCapacity ? inline_.data() : overflow_.data(); }
+    const Symbol *end() const { return begin() + size_; }
+    Symbol operator[](std::size_t i) const { return begin()[i]; }
+
+    bool operator==(const MaterialSet &other) const
+    {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+};
+
+// Reprezentarea plata a unui articol: fara mostenire, fara RTTI, fara alocari proprii.
+// Cache-ul DataManager si backend-urile tin articolele ca std::vector<ItemRecord>
+// (o singura alocare pe garderoba); tipul se afla prin std::visit pe payload.
+// Ierarhia ClothingItem ramane pentru codul vechi (vezi ItemFactory::fromRecord).
+struct ItemRecord
+{
+    int id = 0;
+    Symbol color = symbols::Empty;
+    Symbol category = symbols::Empty;
+    MaterialSet materials;
+    ImageBlob image;
+    ItemPayload payload;
+
+    const std::string &colorName() const { return SymbolTable::getInstance().name(color); }
+    const std::string &categoryName() const { return SymbolTable::getInstance().name(category); }
+
+    std::vector<std::string> materialNames() const
+    {
+        std::vector<std::string> names;
+        names.reserve(materials.size());
+        for (Symbol m : materials)
+            names.push_back(SymbolTable::getInstance().name(m));
+        return names;
+    }
+};
@@ -2,22 +2,26 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 #include "ClothingItem.hpp"
 #include "Utilities.hpp"
 
 // pantaloni
-class Pants : public virtual ClothingItem
+class Pants : public ClothingItem
 {
     float lungime;
     std::string talie;
 
 public:
-    Pants(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const std::vector<std::uint8_t> &image_, float lungime_, std::string talie_)
+    Pants(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const ImageBlob &image_, float lungime_, std::string talie_)
         : ClothingItem(id_, color_, materials_, category_, image_), lungime(lungime_), talie(talie_)
     {
         lungime = roundToOneDecimal(lungime);
     }
 
+    std::shared_ptr<ClothingItem> clone() const override { return std::make_shared<Pants>(*this); }
+    ItemPayload payload() const override { return PantsData{lungime, SymbolTable::getInstance().intern(talie)}; }
+
     // getters
     float getLungime() const { return lungime; }
     const std::string &getTalie() const { return talie; }
@@ -30,39 +34,52 @@ class Top : public ClothingItem
     std::string tipDecolteu;
 
 public:
-    Top(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const std::vector<std::uint8_t> &image_, const std::string &tipManeca_, const std::string &tipDecolteu_)
+    Top(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const ImageBlob &image_, const std::string &tipManeca_, const std::string &tipDecolteu_)
         : ClothingItem(id_, color_, materials_, category_, image_), tipManeca(tipManeca_), tipDecolteu(tipDecolteu_) {}
 
+    std::shared_ptr<ClothingItem> clone() const override { return std::make_shared<Top>(*this); }
+    ItemPayload payload() const override
+    {
+        auto &table = SymbolTable::getInstance();
+        return TopData{table.intern(tipManeca), table.intern(tipDecolteu)};
+    }
+
     // getters
     const std::string &getManeca() const { return tipManeca; }
     const std::string &getDecolteu() const { return tipDecolteu; }
 };
 
 // jachete
-class Jacket : public virtual ClothingItem
+class Jacket : public ClothingItem
 {
     bool waterproof;
 
 public:
-    Jacket(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const std::vector<std::uint8_t> &image_, bool waterproof_)
+    Jacket(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const ImageBlob &image_, bool waterproof_)
         : ClothingItem(id_, color_, materials_, category_, image_), waterproof(waterproof_) {}
 
+    std::shared_ptr<ClothingItem> clone() const override { return std::make_shared<Jacket>(*this); }
+    ItemPayload payload() const override { return JacketData{waterproof}; }
+
     // getters
     bool isWaterproof() const { return waterproof; }
 };
 
 // shoes
-class Shoes : public virtual ClothingItem
+class Shoes : public ClothingItem
 {
     float size;
 
 public:
-    Shoes(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const std::vector<std::uint8_t> &image_, float size_)
+    Shoes(int id_, const std::string &color_, const std::vector<std::string> &materials_, const std::string &category_, const ImageBlob &image_, float size_)
         : ClothingItem(id_, color_, materials_, category_, image_), size(size_)
     {
         size = roundToOneDecimal(size);
     }
 
+    std::shared_ptr<ClothingItem> clone() const override { return std::make_shared<Shoes>(*this); }
+    ItemPayload payload() const override { return ShoesData{size}; }
+
     // getters
     int getSizeShoes() const { return size; }
 };
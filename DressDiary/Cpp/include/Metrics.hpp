@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Masuratori pentru caile fierbinti (DataManager, adaptoarele objc*, conversiile din bridge).
+// Cu DRESSDIARY_METRICS=0 macro-urile de mai jos nu genereaza niciun cod (nici argumentele
+// nu se evalueaza). Implicit sunt active doar in build-urile de debug.
+#ifndef DRESSDIARY_METRICS
+#if defined(DEBUG) && DEBUG
+#define DRESSDIARY_METRICS 1
+#else
+#define DRESSDIARY_METRICS 0
+#endif
+#endif
+
+// Starea agregata la un moment dat (valorile cumulate de la pornire sau de la ultimul reset).
+struct MetricsSnapshot
+{
+    struct Timer
+    {
+        std::string name;
+        std::uint64_t count = 0;
+        double totalMs = 0.0;
+        double p50Ms = 0.0; // aproximate: limita superioara a bucket-ului din histograma
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    struct Counter
+    {
+        std::string name;
+        std::uint64_t value = 0;
+    };
+
+    std::vector<Timer> timers;
+    std::vector<Counter> counters;
+};
+
+// design pattern - Singleton
+// Fiecare punct de masurare isi rezolva o singura data (static local) intrarea din registru;
+// apoi inregistrarea unei durate e doar cateva operatii atomice relaxate, fara lock.
+// Evenimentele pentru trace (Chrome trace-event JSON) se pastreaza doar cat timp tracing-ul e pornit.
+class Metrics
+{
+public:
+    // histograma pe bucket-uri log-lineare: 4 sub-bucket-uri pentru fiecare putere a lui 2 (ns)
+    static constexpr std::size_t SubBuckets = 4;
+    static constexpr std::size_t Buckets = 64 * SubBuckets;
+
+    struct Timer
+    {
+        explicit Timer(std::string n) : name(std::move(n)) {}
+
+        std::string name;
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> totalNs{0};
+        std::atomic<std::uint64_t> maxNs{0};
+        std::array<std::atomic<std::uint64_t>, Buckets> buckets{};
+
+        void record(std::uint64_t ns);
+    };
+
+    struct Counter
+    {
+        explicit Counter(std::string n) : name(std::move(n)) {}
+
+        std::string name;
+        std::atomic<std::uint64_t> value{0};
+
+        void add(std::uint64_t n) { value.fetch_add(n, std::memory_order_relaxed); }
+    };
+
+    static Metrics &getInstance()
+    {
+        static Metrics instance;
+        return instance;
+    }
+
+    // intrarile nu se sterg niciodata (reset doar le zerifica), deci pointerii raman valizi
+    Timer *timer(const char *name);
+    Counter *counter(const char *name);
+
+    MetricsSnapshot snapshot() const;
+    void reset();
+
+    // evenimentele de trace (cel mult `capacity`, cele vechi se pierd)
+    void setTracing(bool enabled, std::size_t capacity = 1 << 16);
+    bool isTracing() const { return tracing_.load(std::memory_order_relaxed); }
+    void traceEvent(const Timer &timer, std::chrono::steady_clock::time_point start, std::uint64_t durationNs);
+    // {"traceEvents": [...]} pentru chrome://tracing / Perfetto
+    std::string traceJSON() const;
+
+    static std::size_t bucketOf(std::uint64_t ns);
+    static std::uint64_t bucketUpperNs(std::size_t bucket);
+
+private:
+    Metrics();
+    Metrics(const Metrics &) = delete;
+    Metrics &operator=(const Metrics &) = delete;
+
+    struct TraceEvent
+    {
+        const Timer *timer;
+        std::int64_t startUs;
+        std::int64_t durationUs;
+        std::uint32_t thread;
+    };
+
+    mutable std::mutex mutex_;
+    std::deque<Timer> timers_; // deque: adresele nu se schimba la adaugare
+    std::deque<Counter> counters_;
+
+    std::atomic<bool> tracing_{false};
+    mutable std::mutex traceMutex_;
+    std::vector<TraceEvent> trace_;
+    std::size_t traceNext_ = 0;
+    std::size_t traceCapacity_ = 0;
+    std::chrono::steady_clock::time_point origin_;
+};
+
+// masoara durata blocului curent
+class ScopedTimer
+{
+    Metrics::Timer *timer_;
+    std::chrono::steady_clock::time_point start_;
+
+public:
+    explicit ScopedTimer(Metrics::Timer *timer) : timer_(timer), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer()
+    {
+        auto end = std::chrono::steady_clock::now();
+        auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_).count());
+        timer_->record(ns);
+        Metrics &metrics = Metrics::getInstance();
+        if (metrics.isTracing())
+            metrics.traceEvent(*timer_, start_, ns);
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+};
+
+#define DD_METRICS_CONCAT_(a, b) a##b
+#define DD_METRICS_CONCAT(a, b) DD_METRICS_CONCAT_(a, b)
+
+#if DRESSDIARY_METRICS
+// timer pentru tot blocul curent; `name` trebuie sa fie un literal
+#define DD_METRIC_SCOPE(name)                                                                                  \
+    static Metrics::Timer *const DD_METRICS_CONCAT(ddMetricTimer_, __LINE__) = Metrics::getInstance().timer(name); \
+    ScopedTimer DD_METRICS_CONCAT(ddMetricScope_, __LINE__)(DD_METRICS_CONCAT(ddMetricTimer_, __LINE__))
+// aduna `amount` la contorul `name`
+#define DD_METRIC_COUNT(name, amount)                                                             \
+    do                                                                                            \
+    {                                                                                             \
+        static Metrics::Counter *const ddMetricCounter_ = Metrics::getInstance().counter(name);   \
+        ddMetricCounter_->add(static_cast<std::uint64_t>(amount));                                \
+    } while (0)
+#else
+#define DD_METRIC_SCOPE(name) static_cast<void>(0)
+#define DD_METRIC_COUNT(name, amount) static_cast<void>(0)
+#endif
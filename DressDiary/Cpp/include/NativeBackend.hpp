@@ -0,0 +1,163 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <span>
+#include <utility>
+#include "StorageBackend.hpp"
+#include "BlobStore.hpp"
+
+// Backend de persistenta scris in C++ pur (fara Objective-C / Core Data).
+// Fiecare operatie de scriere este adaugata intr-un log append-only, iar starea
+// curenta este tinuta intr-un index in memorie reconstruit la deschidere (replay).
+// Cu un path gol backend-ul ruleaza doar in memorie (teste, benchmark-uri, Linux).
+// Imaginile care au deja o cheie in BlobStore sunt salvate in log doar ca referinta.
+class NativeBackend : public StorageBackend
+{
+public:
+    explicit NativeBackend(const std::string &logPath = "", std::shared_ptr<BlobStore> blobs = nullptr);
+    ~NativeBackend() override;
+
+    NativeBackend(const NativeBackend &) = delete;
+    NativeBackend &operator=(const NativeBackend &) = delete;
+
+    // user operations
+    bool createUser(const std::string &username, const std::string &name, const std::string &password) override;
+    std::shared_ptr<User> loginUser(const std::string &username, const std::string &password) override;
+    bool updateUserLoginMeta(const UserHandle &user, Date lastLoginDate, int streak) override;
+    bool updateUserDarkMode(const UserHandle &user, bool isDarkMode) override;
+    std::shared_ptr<User> recoverUser(const std::string &username) override;
+    UserHandlePtr resolveUser(const std::string &username) override;
+
+    // clothing item operations
+    std::vector<ItemRecord> fetchClothingItems(const UserHandle &user) override;
+    std::vector<ItemRecord> fetchClothingItemPage(const UserHandle &user, int afterId, std::size_t limit) override;
+    bool saveClothingItem(const UserHandle &user, const ItemRecord &item) override;
+    bool deleteClothingItem(const UserHandle &user, int itemId) override;
+    bool saveClothingItems(const UserHandle &user, std::span<const ItemRecord> items) override;
+    bool deleteClothingItems(const UserHandle &user, std::span<const int> itemIds) override;
+
+    // outfit operations
+    std::vector<std::shared_ptr<Outfit>> fetchOutfits(const UserHandle &user) override;
+    std::vector<std::shared_ptr<Outfit>> fetchOutfitPage(const UserHandle &user, const std::string &afterId,
+                                                         std::size_t limit) override;
+    bool saveOutfit(const UserHandle &user, const Outfit &outfit) override;
+    bool saveOutfits(const UserHandle &user, std::span<const Outfit> outfits) override;
+    bool deleteOutfit(const UserHandle &user, const std::string &outfitId) override;
+    bool deleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds) override;
+
+    // wear log
+    bool appendWearRecords(const UserHandle &user, std::span<const WearRecord> records) override;
+    std::vector<WearRecord> fetchWearRecords(const UserHandle &user) override;
+    // un singur lot pentru articole, outfit-uri si purtari
+    bool importWardrobe(const UserHandle &user, std::span<const ItemRecord> items,
+                        std::span<const Outfit> outfits, std::span<const WearRecord> wears) override;
+
+    // generatia log-ului amestecata cu pozitia (in log) a ultimei inregistrari de garderoba a userului;
+    // la replay se reface identic. Log-ul se sincronizeaza (fsync) inainte ca valoarea sa fie intoarsa.
+    std::uint64_t dataRevision(const UserHandle &user) override;
+
+    int generateNextClothingItemId() override;
+    std::string generateNextOutfitId() override;
+
+    // true daca log-ul a fost deschis (sau backend-ul e doar in memorie)
+    bool isOpen() const { return logPath_.empty() || log_ != nullptr; }
+
+private:
+    struct UserRecord
+    {
+        std::string name;
+        std::string password;
+        Date lastLoginDate;
+        int streak = 0;
+        bool darkMode = false;
+
+        // ordonate dupa id, ca la un range scan
+        std::map<int, ItemRecord> items;
+        std::vector<std::shared_ptr<Outfit>> outfits;
+        // ordonat dupa id, pentru paginare
+        std::map<std::string, std::size_t> outfitSlots;
+
+        // index invers: articol -> outfit-urile care il contin
+        std::unordered_map<int, std::vector<std::string>> outfitsByItem;
+
+        // purtarile, in ordinea adaugarii
+        std::vector<WearRecord> wears;
+
+        // se schimba la fiecare inregistrare de articol / outfit / purtare (vezi dataRevision)
+        std::uint64_t revision = 1;
+
+        void unlinkOutfit(const Outfit &outfit)
+        {
+            for (int id : outfit.getItemIds())
+            {
+                auto it = outfitsByItem.find(id);
+                if (it == outfitsByItem.end())
+                    continue;
+                std::erase(it->second, outfit.getId());
+                if (it->second.empty())
+                    outfitsByItem.erase(it);
+            }
+        }
+    };
+
+    enum class RecordType : std::uint8_t
+    {
+        CreateUser = 1,
+        LoginMeta = 2,
+        DarkMode = 3,
+        SaveItem = 4,
+        DeleteItem = 5,
+        SaveOutfit = 6,
+        DeleteOutfit = 7,
+        Batch = 8,      // mai multe inregistrari scrise si aplicate impreuna
+        Wear = 9,       // inregistrari WearRecord (16 bytes fiecare)
+        Generation = 10 // u64 aleator, scris la fiecare deschidere a log-ului
+    };
+
+    using PendingRecords = std::vector<std::pair<RecordType, std::vector<std::uint8_t>>>;
+
+    // efectul inregistrarilor de dinainte din acelasi lot, cat timp lotul e doar verificat
+    struct BatchCheck
+    {
+        std::unordered_set<std::string> users;
+        std::unordered_map<std::string, std::unordered_map<int, bool>> items;           // id -> exista
+        std::unordered_map<std::string, std::unordered_map<std::string, bool>> outfits; // id -> exista
+    };
+
+    // aplica o inregistrare asupra indexului (folosit si la scriere si la replay)
+    bool apply(RecordType type, const std::vector<std::uint8_t> &payload);
+    bool append(RecordType type, const std::vector<std::uint8_t> &payload);
+    // scrie lotul ca o singura inregistrare Batch (un singur flush); se aplica tot sau nimic,
+    // si la scriere si la replay: un lot cu o inregistrare invalida nu ajunge in log
+    bool commitBatch(const PendingRecords &records);
+    // true daca fiecare inregistrare din lot s-ar aplica (decodare si verificari, fara modificari)
+    bool checkBatch(const std::vector<std::uint8_t> &payload) const;
+    bool check(RecordType type, const std::vector<std::uint8_t> &payload, BatchCheck &staged) const;
+    bool applyBatch(const std::vector<std::uint8_t> &payload);
+    void replay();
+    // incepe o generatie noua (la fiecare deschidere): versiunile de dupa nu pot egala una de dinainte
+    bool startGeneration();
+    std::uint64_t currentRevision() const;
+
+    std::shared_ptr<User> makeUser(const std::string &username, const UserRecord &rec, bool withPassword) const;
+
+    std::string logPath_;
+    std::shared_ptr<BlobStore> blobs_;
+    std::FILE *log_ = nullptr;
+    // sfarsitul ultimei inregistrari (si in modul doar in memorie, ca pozitie virtuala)
+    std::uint64_t logEnd_ = 0;
+    std::uint64_t generation_ = 0;
+    bool unsynced_ = false;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, UserRecord> users_;
+    int lastItemId_ = 0;
+};
@@ -3,8 +3,12 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include "ClothingItem.hpp"
+#include "Date.hpp"
+#include "SymbolTable.hpp"
 
 struct OutfitItemPlacement
 {
@@ -17,23 +21,55 @@ class Outfit
 {
     std::string id;
     std::string name;
-    std::string season;
-    std::string dateAdded;
+    Symbol season;
+    Date dateAdded;
     std::vector<int> itemIds;
     std::vector<OutfitItemPlacement> layout;
 
+    // forma canonica a articolelor: itemIds sortate + hash-ul lor, tinute la zi de fiecare setter
+    std::vector<int> itemSet;
+    std::uint64_t itemSetHash = 0;
+
+    void rebuildItemSet()
+    {
+        itemSet = itemIds;
+        std::sort(itemSet.begin(), itemSet.end());
+        itemSetHash = hashItemSet(itemSet);
+    }
+
 public:
-    Outfit(const std::string &id_, const std::string &name_, const std::string &season_, const std::string &dateAdded_)
-        : id(id_), name(name_), season(season_), dateAdded(dateAdded_) {}
+    Outfit(const std::string &id_, const std::string &name_, const std::string &season_, Date dateAdded_)
+        : id(id_), name(name_), season(SymbolTable::getInstance().intern(season_)), dateAdded(dateAdded_) {}
     ~Outfit() = default;
 
     // getters
     const std::string &getId() const { return id; }
     const std::string &getName() const { return name; }
-    const std::string &getDateAdded() const { return dateAdded; }
-    const std::string &getSeason() const { return season; }
+    Date getDateAdded() const { return dateAdded; }
+    const std::string &getSeason() const { return SymbolTable::getInstance().name(season); }
+    Symbol getSeasonId() const { return season; }
     const std::vector<int> &getItemIds() const { return itemIds; }
     const std::vector<OutfitItemPlacement> &getLayout() const { return layout; }
+    const std::vector<int> &getItemSet() const { return itemSet; }
+    std::uint64_t getItemSetHash() const { return itemSetHash; }
+
+    // hash-ul multimii e suma hash-urilor articolelor: nu depinde de ordine
+    // si se actualizeaza in O(1) la adaugarea / scoaterea unui articol
+    static std::uint64_t hashItem(int itemId)
+    {
+        // splitmix64
+        std::uint64_t x = static_cast<std::uint64_t>(static_cast<std::uint32_t>(itemId)) + 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+    static std::uint64_t hashItemSet(std::span<const int> ids)
+    {
+        std::uint64_t h = 0;
+        for (int id : ids)
+            h += hashItem(id);
+        return h;
+    }
 
     // setters
     void setName(const std::string &newName) { name = newName; }
@@ -44,13 +80,20 @@ public:
         for (const auto &ci : newItems)
             if (ci)
                 itemIds.push_back(ci->getId());
+        rebuildItemSet();
+    }
+    void setItemIds(const std::vector<int> &ids)
+    {
+        itemIds = ids;
+        rebuildItemSet();
     }
-    void setItemIds(const std::vector<int> &ids) { itemIds = ids; }
     void setLayout(const std::vector<OutfitItemPlacement> &entries) { layout = entries; }
     void clearItems()
     {
         itemIds.clear();
         layout.clear();
+        itemSet.clear();
+        itemSetHash = 0;
     }
 
     // clothing items management
@@ -58,20 +101,25 @@ public:
     {
         if (!item)
             return;
-        itemIds.push_back(item->getId());
+        const int id = item->getId();
+        itemIds.push_back(id);
+        itemSet.insert(std::upper_bound(itemSet.begin(), itemSet.end(), id), id);
+        itemSetHash += hashItem(id);
     }
 
     void removeItem(int itemId)
     {
+        auto [first, last] = std::equal_range(itemSet.begin(), itemSet.end(), itemId);
+        if (first == last)
+            return;
+        itemSetHash -= hashItem(itemId) * static_cast<std::uint64_t>(last - first);
+        itemSet.erase(first, last);
         itemIds.erase(std::remove(itemIds.begin(), itemIds.end(), itemId), itemIds.end());
     }
 
+    // aceleasi articole, indiferent de ordine; hash-ul diferit scurteaza comparatia
     bool operator==(const Outfit &other) const
     {
-        auto ids1 = itemIds;
-        auto ids2 = other.itemIds;
-        std::sort(ids1.begin(), ids1.end());
-        std::sort(ids2.begin(), ids2.end());
-        return ids1 == ids2;
+        return itemSetHash == other.itemSetHash && itemSet == other.itemSet;
     }
 };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+#include "ItemRecord.hpp"
+#include "SymbolTable.hpp"
+
+// Compune outfit-uri noi din articolele unui user: cate un articol pe slot
+// (top, pants, shoes si, dupa sezon, jacket), cu scor dat de compatibilitatea
+// culorilor / materialelor si de potrivirea cu sezonul.
+//
+// Cautarea este branch-and-bound peste clase de articole echivalente
+// (aceeasi categorie, culoare, materiale si impermeabilitate au acelasi scor),
+// cu un heap top-k si prag partajat intre thread-uri: fiecare thread ia pe rand
+// cate o clasa de pe primul nivel, iar ramurile care nu mai pot intra in top-k
+// sunt taiate. Scorul unei combinatii = suma scorurilor unare + suma scorurilor pe perechi.
+class OutfitGenerator
+{
+public:
+    struct Options
+    {
+        Symbol season = symbols::Empty;   // Empty = fara reguli de sezon
+        std::optional<bool> rainy;        // implicit: primavara si toamna sunt ploioase
+        std::size_t count = 20;           // cate outfit-uri (combinatii de articole) se intorc
+        unsigned threads = 0;             // 0 = std::thread::hardware_concurrency()
+    };
+
+    struct Result
+    {
+        std::vector<int> itemIds; // in ordinea top, pants, jacket, shoes
+        double score = 0.0;
+    };
+
+    // cele mai bune `count` combinatii, ordonate descrescator dupa scor
+    static std::vector<Result> generate(std::span<const ItemRecord> items, const Options &options);
+};
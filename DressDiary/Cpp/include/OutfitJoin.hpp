@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Join-ul outfit -> articole, materializat peste slot-urile din cache-ul DataManager.
+// Pentru fiecare outfit se tin slot-urile articolelor lui (in ordinea id-urilor din outfit),
+// iar pentru fiecare articol slot-urile outfit-urilor care il folosesc (indexul invers).
+// Ambele directii se actualizeaza incremental la save / delete / swap-remove,
+// deci rezolvarea articolelor unui outfit nu mai construieste map-uri temporare,
+// iar stergerea unui articol atinge doar outfit-urile in care apare (O(grad)).
+class OutfitJoin
+{
+public:
+    using Slot = std::uint32_t;
+
+    void clear();
+    void reserve(std::size_t items, std::size_t outfits);
+
+    // articole (aceleasi slot-uri ca ItemRecord-urile din cache)
+    void pushItem();
+    // scoate articolul din toate outfit-urile, apoi muta ultimul articol in `slot`
+    void swapRemoveItem(std::size_t slot);
+
+    // outfit-uri: slot-urile articolelor componente (doar articolele existente)
+    void pushOutfit(std::vector<Slot> itemSlots);
+    void setOutfit(std::size_t slot, std::vector<Slot> itemSlots);
+    void swapRemoveOutfit(std::size_t slot);
+
+    // articolele unui outfit / outfit-urile care folosesc un articol
+    std::span<const Slot> itemsOf(std::size_t outfitSlot) const { return components_[outfitSlot]; }
+    std::span<const Slot> outfitsUsing(std::size_t itemSlot) const { return usedBy_[itemSlot]; }
+
+    std::size_t itemCount() const { return usedBy_.size(); }
+    std::size_t outfitCount() const { return components_.size(); }
+
+private:
+    void link(Slot outfit);
+    void unlink(Slot outfit);
+
+    // inlocuieste prima aparitie a lui `from` cu `to`
+    static void replace(std::vector<Slot> &slots, Slot from, Slot to);
+    static void erase(std::vector<Slot> &slots, Slot value);
+
+    std::vector<std::vector<Slot>> components_; // [outfit] -> slot-uri articole
+    std::vector<std::vector<Slot>> usedBy_;     // [articol] -> slot-uri outfit-uri
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "Outfit.hpp"
+
+// Outfit-uri aproape duplicate: similaritatea Jaccard a multimilor de articole.
+// Fiecare outfit primeste o semnatura MinHash (Hashes valori); semnaturile se impart
+// in benzi (LSH), iar doar outfit-urile care cad in aceeasi galeata pe cel putin o banda
+// devin candidati. Pentru candidati se calculeaza Jaccard exact pe getItemSet().
+// Numarul de randuri pe banda se alege dupa prag, ca o pereche cu similaritatea
+// egala cu pragul sa fie gasita cu probabilitate de cel putin 99%.
+class OutfitSimilarity
+{
+public:
+    static constexpr std::size_t Hashes = 64;
+    using Signature = std::array<std::uint64_t, Hashes>;
+
+    struct Match
+    {
+        std::size_t first = 0;  // pozitiile in vectorul primit, first < second
+        std::size_t second = 0;
+        double jaccard = 0.0;
+    };
+
+    static Signature signature(std::span<const int> itemSet);
+
+    // Jaccard exact intre doua liste sortate (duplicatele se numara o singura data)
+    static double jaccard(std::span<const int> a, std::span<const int> b);
+
+    // perechile cu jaccard >= threshold (outfit-urile fara articole se ignora),
+    // ordonate descrescator dupa similaritate
+    static std::vector<Match> nearDuplicates(std::span<const std::shared_ptr<Outfit>> outfits, double threshold);
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+// Un singur thread dedicat operatiilor de persistenta (backend-ul).
+// Job-urile se executa strict in ordinea in care au fost trimise, deci o citire
+// trimisa dupa o scriere vede scrierea. Cine trimite un job primeste un std::future
+// pentru rezultat; job-urile nu trebuie sa ia lock-urile celui care asteapta dupa ele.
+class PersistenceWorker
+{
+public:
+    PersistenceWorker() : thread_([this] { run(); }) {}
+
+    // termina job-urile ramase, apoi opreste thread-ul
+    ~PersistenceWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    PersistenceWorker(const PersistenceWorker &) = delete;
+    PersistenceWorker &operator=(const PersistenceWorker &) = delete;
+
+    template <typename F>
+    auto submit(F &&work) -> std::future<std::invoke_result_t<F &>>
+    {
+        using Result = std::invoke_result_t<F &>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(work));
+        std::future<Result> done = task->get_future();
+
+        // trimis chiar de pe thread-ul worker-ului: asteptarea ar bloca coada, deci rulam pe loc
+        if (onWorkerThread())
+        {
+            (*task)();
+            return done;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.emplace_back([task] { (*task)(); });
+        }
+        wake_.notify_one();
+        return done;
+    }
+
+    // asteapta pana se executa tot ce era in coada la momentul apelului
+    void drain()
+    {
+        submit([] {}).wait();
+    }
+
+    bool onWorkerThread() const
+    {
+        return std::this_thread::get_id() == thread_.get_id();
+    }
+
+private:
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty())
+                    return; // stopping_ si nimic de facut
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::thread thread_; // ultimul: porneste dupa ce restul membrilor sunt initializati
+};
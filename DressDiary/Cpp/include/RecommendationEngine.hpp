@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "Date.hpp"
+#include "Outfit.hpp"
+#include "SymbolTable.hpp"
+#include "WeightedSampler.hpp"
+
+// Recomandarea zilnica de outfit, pe baza istoricului.
+// Fiecare outfit (acelasi slot ca in cache-ul DataManager) are o pondere:
+//   sezon potrivit x zile de la ultima purtare x zile de la ultima sugestie
+//   x cat de putin se suprapune cu articolele sugerate recent.
+// Ponderile stau intr-un WeightedSampler si se actualizeaza doar pentru outfit-urile
+// atinse de o schimbare (save / delete / purtat / sugerat); recalcularea completa
+// are loc o singura data pe zi, cand se schimba data (si eventual sezonul).
+class RecommendationEngine
+{
+public:
+    using Day = Date;
+
+    struct Tuning
+    {
+        int recoveryDays = 14;        // dupa atatea zile un outfit purtat revine la pondere maxima
+        int suggestionCooldown = 3;   // idem pentru un outfit deja sugerat
+        double minFactor = 0.05;      // ponderea minima pentru un outfit purtat / sugerat azi
+        double overlapPenalty = 0.75; // cat scade ponderea cand toate articolele au fost sugerate recent
+        std::size_t recentWindow = 3; // cate sugestii recente conteaza la suprapunere
+    };
+
+    RecommendationEngine() : rng_(std::random_device{}()) {}
+    // seed fix: sugestii reproductibile (teste, benchmark-uri)
+    explicit RecommendationEngine(std::uint64_t seed) : rng_(seed) {}
+    RecommendationEngine(std::uint64_t seed, Tuning tuning) : tuning_(tuning), rng_(seed) {}
+
+    void clear();
+    void reserve(std::size_t outfits);
+
+    // sincronizare cu outfit-urile din cache (aceleasi slot-uri, stergere prin swap cu ultimul)
+    void pushOutfit(const Outfit &outfit);
+    void setOutfit(std::size_t slot, const Outfit &outfit);
+    void swapRemoveOutfit(std::size_t slot);
+
+    // istoric
+    void markWorn(std::size_t slot, Day day);
+
+    // outfit-ul zilei pentru sezonul dat; aceeasi zi intoarce aceeasi sugestie cat timp outfit-ul exista
+    std::optional<std::size_t> suggest(Day today, Symbol season);
+
+    // anotimpul pentru o luna (1-12)
+    static Symbol seasonForMonth(unsigned month);
+
+    // pentru statistici / depanare
+    double weight(std::size_t slot) const { return sampler_.weight(slot); }
+    std::uint32_t wearCount(std::size_t slot) const { return state_[slot].wearCount; }
+
+private:
+    static constexpr Day Never = Day(); // data lipsa: mai mica decat orice zi
+
+    struct OutfitState
+    {
+        Symbol season = symbols::Empty; // folded
+        std::vector<int> itemIds;       // sortate, fara duplicate
+        Day lastWorn = Never;
+        Day lastSuggested = Never;
+        std::uint32_t wearCount = 0;
+        std::uint32_t overlap = 0; // cate articole apar in sugestiile recente
+    };
+
+    OutfitState makeState(const Outfit &outfit) const;
+    double score(const OutfitState &state) const;
+    double ageFactor(Day since, int fullDays) const;
+    void rescore(std::size_t slot) { sampler_.set(slot, score(state_[slot])); }
+
+    // articol -> outfit-urile care il contin (pentru actualizarea suprapunerii)
+    void link(std::size_t slot);
+    void unlink(std::size_t slot);
+    void moveLinks(std::size_t from, std::size_t to);
+
+    // fereastra de sugestii recente
+    void pushRecent(const std::vector<int> &itemIds);
+    void adjustOverlap(int itemId, int delta);
+
+    // schimbarea zilei / sezonului recalculeaza toate ponderile o singura data
+    void setContext(Day today, Symbol season);
+
+    Tuning tuning_;
+    std::mt19937_64 rng_;
+
+    std::vector<OutfitState> state_;
+    WeightedSampler sampler_;
+    std::unordered_map<int, std::vector<std::size_t>> outfitsByItem_;
+
+    std::deque<std::vector<int>> recent_;
+    std::unordered_map<int, std::uint32_t> recentItems_; // articol -> aparitii in fereastra
+
+    Day today_ = Never;
+    Symbol season_ = symbols::Empty;
+    std::optional<std::size_t> todayPick_;
+};
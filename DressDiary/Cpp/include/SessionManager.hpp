@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "User.hpp"
+#include "DataManager.hpp"
+
+// Sesiunile deschise: token -> contextul unui user logat (userul, callback-urile proprii,
+// ultima folosire). Mai multe sesiuni pot fi ale aceluiasi user (ex. doua dispozitive):
+// impart garderoba din cache-ul DataManager, dar fiecare are callback-urile ei.
+//
+// Sesiunile sunt impartite in shard-uri dupa token si dupa username, fiecare cu lock-ul lui,
+// deci validarea unui token nu se asteapta cu login-urile altor useri. Cand memoria estimata
+// a garderobelor din cache depaseste bugetul, se elibereaza cele ale userilor folositi cel mai
+// demult (sesiunea ramane valida; garderoba se reincarca, din snapshot, la urmatorul acces).
+// SessionManager devine observatorul DataManager si trimite fiecare schimbare doar sesiunilor
+// userului ei.
+class SessionManager
+{
+public:
+    using Token = std::string;
+    using Clock = std::chrono::steady_clock;
+    using ItemsCallback = std::function<void(const DataManager::ItemsDelta &)>;
+    using OutfitsCallback = std::function<void(const DataManager::OutfitsDelta &)>;
+
+    class Session
+    {
+    public:
+        Session(Token token, std::shared_ptr<User> user);
+
+        const Token &token() const { return token_; }
+        const std::string &username() const { return username_; }
+        const std::shared_ptr<User> &user() const { return user_; }
+
+        Clock::time_point lastUsed() const
+        {
+            return Clock::time_point(Clock::duration(lastUsed_.load(std::memory_order_relaxed)));
+        }
+        void touch() { lastUsed_.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed); }
+
+    private:
+        friend class SessionManager;
+
+        const Token token_;
+        const std::string username_;
+        const std::shared_ptr<User> user_;
+        std::atomic<Clock::rep> lastUsed_;
+
+        // apelate dupa eliberarea lock-urilor DataManager (pot citi din el)
+        std::mutex callbackMutex_;
+        ItemsCallback itemsChanged_;
+        OutfitsCallback outfitsChanged_;
+    };
+
+    using SessionPtr = std::shared_ptr<Session>;
+
+    explicit SessionManager(DataManager &data);
+    ~SessionManager();
+
+    SessionManager(const SessionManager &) = delete;
+    SessionManager &operator=(const SessionManager &) = delete;
+
+    static SessionManager &getInstance()
+    {
+        static SessionManager instance(DataManager::getInstance());
+        return instance;
+    }
+
+    // login / recover prin DataManager; token gol daca userul nu exista sau parola e gresita
+    Token login(const std::string &username, const std::string &password);
+    Token recover(const std::string &username);
+
+    // inchide sesiunea; garderoba userului se elibereaza cand i se inchide ultima sesiune
+    bool logout(const Token &token);
+
+    // sesiunea tokenului (nullptr daca nu exista), marcata ca folosita acum
+    SessionPtr find(const Token &token) const;
+    std::shared_ptr<User> user(const Token &token) const;
+    // username-ul pentru operatiile DataManager (gol daca tokenul nu e valid)
+    std::string username(const Token &token) const;
+
+    // callback-urile unei sesiuni: primesc doar schimbarile garderobei userului ei
+    bool setCallbacks(const Token &token, ItemsCallback itemsChanged, OutfitsCallback outfitsChanged);
+
+    // 0 = fara limita; bugetul se verifica la fiecare login / recover
+    void setMemoryBudget(std::size_t bytes);
+    std::size_t getMemoryBudget() const { return memoryBudget_.load(std::memory_order_relaxed); }
+
+    // elibereaza garderobele userilor folositi cel mai demult pana cand restul incape in buget;
+    // intoarce cate au fost eliberate
+    std::size_t enforceMemoryBudget();
+
+    // inchide sesiunile nefolosite de cel putin `idleFor`; intoarce cate au fost inchise
+    std::size_t expireIdle(Clock::duration idleFor);
+
+    std::size_t sessionCount() const;
+    std::size_t userCount() const;
+
+private:
+    static constexpr std::size_t ShardCount = 32;
+
+    struct TokenShard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Token, SessionPtr> sessions;
+    };
+
+    struct UserShard
+    {
+        mutable std::mutex mutex;
+        // sesiunile deschise ale fiecarui user
+        std::unordered_map<std::string, std::vector<SessionPtr>> sessions;
+    };
+
+    TokenShard &tokenShard(const Token &token) const;
+    UserShard &userShard(const std::string &username) const;
+
+    Token open(std::shared_ptr<User> user);
+    void close(const SessionPtr &session);
+    static Token generateToken();
+
+    void dispatchItems(const std::string &username, const DataManager::ItemsDelta &delta);
+    void dispatchOutfits(const std::string &username, const DataManager::OutfitsDelta &delta);
+    std::vector<SessionPtr> sessionsOf(const std::string &username) const;
+
+    DataManager &data_;
+    std::atomic<std::size_t> memoryBudget_{0};
+    // estimarea memoriei garderobelor din cache: creste la login, se recalculeaza complet doar
+    // cand depaseste bugetul (reincarcarile dupa eliberare se vad abia la urmatoarea recalculare)
+    std::atomic<std::size_t> residentBytes_{0};
+    // o singura aplicare a bugetului odata (celelalte login-uri nu asteapta dupa ea)
+    std::mutex budgetMutex_;
+
+    mutable std::array<TokenShard, ShardCount> tokens_;
+    mutable std::array<UserShard, ShardCount> users_;
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <span>
+#include <utility>
+#include "User.hpp"
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+#include "WearLog.hpp"
+
+// Userul rezolvat de backend o singura data pe sesiune (la login / recover).
+// Backend-urile pot deriva din el ca sa tina referinta proprie
+// (ex. NSManagedObjectID la Core Data), astfel incat operatiile urmatoare
+// sa nu mai caute userul dupa username.
+class UserHandle
+{
+    std::string username_;
+
+public:
+    explicit UserHandle(std::string username) : username_(std::move(username)) {}
+    virtual ~UserHandle() = default;
+
+    const std::string &username() const { return username_; }
+};
+
+using UserHandlePtr = std::shared_ptr<const UserHandle>;
+
+// Interfata comuna pentru persistenta.
+// DataManager lucreaza doar cu aceasta interfata, iar implementarile concrete
+// (Core Data in CoreAdapter.mm, NativeBackend in C++ pur) pot fi schimbate la runtime.
+class StorageBackend
+{
+public:
+    virtual ~StorageBackend() = default;
+
+    // user operations
+    virtual bool createUser(const std::string &username, const std::string &name, const std::string &password) = 0;
+    virtual std::shared_ptr<User> loginUser(const std::string &username, const std::string &password) = 0;
+    virtual std::shared_ptr<User> recoverUser(const std::string &username) = 0;
+
+    // handle-ul userului (nullptr daca nu exista); implicit poarta doar username-ul
+    virtual UserHandlePtr resolveUser(const std::string &username)
+    {
+        return std::make_shared<UserHandle>(username);
+    }
+
+    // cate cautari ale userului au fost evitate folosind handle-ul (0 daca backend-ul nu face astfel de cautari)
+    virtual std::uint64_t userLookupsSaved() const { return 0; }
+
+    // operatiile de mai jos primesc userul deja rezolvat
+    virtual bool updateUserLoginMeta(const UserHandle &user, Date lastLoginDate, int streak) = 0;
+    virtual bool updateUserDarkMode(const UserHandle &user, bool isDarkMode) = 0;
+
+    // clothing item operations (articolele circula ca record-uri plate, vezi ItemRecord.hpp)
+    virtual std::vector<ItemRecord> fetchClothingItems(const UserHandle &user) = 0;
+    virtual bool saveClothingItem(const UserHandle &user, const ItemRecord &item) = 0;
+
+    // pagina de articole cu id > afterId, crescator dupa id (cel mult `limit`).
+    // Implementarea implicita filtreaza fetch-ul complet; backend-urile fac range scan.
+    virtual std::vector<ItemRecord> fetchClothingItemPage(const UserHandle &user, int afterId, std::size_t limit)
+    {
+        std::vector<ItemRecord> page;
+        for (auto &item : fetchClothingItems(user))
+            if (item.id > afterId)
+                page.push_back(std::move(item));
+        auto byId = [](const ItemRecord &a, const ItemRecord &b) { return a.id < b.id; };
+        std::size_t n = std::min(limit, page.size());
+        std::partial_sort(page.begin(), page.begin() + n, page.end(), byId);
+        page.resize(n);
+        return page;
+    }
+    virtual bool deleteClothingItem(const UserHandle &user, int itemId) = 0;
+
+    // outfit operations
+    virtual std::vector<std::shared_ptr<Outfit>> fetchOutfits(const UserHandle &user) = 0;
+    virtual bool saveOutfit(const UserHandle &user, const Outfit &outfit) = 0;
+
+    // pagina de outfit-uri cu id > afterId, crescator dupa id (la fel ca fetchClothingItemPage)
+    virtual std::vector<std::shared_ptr<Outfit>> fetchOutfitPage(const UserHandle &user, const std::string &afterId,
+                                                                 std::size_t limit)
+    {
+        std::vector<std::shared_ptr<Outfit>> page;
+        for (auto &outfit : fetchOutfits(user))
+            if (outfit->getId() > afterId)
+                page.push_back(std::move(outfit));
+        auto byId = [](const auto &a, const auto &b) { return a->getId() < b->getId(); };
+        std::size_t n = std::min(limit, page.size());
+        std::partial_sort(page.begin(), page.begin() + n, page.end(), byId);
+        page.resize(n);
+        return page;
+    }
+    virtual bool deleteOutfit(const UserHandle &user, const std::string &outfitId) = 0;
+
+    // operatii pe loturi: un singur commit pentru tot lotul.
+    // Implementarea implicita apeleaza operatia simpla pentru fiecare element.
+    virtual bool saveClothingItems(const UserHandle &user, std::span<const ItemRecord> items)
+    {
+        for (const auto &item : items)
+            if (!saveClothingItem(user, item))
+                return false;
+        return true;
+    }
+
+    virtual bool saveOutfits(const UserHandle &user, std::span<const Outfit> outfits)
+    {
+        for (const auto &outfit : outfits)
+            if (!saveOutfit(user, outfit))
+                return false;
+        return true;
+    }
+
+    // id-urile care nu exista sunt ignorate
+    virtual bool deleteClothingItems(const UserHandle &user, std::span<const int> itemIds)
+    {
+        for (int itemId : itemIds)
+            deleteClothingItem(user, itemId);
+        return true;
+    }
+
+    virtual bool deleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds)
+    {
+        for (const auto &outfitId : outfitIds)
+            deleteOutfit(user, outfitId);
+        return true;
+    }
+
+    // jurnalul purtarilor (inregistrari de lungime fixa, doar adaugate; vezi WearLog.hpp).
+    // Implicit backend-ul nu le pastreaza: istoricul traieste doar cat cache-ul din DataManager.
+    virtual bool appendWearRecords(const UserHandle & /*user*/, std::span<const WearRecord> /*records*/) { return true; }
+    virtual std::vector<WearRecord> fetchWearRecords(const UserHandle & /*user*/) { return {}; }
+
+    // importul unei garderobe (articole, outfit-uri si purtarile lor, toate cu id-uri noi): tot sau
+    // nimic. Implicit fiecare parte e un lot separat, iar la esec partile deja scrise sunt sterse;
+    // purtarile se scriu ultimele, deci nu raman niciodata fara articolele lor.
+    virtual bool importWardrobe(const UserHandle &user, std::span<const ItemRecord> items,
+                                std::span<const Outfit> outfits, std::span<const WearRecord> wears)
+    {
+        if (saveClothingItems(user, items) && saveOutfits(user, outfits) &&
+            (wears.empty() || appendWearRecords(user, wears)))
+            return true;
+
+        std::vector<std::string> outfitIds;
+        outfitIds.reserve(outfits.size());
+        for (const auto &outfit : outfits)
+            outfitIds.push_back(outfit.getId());
+        std::vector<int> itemIds;
+        itemIds.reserve(items.size());
+        for (const auto &item : items)
+            itemIds.push_back(item.id);
+        deleteOutfits(user, outfitIds);
+        deleteClothingItems(user, itemIds);
+        return false;
+    }
+
+    // Versiunea garderobei userului (articole, outfit-uri, purtari): se schimba la fiecare scriere
+    // a lor, inclusiv una esuata, si se pastreaza intre porniri. Un snapshot e valid doar daca a fost
+    // scris la aceeasi versiune, deci o valoare nu se refoloseste pentru alt continut, nici dupa o
+    // cadere care pierde scrieri nesincronizate; scrierile acoperite sunt pe disc cand e intoarsa.
+    // 0 = backend-ul nu o urmareste (snapshot-urile nu se folosesc).
+    virtual std::uint64_t dataRevision(const UserHandle & /*user*/) { return 0; }
+
+    // generare id-uri
+    virtual int generateNextClothingItemId() = 0;
+    virtual std::string generateNextOutfitId() = 0;
+};
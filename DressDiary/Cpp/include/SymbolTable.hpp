@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Id mic, stabil pe durata procesului, pentru o valoare de atribut (culoare, material, categorie, sezon).
+using Symbol = std::uint32_t;
+
+// Valori cunoscute, internate primele in ordinea de mai jos (vezi SymbolTable::SymbolTable).
+namespace symbols
+{
+    inline constexpr Symbol Empty = 0;
+
+    // categorii
+    inline constexpr Symbol Pants = 1;
+    inline constexpr Symbol Jacket = 2;
+    inline constexpr Symbol Top = 3;
+    inline constexpr Symbol Shoes = 4;
+
+    // sezoane
+    inline constexpr Symbol Primavara = 5;
+    inline constexpr Symbol Vara = 6;
+    inline constexpr Symbol Toamna = 7;
+    inline constexpr Symbol Iarna = 8;
+}
+
+// design pattern - Singleton (+ Flyweight)
+// Tabela globala de simboluri: fiecare valoare distincta este pastrata o singura data,
+// iar articolele tin doar id-uri. Comparatiile si filtrele devin operatii pe intregi.
+// Citirile (name, fold) nu iau lock; doar internarea unei valori noi serializeaza.
+class SymbolTable
+{
+    struct Entry
+    {
+        std::string text;
+        Symbol folded = 0; // simbolul formei cu litere mici
+    };
+
+    static constexpr std::size_t ChunkBits = 10;
+    static constexpr std::size_t ChunkSize = std::size_t(1) << ChunkBits;
+    static constexpr std::size_t MaxChunks = 1024;
+
+    struct Hash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
+    // slot-urile nu se muta niciodata, deci referintele la text raman valide
+    std::array<std::atomic<Entry *>, MaxChunks> chunks_{};
+    std::atomic<std::uint32_t> size_{0};
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Symbol, Hash, std::equal_to<>> lookup_;
+
+    SymbolTable();
+    ~SymbolTable();
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+
+    const Entry &entry(Symbol id) const
+    {
+        return chunks_[id >> ChunkBits].load(std::memory_order_acquire)[id & (ChunkSize - 1)];
+    }
+
+    Symbol insertLocked(std::string_view value);
+
+public:
+    static SymbolTable &getInstance()
+    {
+        static SymbolTable instance;
+        return instance;
+    }
+
+    // intoarce id-ul valorii, adaugand-o daca nu exista
+    Symbol intern(std::string_view value);
+
+    // id-ul valorii, fara sa o adauge
+    std::optional<Symbol> find(std::string_view value) const;
+
+    // textul original (pentru afisare); referinta ramane valida pana la sfarsitul procesului
+    const std::string &name(Symbol id) const
+    {
+        return entry(id < size() ? id : symbols::Empty).text;
+    }
+
+    // simbolul formei cu litere mici (pentru comparatii fara majuscule)
+    Symbol fold(Symbol id) const
+    {
+        return id < size() ? entry(id).folded : symbols::Empty;
+    }
+
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Date.hpp"
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+
+class DataManager;
+
+// Garderoba sintetica, determinista: acelasi Config (inclusiv seed) da exact aceleasi
+// articole si outfit-uri pe orice platforma (generator propriu, nu distributiile din <random>,
+// care difera intre biblioteci). Folosita pentru profilare la 10^2..10^5 articole
+// (ex. cu NativeBackend doar in memorie) si pentru date de test in build-urile de debug.
+class SyntheticWardrobe
+{
+public:
+    struct Weighted
+    {
+        std::string value;
+        double weight;
+    };
+
+    struct Config
+    {
+        std::uint64_t seed = 1;
+        std::size_t itemCount = 100;
+        std::size_t outfitCount = 20;
+        // 0 = articole fara imagine; altfel fiecare articol are bytes proprii (nu se deduplica)
+        std::size_t imageBytes = 0;
+        int firstItemId = 1;
+
+        std::size_t minMaterials = 1;
+        std::size_t maxMaterials = 3;
+        std::size_t minItemsPerOutfit = 2;
+        std::size_t maxItemsPerOutfit = 5;
+
+        // outfit-urile sunt adaugate in ultimele `dateSpanDays` zile dinaintea `lastDate`
+        Date lastDate = *Date::parse("31-12-2025");
+        int dateSpanDays = 730;
+
+        // distributiile atributelor (ponderi relative)
+        std::vector<Weighted> categories = {{"pants", 1.0}, {"jacket", 0.5}, {"top", 1.5}, {"shoes", 0.8}};
+        std::vector<Weighted> colors = {{"black", 3.0}, {"white", 2.5}, {"blue", 2.5}, {"gray", 1.5},
+                                        {"brown", 1.0}, {"red", 0.8}, {"green", 0.8}, {"pink", 0.5},
+                                        {"orange", 0.4}, {"yellow", 0.4}, {"purple", 0.4}, {"other", 0.3}};
+        std::vector<Weighted> materials = {{"cotton", 3.0}, {"denim", 1.5}, {"polyester", 1.2}, {"wool", 1.0},
+                                           {"leather", 0.7}, {"linen", 0.6}, {"silk", 0.3}};
+        std::vector<Weighted> seasons = {{"primavara", 1.0}, {"vara", 1.0}, {"toamna", 1.0}, {"iarna", 1.0}};
+    };
+
+    struct Wardrobe
+    {
+        std::vector<ItemRecord> items;
+        std::vector<std::shared_ptr<Outfit>> outfits;
+    };
+
+    static Wardrobe generate(const Config &config);
+
+    // salveaza garderoba pentru un user existent (articolele intr-un singur lot); id-urile
+    // articolelor si ale outfit-urilor se aloca prin DataManager, deci pot diferi de cele generate
+    static bool populate(DataManager &manager, const std::string &username, const Wardrobe &wardrobe);
+};
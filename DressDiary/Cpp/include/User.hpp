@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ClothingItem.hpp"
+#include "Date.hpp"
 #include "Outfit.hpp"
 #include <string>
 #include <vector>
@@ -13,7 +14,7 @@ class User {
     
     // statistici
     int streak = 0;
-    std::string lastLogIn;
+    Date lastLogIn; // lipsa daca nu s-a logat niciodata
     
     // preferinte tema
     bool darkMode = false;
@@ -24,7 +25,7 @@ class User {
     
 public:
     User(const std::string& _username, const std::string& _name, const std::string& _password)
-    : username(_username), name(_name), password(_password), lastLogIn("") {}
+    : username(_username), name(_name), password(_password) {}
     ~User() = default;
     
     // getters
@@ -33,11 +34,11 @@ public:
     const std::string& getPassword() const { return password; }
     bool isDarkMode() const { return darkMode; }
     int getStreak() const { return streak; }
-    const std::string& getLastLogIn() const { return lastLogIn; }
+    Date getLastLogIn() const { return lastLogIn; }
     
     // setters
     void setDarkMode(bool toggle) { darkMode = toggle; }
-    void setLastLogIn(std::string date) { lastLogIn = date; }
+    void setLastLogIn(Date date) { lastLogIn = date; }
     
     // pentru streak
     void incrementStreak() { streak += 1; }
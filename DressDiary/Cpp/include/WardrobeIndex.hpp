@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+#include "Bitset.hpp"
+#include "SymbolTable.hpp"
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+
+// Index secundar pentru filtrare pe mai multe atribute.
+// Pentru fiecare valoare (culoare, material, categorie, sezon) se tine un bitset
+// peste slot-urile dense ale articolelor / outfit-urilor din cache-ul DataManager.
+// Filtrarea devine intersectie (AND intre atribute) si reuniune (OR intre valorile
+// aceluiasi atribut) de bitset-uri, fara sa parcurgem articolele.
+// Posting-urile sunt indexate direct dupa simbolul internat (forma cu litere mici),
+// deci valorile sunt comparate fara majuscule si fara comparatii de string-uri.
+class WardrobeIndex
+{
+public:
+    // articole: slot = pozitia in vectorul din cache
+    void insertItem(std::size_t slot, const ItemRecord &item);
+    void eraseItem(std::size_t slot, const ItemRecord &item);
+    // articolul din `from` a fost mutat in `to` (stergere prin swap cu ultimul)
+    void moveItem(std::size_t from, std::size_t to, const ItemRecord &item);
+
+    // outfit-uri: slot = pozitia in vectorul din cache
+    void insertOutfit(std::size_t slot, const Outfit &outfit);
+    void eraseOutfit(std::size_t slot, const Outfit &outfit);
+    void moveOutfit(std::size_t from, std::size_t to, const Outfit &outfit);
+
+    void clear();
+
+    // lista goala = fara restrictie pe atributul respectiv
+    Bitset query(const std::vector<std::string> &colors,
+                 const std::vector<std::string> &materials,
+                 const std::vector<std::string> &categories) const;
+
+    Bitset queryOutfits(const std::vector<std::string> &seasons) const;
+
+    // aceleasi interogari, direct pe simboluri
+    Bitset query(const std::vector<Symbol> &colors,
+                 const std::vector<Symbol> &materials,
+                 const std::vector<Symbol> &categories) const;
+
+    Bitset queryOutfits(const std::vector<Symbol> &seasons) const;
+
+    // valorile necunoscute devin Unknown, care nu potriveste nimic (nici atributele goale)
+    static constexpr Symbol Unknown = std::numeric_limits<Symbol>::max();
+    static std::vector<Symbol> toSymbols(const std::vector<std::string> &values);
+
+private:
+    // postings[fold(simbol)] = slot-urile care au valoarea respectiva
+    using Postings = std::vector<Bitset>;
+
+    static void add(Postings &postings, Symbol value, std::size_t slot);
+    static void remove(Postings &postings, Symbol value, std::size_t slot);
+    // reuniunea posting-urilor valorilor cerute
+    static Bitset anyOf(const Postings &postings, const std::vector<Symbol> &values, std::size_t size);
+
+    Postings colors_;
+    Postings materials_;
+    Postings categories_;
+    Postings seasons_;
+
+    Bitset liveItems_;
+    Bitset liveOutfits_;
+};
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "BlobStore.hpp"
+#include "ImageBlob.hpp"
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+#include "WearLog.hpp"
+
+// Snapshot binar al garderobei unui user: articole, outfit-uri (cu layout), purtari si
+// referintele la imagini (cheile din BlobStore; imaginile fara cheie sunt incluse in fisier).
+// Fisierul se citeste prin mmap: sectiunile sunt array-uri de record-uri cu layout fix,
+// folosite direct din mapare, fara parsare per record. Valorile text sunt indecsi in doua
+// pool-uri: simbolurile (culori, materiale, categorii, ...), internate o singura data pe
+// fisier, si textele (id-uri, nume, chei de imagini).
+//
+// Layout (little-endian, fiecare sectiune aliniata la 8 bytes):
+//   Header | sectiunile, in ordinea din Section
+// Checksum-ul acopera tot ce urmeaza dupa campul checksum din header.
+//
+// Acelasi format serveste la pornirea rapida (DataManager il scrie in fundal dupa modificari)
+// si ca fisier de export / import (cu toate imaginile incluse).
+class WardrobeSnapshot
+{
+public:
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::uint32_t NoString = UINT32_MAX;
+
+    enum class Section : std::uint32_t
+    {
+        Items,       // ItemEntry
+        Materials,   // u32, indecsi de simboluri
+        Outfits,     // OutfitEntry
+        OutfitItems, // i32, id-urile articolelor
+        Placements,  // PlacementEntry
+        Wears,       // WearRecord
+        Symbols,     // u32[count + 1], offset-uri in SymbolBytes
+        SymbolBytes,
+        Texts, // u32[count + 1], offset-uri in TextBytes
+        TextBytes,
+        ImageBytes,
+        Count
+    };
+
+    enum Flags : std::uint32_t
+    {
+        AllImagesEmbedded = 1 // export: fisierul nu depinde de BlobStore
+    };
+
+    struct SectionRange
+    {
+        std::uint64_t offset;
+        std::uint64_t count; // elemente (bytes pentru sectiunile *Bytes)
+    };
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        std::uint64_t fileSize;
+        std::uint64_t checksum;
+        std::uint64_t revision; // StorageBackend::dataRevision la scriere (0 = necunoscut)
+        std::uint32_t username; // index de text
+        std::uint32_t flags;
+        SectionRange sections[static_cast<std::size_t>(Section::Count)];
+    };
+
+    struct ItemEntry
+    {
+        std::int32_t id;
+        std::uint32_t color; // index de simbol
+        std::uint32_t category;
+        std::uint32_t materialsBegin; // interval in sectiunea Materials
+        std::uint32_t materialsCount;
+        std::uint32_t pantWaist; // NoString daca nu e pants
+        std::uint32_t topSleeveType;
+        std::uint32_t topNeckline;
+        float pantLength;
+        float shoeSize;
+        std::uint32_t imageKey; // index de text, NoString fara cheie
+        std::uint8_t kind;      // indexul alternativei din ItemPayload
+        std::uint8_t jacketWaterproof;
+        std::uint16_t reserved;
+        std::uint64_t imageOffset; // in sectiunea ImageBytes; imageSize 0 = imagine neinclusa
+        std::uint64_t imageSize;
+    };
+
+    struct OutfitEntry
+    {
+        std::uint32_t id; // index de text
+        std::uint32_t name;
+        std::uint32_t season; // index de simbol
+        std::int32_t dateAdded; // Date::dayNumber()
+        std::uint32_t itemsBegin; // interval in OutfitItems
+        std::uint32_t itemsCount;
+        std::uint32_t layoutBegin; // interval in Placements
+        std::uint32_t layoutCount;
+    };
+
+    struct PlacementEntry
+    {
+        std::int32_t itemId;
+        std::uint32_t reserved;
+        double normalizedX;
+        double normalizedY;
+    };
+
+    // record-urile se citesc direct din mapare: layout-ul in memorie trebuie sa fie cel din fisier
+    static_assert(std::endian::native == std::endian::little);
+    static_assert(sizeof(Header) == 48 + 16 * static_cast<std::size_t>(Section::Count));
+    static_assert(sizeof(ItemEntry) == 64 && std::is_trivially_copyable_v<ItemEntry>);
+    static_assert(sizeof(OutfitEntry) == 32 && std::is_trivially_copyable_v<OutfitEntry>);
+    static_assert(sizeof(PlacementEntry) == 24 && std::is_trivially_copyable_v<PlacementEntry>);
+
+    // ce intra in snapshot
+    struct Contents
+    {
+        std::string username;
+        std::uint64_t revision = 0;
+        std::span<const ItemRecord> items;
+        std::span<const std::shared_ptr<Outfit>> outfits;
+        std::span<const WearRecord> wears;
+        // true: toate imaginile in fisier (export); altfel doar cele fara cheie in BlobStore
+        bool embedImages = false;
+    };
+
+    static std::vector<std::uint8_t> encode(const Contents &contents);
+
+    // scriere atomica si durabila (fisier temporar + fsync + rename + fsync pe director):
+    // un snapshot citit e mereu complet, si dupa o cadere
+    static bool writeFile(const std::string &path, std::span<const std::uint8_t> bytes);
+
+    // mapeaza fisierul si verifica header-ul, checksum-ul si limitele sectiunilor; nullopt daca nu e valid
+    static std::optional<WardrobeSnapshot> open(const std::string &path);
+    static std::optional<WardrobeSnapshot> fromBytes(std::vector<std::uint8_t> bytes);
+
+    // numele fisierului pentru un user (caracterele din afara [A-Za-z0-9] codate hex)
+    static std::string fileName(const std::string &username);
+
+    static std::uint64_t checksum(std::span<const std::uint8_t> bytes);
+
+    const Header &header() const { return *reinterpret_cast<const Header *>(bytes_.data()); }
+    std::string_view username() const { return text(header().username); }
+    std::uint64_t revision() const { return header().revision; }
+    std::size_t byteSize() const { return bytes_.size(); }
+
+    // vederi direct peste mapare
+    std::span<const ItemEntry> itemEntries() const { return section<ItemEntry>(Section::Items); }
+    std::span<const OutfitEntry> outfitEntries() const { return section<OutfitEntry>(Section::Outfits); }
+    std::span<const WearRecord> wears() const { return section<WearRecord>(Section::Wears); }
+    std::string_view symbol(std::uint32_t index) const { return string(Section::Symbols, Section::SymbolBytes, index); }
+    std::string_view text(std::uint32_t index) const { return string(Section::Texts, Section::TextBytes, index); }
+
+    // reconstruirea record-urilor: simbolurile se interneaza o singura data pe fisier, imaginile
+    // incluse raman in mapare (fara copiere), iar cele cu cheie se deschid din `blobs`
+    std::vector<ItemRecord> items(const BlobStore *blobs) const;
+    std::vector<std::shared_ptr<Outfit>> outfits() const;
+
+private:
+    explicit WardrobeSnapshot(ImageBlob bytes) : bytes_(std::move(bytes)) {}
+
+    static std::optional<WardrobeSnapshot> validated(ImageBlob bytes);
+
+    template <typename T>
+    std::span<const T> section(Section s) const
+    {
+        const SectionRange &range = header().sections[static_cast<std::size_t>(s)];
+        return {reinterpret_cast<const T *>(bytes_.data() + range.offset), static_cast<std::size_t>(range.count)};
+    }
+
+    std::string_view string(Section offsets, Section bytes, std::uint32_t index) const;
+
+    // tot fisierul (mapat sau in memorie); imaginile incluse il tin in viata
+    ImageBlob bytes_;
+};
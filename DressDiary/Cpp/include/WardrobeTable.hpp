@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "ClothingItem.hpp"
+#include "ImageBlob.hpp"
+#include "ItemRecord.hpp"
+#include "SymbolTable.hpp"
+
+// Tabela pe coloane (struct-of-arrays) a articolelor unui user.
+// Fiecare camp sta intr-un vector separat, aliniat pe slot cu cache-ul din DataManager,
+// astfel incat o scanare citeste doar coloana de care are nevoie (4 octeti / articol),
+// fara sa urmareasca pointeri. Buclele de scanare sunt fara ramificatii si se vectorizeaza.
+// Culorile si categoriile sunt tinute ca simboluri "folded" (fara majuscule).
+class WardrobeTable
+{
+public:
+    // constructie din lista de obiecte (ex. User::getClothingItems())
+    static WardrobeTable fromItems(const std::vector<std::shared_ptr<ClothingItem>> &items);
+
+    void clear();
+    void reserve(std::size_t n);
+    std::size_t size() const { return ids_.size(); }
+
+    // sincronizare cu cache-ul (aceleasi slot-uri, stergere prin swap cu ultimul)
+    void push(const ItemRecord &item);
+    void set(std::size_t slot, const ItemRecord &item);
+    void swapRemove(std::size_t slot);
+
+    // coloane (read-only)
+    const std::vector<int> &ids() const { return ids_; }
+    const std::vector<Symbol> &colors() const { return colors_; }
+    const std::vector<Symbol> &categories() const { return categories_; }
+    const std::vector<ImageBlob> &images() const { return images_; }
+
+    // kernel-uri de scanare; symbols::Empty = fara restrictie pe coloana respectiva
+    std::size_t count(Symbol color, Symbol category) const;
+    std::size_t countMaterial(Symbol material) const;
+    std::vector<int> selectIds(Symbol color, Symbol category) const;
+
+    // histograme: (simbol, numar) pentru fiecare valoare prezenta, ordonate descrescator
+    std::vector<std::pair<Symbol, std::size_t>> colorHistogram() const;
+    std::vector<std::pair<Symbol, std::size_t>> categoryHistogram() const;
+    std::vector<std::pair<Symbol, std::size_t>> materialHistogram() const;
+
+private:
+    // fiecare material primeste un bit; la peste 64 de materiale distincte se adauga o coloana noua
+    struct MaterialBit
+    {
+        std::uint32_t column = 0;
+        std::uint64_t mask = 0;
+    };
+
+    MaterialBit materialBit(Symbol material);
+    const MaterialBit *findMaterialBit(Symbol material) const;
+    void writeMaterials(std::size_t slot, const MaterialSet &materials);
+
+    static std::vector<std::pair<Symbol, std::size_t>> histogram(const std::vector<Symbol> &column);
+
+    std::vector<int> ids_;
+    std::vector<Symbol> colors_;
+    std::vector<Symbol> categories_;
+    std::vector<std::vector<std::uint64_t>> materialMasks_; // [coloana][slot]
+    std::vector<ImageBlob> images_;
+
+    // fold(material) -> bit; materialSymbols_ pastreaza ordinea bitilor
+    std::vector<MaterialBit> materialBits_;
+    std::vector<Symbol> materialSymbols_;
+};
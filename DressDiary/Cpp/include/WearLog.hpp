@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "Date.hpp"
+#include "ItemRecord.hpp"
+#include "Outfit.hpp"
+#include "SymbolTable.hpp"
+
+// O purtare, cu layout fix de 16 bytes (asa sta si in memorie, si in backend).
+// Purtarea unui outfit = o inregistrare de outfit (itemId = NoItem) urmata de cate una
+// pentru fiecare articol al lui, cu acelasi outfitKey; astfel numaratorile pe articol
+// raman corecte si dupa ce outfit-ul se modifica sau e sters.
+// Un articol purtat separat are outfitKey = NoOutfit.
+struct WearRecord
+{
+    static constexpr std::int32_t NoItem = std::numeric_limits<std::int32_t>::min();
+    static constexpr std::uint64_t NoOutfit = 0;
+
+    std::int32_t day;        // Date::dayNumber()
+    std::int32_t itemId;     // NoItem pentru inregistrarea de outfit
+    std::uint64_t outfitKey; // WearLog::outfitKey(id outfit)
+
+    Date date() const { return Date::fromDayNumber(day); }
+    bool isOutfit() const { return itemId == NoItem; }
+};
+
+static_assert(sizeof(WearRecord) == 16 && std::is_trivially_copyable_v<WearRecord>);
+
+// Jurnalul purtarilor unui user (doar adaugare), cu index pe date si agregate tinute la zi
+// la fiecare inregistrare: purtari pe articol (si prima / ultima zi, pentru cost per purtare),
+// articolele nepurtate, distributia purtarilor pe culori / categorii si cele mai purtate
+// outfit-uri intr-o fereastra glisanta. Citirile nu reparcurg istoricul.
+// Articolele si outfit-urile garderobei se sincronizeaza prin track* / untrack* (ca in DataManager).
+class WearLog
+{
+public:
+    // intrarile pentru cost per purtare (pretul nu e in model: wears + intervalul de folosire)
+    struct ItemWear
+    {
+        std::uint32_t wears = 0;
+        Date firstWorn;
+        Date lastWorn;
+    };
+
+    struct OutfitWears
+    {
+        std::string outfitId;
+        std::uint32_t wears = 0;
+    };
+
+    using Distribution = std::vector<std::pair<Symbol, std::size_t>>;
+
+    explicit WearLog(int windowDays = 30) : windowDays_(windowDays > 0 ? windowDays : 1) {}
+
+    // cheia pe 64 de biti a id-ului de outfit (FNV-1a; niciodata NoOutfit)
+    static std::uint64_t outfitKey(std::string_view outfitId);
+
+    // inregistrarile pentru o purtare (articolele unice ale outfit-ului)
+    static std::vector<WearRecord> forOutfit(Date day, const Outfit &outfit);
+    static WearRecord forItem(Date day, int itemId);
+
+    // fisier de inregistrari de 16 bytes (little-endian), doar adaugare; o inregistrare
+    // incompleta la final (scriere intrerupta) se ignora la citire
+    static bool appendToFile(const std::string &path, std::span<const WearRecord> records);
+    static std::vector<WearRecord> readFile(const std::string &path);
+
+    void clear();
+    void reserve(std::size_t records);
+
+    // sincronizare cu garderoba: doar articolele urmarite intra in never-worn si in distributii
+    void trackItem(const ItemRecord &item); // articol nou sau culoare / categorie schimbata
+    void untrackItem(int itemId);
+    void trackOutfit(const std::string &outfitId);
+    void untrackOutfit(const std::string &outfitId);
+
+    // zilele pot veni in orice ordine (ex. o purtare trecuta adaugata acum)
+    void append(std::span<const WearRecord> records);
+
+    const std::vector<WearRecord> &records() const { return records_; }
+    std::size_t size() const { return records_.size(); }
+
+    // agregate (O(1), respectiv O(rezultat))
+    ItemWear itemWear(int itemId) const;
+    std::uint32_t outfitWears(const std::string &outfitId) const;
+    std::uint64_t totalOutfitWears() const { return totalOutfitWears_; }
+    std::uint64_t totalItemWears() const { return totalItemWears_; }
+    std::size_t neverWornCount() const { return neverWorn_.size(); }
+    std::vector<int> neverWornItems() const;
+    // purtarile articolelor existente, pe culoare / categorie, descrescator
+    Distribution colorDistribution() const { return sorted(byColor_); }
+    Distribution categoryDistribution() const { return sorted(byCategory_); }
+
+    // Fereastra glisanta: ultimele `windowDays` zile pana la windowEnd() inclusiv.
+    // Avanseaza singura la purtari mai noi; advanceTo(azi) scoate zilele iesite din fereastra.
+    void advanceTo(Date day);
+    Date windowEnd() const { return windowEnd_; }
+    int windowDays() const { return windowDays_; }
+    // cele mai purtate outfit-uri (existente) din fereastra, descrescator
+    std::vector<OutfitWears> mostWornOutfits(std::size_t count) const;
+
+    // inregistrarile cu ziua in [from, to], crescator dupa zi (prin indexul pe date)
+    template <typename F>
+    void forEachBetween(Date from, Date to, F &&visit) const
+    {
+        for (auto it = lowerBound(from); it != byDay_.end() && records_[*it].day <= to.dayNumber(); ++it)
+            visit(records_[*it]);
+    }
+
+private:
+    struct ItemState
+    {
+        ItemWear wear;
+        Symbol color = symbols::Empty;
+        Symbol category = symbols::Empty;
+        bool tracked = false;
+        bool retired = false; // articol sters; istoricul ramane pana cand id-ul e refolosit
+    };
+
+    void count(const WearRecord &record);
+    void addToWindow(std::uint64_t key, int delta);
+    void addToDistribution(const ItemState &state, std::int64_t delta);
+    std::vector<std::uint32_t>::const_iterator lowerBound(Date day) const;
+    static Distribution sorted(const std::unordered_map<Symbol, std::size_t> &counts);
+
+    int windowDays_;
+
+    // inregistrarile in ordinea adaugarii + pozitiile lor ordonate dupa (zi, pozitie)
+    std::vector<WearRecord> records_;
+    std::vector<std::uint32_t> byDay_;
+
+    std::unordered_map<int, ItemState> items_;
+    std::unordered_set<int> neverWorn_;
+    std::unordered_map<Symbol, std::size_t> byColor_;
+    std::unordered_map<Symbol, std::size_t> byCategory_;
+    std::uint64_t totalOutfitWears_ = 0;
+    std::uint64_t totalItemWears_ = 0;
+
+    std::unordered_map<std::uint64_t, std::string> outfitIds_; // outfit-urile existente
+    std::unordered_map<std::uint64_t, std::uint32_t> outfitTotals_;
+
+    Date windowEnd_;
+    std::unordered_map<std::uint64_t, std::uint32_t> windowCounts_;
+    std::set<std::pair<std::uint32_t, std::uint64_t>> ranking_; // (purtari in fereastra, outfit)
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Esantionare proportionala cu ponderea, peste slot-uri dense (arbore Fenwick).
+// Actualizarea unei ponderi, adaugarea / stergerea unui slot si extragerea
+// costa O(log n); nu se recalculeaza suma tuturor ponderilor la fiecare cerere.
+class WeightedSampler
+{
+    std::vector<double> weights_;
+    std::vector<double> tree_; // 1-based: tree_[i] = suma pe (i - lowbit(i), i]
+
+    static std::size_t lowbit(std::size_t i) { return i & (~i + 1); }
+
+    void add(std::size_t slot, double delta)
+    {
+        for (std::size_t i = slot + 1; i < tree_.size(); i += lowbit(i))
+            tree_[i] += delta;
+    }
+
+    // suma ponderilor pentru slot-urile [0, count)
+    double prefix(std::size_t count) const
+    {
+        double sum = 0.0;
+        for (std::size_t i = count; i > 0; i -= lowbit(i))
+            sum += tree_[i];
+        return sum;
+    }
+
+public:
+    WeightedSampler() : tree_(1, 0.0) {}
+
+    std::size_t size() const { return weights_.size(); }
+    double weight(std::size_t slot) const { return weights_[slot]; }
+    double total() const { return prefix(weights_.size()); }
+
+    void clear()
+    {
+        weights_.clear();
+        tree_.assign(1, 0.0);
+    }
+
+    void reserve(std::size_t n)
+    {
+        weights_.reserve(n);
+        tree_.reserve(n + 1);
+    }
+
+    void push(double weight)
+    {
+        // nodul nou acopera (i - lowbit(i), i], adica si o parte din slot-urile existente
+        const std::size_t i = weights_.size() + 1;
+        weights_.push_back(weight);
+        tree_.push_back(weight + prefix(i - 1) - prefix(i - lowbit(i)));
+    }
+
+    void set(std::size_t slot, double weight)
+    {
+        add(slot, weight - weights_[slot]);
+        weights_[slot] = weight;
+    }
+
+    // ultimul slot se muta in `slot` (ca stergerile din cache)
+    void swapRemove(std::size_t slot)
+    {
+        const std::size_t last = weights_.size() - 1;
+        const double moved = weights_[last];
+        set(last, 0.0);
+        if (slot != last)
+            set(slot, moved);
+        weights_.pop_back();
+        tree_.pop_back(); // nodul ultimului slot nu e inclus in nodurile anterioare
+    }
+
+    // rescrie toate ponderile (weightOf(slot)) si reconstruieste arborele o singura data
+    template <typename F>
+    void assign(F &&weightOf)
+    {
+        for (std::size_t slot = 0; slot < weights_.size(); ++slot)
+            weights_[slot] = weightOf(slot);
+        rebuild();
+    }
+
+    // reconstruieste arborele in O(n) (elimina erorile de rotunjire acumulate)
+    void rebuild()
+    {
+        tree_.assign(weights_.size() + 1, 0.0);
+        for (std::size_t i = 1; i < tree_.size(); ++i)
+        {
+            tree_[i] += weights_[i - 1];
+            const std::size_t parent = i + lowbit(i);
+            if (parent < tree_.size())
+                tree_[parent] += tree_[i];
+        }
+    }
+
+    // slot-ul ales pentru u uniform in [0, 1); nullopt daca toate ponderile sunt 0
+    std::optional<std::size_t> sample(double u) const
+    {
+        const double sum = total();
+        if (weights_.empty() || !(sum > 0.0))
+            return std::nullopt;
+
+        // coboram in arbore: cel mai mic slot cu suma prefixului > target
+        double target = u * sum;
+        std::size_t pos = 0;
+        for (std::size_t step = std::bit_floor(weights_.size()); step; step >>= 1)
+        {
+            if (pos + step < tree_.size() && tree_[pos + step] <= target)
+            {
+                pos += step;
+                target -= tree_[pos];
+            }
+        }
+
+        // rotunjirile pot duce dupa ultimul slot sau pe un slot cu pondere 0
+        if (pos >= weights_.size())
+            pos = weights_.size() - 1;
+        while (pos > 0 && !(weights_[pos] > 0.0))
+            --pos;
+        if (!(weights_[pos] > 0.0))
+            return std::nullopt;
+        return pos;
+    }
+};
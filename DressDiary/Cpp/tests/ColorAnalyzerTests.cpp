@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <future>
+#include <random>
+#include <string>
+#include <vector>
+#include "ColorAnalyzer.hpp"
+#include "Executor.hpp"
+
+// nucleele SIMD si scalare dau acelasi rezultat (inclusiv pe coada care nu umple un vector),
+// numele culorilor, ignorarea fundalului si loturile
+
+namespace
+{
+    RgbaImage solid(std::size_t width, std::size_t height, std::uint8_t r, std::uint8_t g, std::uint8_t b,
+                    std::uint8_t a = 255)
+    {
+        RgbaImage image;
+        image.width = width;
+        image.height = height;
+        image.pixels.resize(width * height * 4);
+        for (std::size_t i = 0; i < width * height; ++i)
+        {
+            image.pixels[i * 4 + 0] = r;
+            image.pixels[i * 4 + 1] = g;
+            image.pixels[i * 4 + 2] = b;
+            image.pixels[i * 4 + 3] = a;
+        }
+        return image;
+    }
+
+    // dreptunghiul [x0, x1) x [y0, y1), opac
+    void fill(RgbaImage &image, std::size_t x0, std::size_t y0, std::size_t x1, std::size_t y1,
+              std::uint8_t r, std::uint8_t g, std::uint8_t b)
+    {
+        for (std::size_t y = y0; y < y1; ++y)
+            for (std::size_t x = x0; x < x1; ++x)
+            {
+                std::uint8_t *p = image.pixels.data() + (y * image.width + x) * 4;
+                p[0] = r;
+                p[1] = g;
+                p[2] = b;
+                p[3] = 255;
+            }
+    }
+
+    RgbaImage noise(std::size_t width, std::size_t height, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        RgbaImage image;
+        image.width = width;
+        image.height = height;
+        image.pixels.resize(width * height * 4);
+        for (auto &byte : image.pixels)
+            byte = static_cast<std::uint8_t>(rng());
+        return image;
+    }
+
+    void expectSameAnalysis(const ColorAnalyzer::Analysis &a, const ColorAnalyzer::Analysis &b)
+    {
+        EXPECT_EQ(a.width, b.width);
+        EXPECT_EQ(a.height, b.height);
+        ASSERT_EQ(a.colors.size(), b.colors.size());
+        for (std::size_t i = 0; i < a.colors.size(); ++i)
+        {
+            EXPECT_EQ(a.colors[i].name, b.colors[i].name);
+            EXPECT_EQ(a.colors[i].share, b.colors[i].share);
+            EXPECT_EQ(a.colors[i].r, b.colors[i].r);
+            EXPECT_EQ(a.colors[i].g, b.colors[i].g);
+            EXPECT_EQ(a.colors[i].b, b.colors[i].b);
+        }
+    }
+}
+
+// SSE2 cuantizeaza 4 pixeli pe iteratie, NEON 16: toate lungimile pana la 67 trec prin coada
+TEST(ColorAnalyzerTest, QuantizeKernelsMatchIncludingTail)
+{
+    const RgbaImage image = noise(67, 1, 7);
+    for (std::size_t pixels = 0; pixels <= image.pixelCount(); ++pixels)
+    {
+        std::vector<std::uint16_t> simd(pixels + 1, 0xFFFF), scalar(pixels + 1, 0xFFFF);
+        ColorAnalyzer::quantize(image.pixels.data(), pixels, simd.data(), ColorAnalyzer::Kernel::Simd);
+        ColorAnalyzer::quantize(image.pixels.data(), pixels, scalar.data(), ColorAnalyzer::Kernel::Scalar);
+        EXPECT_EQ(simd, scalar) << pixels << " pixeli";
+        EXPECT_EQ(simd.back(), 0xFFFF) << "scriere dupa ultimul pixel la " << pixels;
+    }
+}
+
+// randurile unui bloc au dst.width * f * 4 octeti: latimile alese nu sunt multipli de 16 octeti
+TEST(ColorAnalyzerTest, DownsampleKernelsMatchOnOddWidths)
+{
+    const std::size_t sizes[][3] = {{7, 5, 3}, {13, 9, 64}, {131, 97, 64}, {1030, 771, 64}, {257, 3, 16}};
+    for (const auto &[width, height, maxSide] : sizes)
+    {
+        const RgbaImage image = noise(width, height, static_cast<std::uint32_t>(width * 31 + height));
+        RgbaImage simd, scalar;
+        ColorAnalyzer::downsample(image, maxSide, simd, ColorAnalyzer::Kernel::Simd);
+        ColorAnalyzer::downsample(image, maxSide, scalar, ColorAnalyzer::Kernel::Scalar);
+        EXPECT_EQ(simd.width, scalar.width);
+        EXPECT_EQ(simd.height, scalar.height);
+        EXPECT_EQ(simd.pixels, scalar.pixels) << width << " x " << height;
+    }
+}
+
+TEST(ColorAnalyzerTest, AnalysisDoesNotDependOnTheKernel)
+{
+    const RgbaImage image = noise(301, 203, 11);
+    expectSameAnalysis(ColorAnalyzer::analyzePixels(image, ColorAnalyzer::Kernel::Simd),
+                       ColorAnalyzer::analyzePixels(image, ColorAnalyzer::Kernel::Scalar));
+}
+
+TEST(ColorAnalyzerTest, KnownColorsMapToVocabularyNames)
+{
+    const struct
+    {
+        std::uint8_t r, g, b;
+        const char *name;
+    } cases[] = {
+        {220, 30, 30, "red"},
+        {240, 140, 20, "orange"},
+        {240, 220, 40, "yellow"},
+        {40, 160, 60, "green"},
+        {30, 60, 200, "blue"},
+        {130, 40, 170, "purple"},
+        {240, 150, 190, "pink"},
+        {120, 70, 30, "brown"},
+        {20, 20, 20, "black"},
+        {245, 245, 245, "white"},
+        {128, 128, 128, "gray"},
+    };
+    for (const auto &c : cases)
+    {
+        const auto analysis = ColorAnalyzer::analyzePixels(solid(40, 30, c.r, c.g, c.b));
+        EXPECT_EQ(analysis.dominant(), c.name) << int(c.r) << "," << int(c.g) << "," << int(c.b);
+        ASSERT_EQ(analysis.colors.size(), 1u);
+        EXPECT_EQ(analysis.colors.front().share, 1.0f);
+    }
+}
+
+// fundalul uniform de pe margine nu conteaza cand articolul ocupa destul din centru
+TEST(ColorAnalyzerTest, BackgroundIsIgnored)
+{
+    RgbaImage image = solid(64, 64, 245, 245, 245);
+    fill(image, 16, 16, 48, 48, 30, 60, 200);
+    const auto analysis = ColorAnalyzer::analyzePixels(image);
+    ASSERT_EQ(analysis.colors.size(), 1u);
+    EXPECT_EQ(analysis.dominant(), "blue");
+}
+
+TEST(ColorAnalyzerTest, TransparentPixelsAreIgnored)
+{
+    RgbaImage image = solid(64, 64, 240, 220, 40, 0);
+    fill(image, 24, 24, 40, 40, 220, 30, 30);
+    const auto analysis = ColorAnalyzer::analyzePixels(image);
+    ASSERT_EQ(analysis.colors.size(), 1u);
+    EXPECT_EQ(analysis.dominant(), "red");
+    EXPECT_TRUE(ColorAnalyzer::analyzePixels(solid(64, 64, 220, 30, 30, 0)).empty());
+}
+
+TEST(ColorAnalyzerTest, BatchMatchesPerImageAnalysis)
+{
+    std::vector<RgbaImage> images;
+    for (std::uint32_t i = 0; i < 9; ++i)
+        images.push_back(noise(50 + i * 37, 40 + i * 23, i));
+    images.push_back(solid(33, 17, 40, 160, 60));
+    images.push_back(RgbaImage{});
+
+    Executor executor(3);
+    const auto batch = ColorAnalyzer::analyzePixelsBatch(images, executor);
+    ASSERT_EQ(batch.size(), images.size());
+    for (std::size_t i = 0; i < images.size(); ++i)
+        expectSameAnalysis(batch[i], ColorAnalyzer::analyzePixels(images[i]));
+    EXPECT_TRUE(ColorAnalyzer::analyzePixelsBatch({}, executor).empty());
+}
+
+// un lot pornit din job-urile executorului insusi (ca din bridge) nu asteapta coada ocupata
+TEST(ColorAnalyzerTest, BatchRunsInsideTheExecutorsOwnJobs)
+{
+    std::vector<RgbaImage> images;
+    for (std::uint32_t i = 0; i < 6; ++i)
+        images.push_back(noise(40, 30, i));
+
+    Executor executor(2);
+    std::vector<std::future<std::size_t>> jobs;
+    for (int j = 0; j < 4; ++j)
+        jobs.push_back(executor.submit([&] { return ColorAnalyzer::analyzePixelsBatch(images, executor).size(); }));
+    for (auto &job : jobs)
+        EXPECT_EQ(job.get(), images.size());
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "BlobStore.hpp"
+#include "DataManager.hpp"
+#include "ItemFactory.hpp"
+#include "NativeBackend.hpp"
+
+// Mai multe thread-uri apeleaza simultan API-ul DataManager (citiri, scrieri, stergeri, loturi,
+// purtari, filtre, sugestii) pe aceiasi useri. Rulat cu -DDRESSDIARY_SANITIZE=thread verifica
+// lipsa data race-urilor; la final cache-ul trebuie sa fie identic cu backend-ul, iar refcount-urile
+// din BlobStore sa corespunda articolelor ramase.
+
+namespace
+{
+    constexpr int Threads = 8;
+    constexpr int OpsPerThread = 400;
+    constexpr int Users = 2;
+
+    std::vector<std::uint8_t> image(int variant)
+    {
+        return std::vector<std::uint8_t>(256, static_cast<std::uint8_t>(variant));
+    }
+
+    ItemRecord makeItem(DataManager &dm, int variant)
+    {
+        auto &table = SymbolTable::getInstance();
+        static const Symbol categories[] = {symbols::Top, symbols::Pants, symbols::Jacket, symbols::Shoes};
+        ItemRecord item;
+        item.id = dm.generateNextClothingItemId();
+        item.category = categories[variant % 4];
+        item.color = table.intern(variant % 2 ? "red" : "black");
+        item.materials.push_back(table.intern("cotton"));
+        item.payload = defaultPayload(item.category);
+        item.image = ImageBlob(image(variant % 4));
+        return item;
+    }
+
+    class DataManagerStressTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            root = std::filesystem::temp_directory_path() / ("dressdiary-stress-" + std::to_string(::getpid()));
+            std::filesystem::remove_all(root);
+            std::filesystem::create_directories(root / "snapshots");
+
+            blobs = std::make_shared<BlobStore>((root / "blobs").string());
+            DataManager &dm = DataManager::getInstance();
+            dm.setBackend(std::make_shared<NativeBackend>((root / "log.bin").string(), blobs));
+            dm.setBlobStore(blobs);
+            dm.setSnapshotDirectory((root / "snapshots").string());
+            dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Allow);
+            for (int u = 0; u < Users; ++u)
+            {
+                const std::string name = "stress" + std::to_string(u);
+                ASSERT_TRUE(dm.createUser(name, name, "p"));
+                ASSERT_TRUE(dm.loginUser(name, "p"));
+            }
+        }
+
+        void TearDown() override
+        {
+            DataManager &dm = DataManager::getInstance();
+            dm.waitForPersistence();
+            dm.waitForSnapshots();
+            dm.setItemsChangedCallback(nullptr);
+            dm.setOutfitsChangedCallback(nullptr);
+            dm.setSnapshotDirectory("");
+            dm.setBlobStore(nullptr);
+            dm.setBackend(std::make_shared<NativeBackend>());
+            std::filesystem::remove_all(root);
+        }
+
+        std::filesystem::path root;
+        std::shared_ptr<BlobStore> blobs;
+    };
+}
+
+TEST_F(DataManagerStressTest, ConcurrentReadersAndWriters)
+{
+    DataManager &dm = DataManager::getInstance();
+    std::atomic<int> notifications{0};
+    dm.setItemsChangedCallback([&](const std::string &, const DataManager::ItemsDelta &) { ++notifications; });
+    dm.setOutfitsChangedCallback([&](const std::string &, const DataManager::OutfitsDelta &) { ++notifications; });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t)
+        threads.emplace_back([&dm, t]
+                             {
+                                 const std::string user = "stress" + std::to_string(t % Users);
+                                 for (int i = 0; i < OpsPerThread; ++i)
+                                 {
+                                     switch ((i + t) % 10)
+                                     {
+                                     case 0:
+                                         dm.saveItemRecord(user, makeItem(dm, i));
+                                         break;
+                                     case 1:
+                                     {
+                                         std::vector<ItemRecord> batch;
+                                         for (int k = 0; k < 3; ++k)
+                                             batch.push_back(makeItem(dm, i + k));
+                                         dm.submitSaveClothingItems(user, batch);
+                                         break;
+                                     }
+                                     case 2:
+                                     {
+                                         // inlocuieste imaginea unui articol existent
+                                         auto items = dm.getItemRecords(user);
+                                         if (!items.empty())
+                                         {
+                                             ItemRecord item = items[i % items.size()];
+                                             item.image = ImageBlob(image(i + 1));
+                                             dm.submitSaveItemRecord(user, std::move(item));
+                                         }
+                                         break;
+                                     }
+                                     case 3:
+                                     {
+                                         auto items = dm.getItemRecords(user);
+                                         if (!items.empty())
+                                             dm.submitDeleteClothingItem(user, items[i % items.size()].id);
+                                         break;
+                                     }
+                                     case 4:
+                                     {
+                                         auto items = dm.getItemRecords(user);
+                                         std::vector<int> ids;
+                                         for (std::size_t k = 0; k < items.size() && k < 3; ++k)
+                                             ids.push_back(items[(i + k) % items.size()].id);
+                                         auto outfit = ItemFactory::createOutfit(dm.generateNextOutfitId(), "stress",
+                                                                                 Date::today(), i % 2 ? "vara" : "iarna",
+                                                                                 {}, ids);
+                                         dm.submitSaveOutfit(user, *outfit);
+                                         break;
+                                     }
+                                     case 5:
+                                     {
+                                         auto outfits = dm.getOutfits(user);
+                                         if (!outfits.empty())
+                                         {
+                                             const auto &outfit = outfits[i % outfits.size()];
+                                             if (i % 3)
+                                                 dm.submitMarkOutfitWorn(user, outfit->getId(), Date::today() - i % 30);
+                                             else
+                                                 dm.submitDeleteOutfit(user, outfit->getId());
+                                         }
+                                         break;
+                                     }
+                                     case 6:
+                                         dm.getResolvedOutfits(user);
+                                         dm.getColorHistogram(user);
+                                         dm.getWearStats(user);
+                                         break;
+                                     case 7:
+                                         dm.getTodaySuggestion(user);
+                                         dm.getItemBatch(user);
+                                         break;
+                                     case 8:
+                                         dm.filterClothingItems(user, {"red"}, {"cotton"}, {});
+                                         dm.filterOutfits(user, {"vara"});
+                                         dm.findNearDuplicateOutfits(user, 0.5);
+                                         break;
+                                     case 9:
+                                         dm.countClothingItems(user, "black", "top");
+                                         dm.getNeverWornItems(user);
+                                         break;
+                                     }
+                                 } });
+    for (auto &thread : threads)
+        thread.join();
+    dm.waitForPersistence();
+    dm.waitForSnapshots();
+    EXPECT_GT(notifications.load(), 0);
+
+    std::map<std::string, std::uint32_t> expectedRefs;
+    for (int u = 0; u < Users; ++u)
+    {
+        const std::string user = "stress" + std::to_string(u);
+        auto cached = dm.getItemRecords(user);
+        const std::size_t outfits = dm.getOutfitCount(user);
+
+        // dupa reincarcarea din backend (sau din snapshot) garderoba e aceeasi
+        dm.evictCache(user);
+        auto reloaded = dm.getItemRecords(user);
+        auto byId = [](const ItemRecord &a, const ItemRecord &b) { return a.id < b.id; };
+        std::sort(cached.begin(), cached.end(), byId);
+        std::sort(reloaded.begin(), reloaded.end(), byId);
+        ASSERT_EQ(reloaded.size(), cached.size()) << user;
+        EXPECT_EQ(dm.getOutfitCount(user), outfits) << user;
+        for (std::size_t k = 0; k < cached.size(); ++k)
+        {
+            EXPECT_EQ(reloaded[k].id, cached[k].id);
+            EXPECT_EQ(reloaded[k].image.key(), cached[k].image.key());
+        }
+        for (const auto &item : reloaded)
+            if (!item.image.key().empty())
+                ++expectedRefs[item.image.key()];
+    }
+
+    // fiecare imagine e retinuta exact o data pentru fiecare articol care o foloseste
+    for (const auto &[key, refs] : expectedRefs)
+    {
+        EXPECT_TRUE(blobs->contains(key));
+        EXPECT_EQ(blobs->refCount(key), refs) << key;
+    }
+}
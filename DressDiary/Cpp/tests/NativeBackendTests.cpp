@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "ItemFactory.hpp"
+#include "NativeBackend.hpp"
+
+// persistenta NativeBackend: ce ramane in log dupa redeschidere
+
+namespace
+{
+    const Date Day = *Date::fromCivil(2024, 3, 1);
+
+    class NativeBackendTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            logPath = std::filesystem::temp_directory_path() /
+                      ("dressdiary-native-" + std::to_string(::getpid()) + "-" +
+                       ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".log");
+            std::filesystem::remove(logPath);
+            backend = std::make_unique<NativeBackend>(logPath.string());
+            ASSERT_TRUE(backend->isOpen());
+            ASSERT_TRUE(backend->createUser("ana", "Ana", "p"));
+        }
+
+        void TearDown() override
+        {
+            backend.reset();
+            std::filesystem::remove(logPath);
+        }
+
+        void reopen()
+        {
+            backend.reset();
+            backend = std::make_unique<NativeBackend>(logPath.string());
+        }
+
+        int saveItem()
+        {
+            ItemRecord item;
+            item.id = backend->generateNextClothingItemId();
+            item.category = symbols::Top;
+            item.color = SymbolTable::getInstance().intern("black");
+            item.payload = defaultPayload(item.category);
+            EXPECT_TRUE(backend->saveClothingItem(user, item));
+            return item.id;
+        }
+
+        std::filesystem::path logPath;
+        std::unique_ptr<NativeBackend> backend;
+        const UserHandle user{"ana"};
+    };
+}
+
+// salvarea unui outfit existent il actualizeaza (ca objcSaveOutfit), nu adauga un rand nou
+TEST_F(NativeBackendTest, SavingAnOutfitTwiceKeepsOneRow)
+{
+    const int shirt = saveItem();
+    const int pants = saveItem();
+    auto outfit = ItemFactory::createOutfit(backend->generateNextOutfitId(), "before", Day, "Summer", {}, {shirt});
+    ASSERT_TRUE(backend->saveOutfit(user, *outfit));
+    outfit->setName("after");
+    outfit->setItemIds({shirt, pants});
+    ASSERT_TRUE(backend->saveOutfit(user, *outfit));
+
+    reopen();
+    auto outfits = backend->fetchOutfits(user);
+    ASSERT_EQ(outfits.size(), 1u);
+    EXPECT_EQ(outfits.front()->getId(), outfit->getId());
+    EXPECT_EQ(outfits.front()->getName(), "after");
+    EXPECT_EQ(outfits.front()->getItemIds(), (std::vector<int>{shirt, pants}));
+}
+
+// id-urile sterse nu se refolosesc dupa redeschidere (purtarile vechi raman pe id-ul vechi)
+TEST_F(NativeBackendTest, DeletedItemIdsAreNotReissued)
+{
+    saveItem();
+    const int last = saveItem();
+    ASSERT_TRUE(backend->deleteClothingItem(user, last));
+
+    reopen();
+    EXPECT_GT(backend->generateNextClothingItemId(), last);
+}
+
+// un antet corupt la coada (lungime uriasa) se trateaza ca o inregistrare incompleta:
+// fara alocare, log-ul se taie la ultima inregistrare valida si scrierile noi se pastreaza
+TEST_F(NativeBackendTest, OversizedTailHeaderIsTruncated)
+{
+    const int shirt = saveItem();
+    backend.reset();
+    {
+        std::FILE *log = std::fopen(logPath.string().c_str(), "ab");
+        ASSERT_NE(log, nullptr);
+        const unsigned char header[] = {0xF0, 0xFF, 0xFF, 0xFF, 4, 1, 2, 3};
+        std::fwrite(header, 1, sizeof(header), log);
+        std::fclose(log);
+    }
+
+    reopen();
+    ASSERT_TRUE(backend->isOpen());
+    const int pants = saveItem();
+    reopen();
+    auto items = backend->fetchClothingItems(user);
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_EQ(items.front().id, shirt);
+    EXPECT_EQ(items.back().id, pants);
+}
+
+// o cadere care pierde coada nesincronizata: scrierile de dupa ajung la aceleasi pozitii in log,
+// dar versiunea difera, deci un snapshot scris inainte de cadere nu mai e acceptat
+TEST_F(NativeBackendTest, RevisionsAreNotReusedAfterALostTail)
+{
+    saveItem();
+    backend.reset();
+    const auto durableSize = std::filesystem::file_size(logPath);
+
+    reopen();
+    const int lostId = saveItem();
+    const std::uint64_t lost = backend->dataRevision(user);
+    backend.reset();
+    std::filesystem::resize_file(logPath, durableSize);
+
+    reopen();
+    const std::uint64_t before = backend->dataRevision(user);
+    ItemRecord item;
+    item.id = lostId;
+    item.category = symbols::Top;
+    item.color = SymbolTable::getInstance().intern("black");
+    item.payload = defaultPayload(item.category);
+    ASSERT_TRUE(backend->saveClothingItem(user, item));
+    const std::uint64_t after = backend->dataRevision(user);
+    EXPECT_NE(before, after);
+    EXPECT_NE(after, lost);
+    EXPECT_NE(after, 0u);
+
+    // fara scrieri noi, versiunea se reface identic la replay (snapshot-ul ramane valid)
+    reopen();
+    EXPECT_EQ(backend->dataRevision(user), after);
+}
+
+// saveOutfits scrie tot lotul ca o singura inregistrare: o scriere intrerupta nu lasa nimic din el
+TEST_F(NativeBackendTest, SaveOutfitsIsAllOrNothing)
+{
+    const int shirt = saveItem();
+    const int pants = saveItem();
+    const std::vector<Outfit> batch = {
+        *ItemFactory::createOutfit(backend->generateNextOutfitId(), "a", Day, "Summer", {}, {shirt}),
+        *ItemFactory::createOutfit(backend->generateNextOutfitId(), "b", Day, "Summer", {}, {shirt, pants})};
+    ASSERT_TRUE(backend->saveOutfits(user, batch));
+    EXPECT_EQ(backend->fetchOutfits(user).size(), 2u);
+
+    backend.reset();
+    std::filesystem::resize_file(logPath, std::filesystem::file_size(logPath) - 1);
+    reopen();
+    EXPECT_TRUE(backend->fetchOutfits(user).empty());
+    EXPECT_EQ(backend->fetchClothingItems(user).size(), 2u);
+}
+
+// un lot cu o inregistrare invalida (categorie necunoscuta) nu se aplica deloc, nici dupa replay
+TEST_F(NativeBackendTest, BatchWithAnInvalidRecordAppliesNothing)
+{
+    const int kept = saveItem();
+    std::vector<ItemRecord> batch(2);
+    for (auto &item : batch)
+    {
+        item.id = backend->generateNextClothingItemId();
+        item.category = symbols::Top;
+        item.color = SymbolTable::getInstance().intern("white");
+        item.payload = defaultPayload(item.category);
+    }
+    batch.back().category = SymbolTable::getInstance().intern("hat");
+    const auto revision = backend->dataRevision(user);
+
+    EXPECT_FALSE(backend->saveClothingItems(user, batch));
+    EXPECT_EQ(backend->fetchClothingItems(user).size(), 1u);
+    EXPECT_EQ(backend->dataRevision(user), revision);
+
+    reopen();
+    auto items = backend->fetchClothingItems(user);
+    ASSERT_EQ(items.size(), 1u);
+    EXPECT_EQ(items.front().id, kept);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DataManager.hpp"
+#include "NativeBackend.hpp"
+#include "SessionManager.hpp"
+
+// Test de incarcare: mii de useri cu cate doua sesiuni, folositi simultan din mai multe thread-uri
+// (login, scrieri si citiri prin token, aplicarea bugetului de memorie, logout, expirare).
+// Verifica shard-urile SessionManager si lock-urile per user din DataManager: fiecare sesiune
+// primeste exact notificarile userului ei, iar garderobele eliberate din cache se reincarca intregi.
+
+namespace
+{
+    constexpr std::size_t Users = 2000;
+    constexpr std::size_t SessionsPerUser = 2;
+    constexpr std::size_t Threads = 16;
+    constexpr std::size_t OpsPerThread = 2500;
+
+    std::string username(std::size_t u)
+    {
+        return "load" + std::to_string(u);
+    }
+
+    ItemRecord makeItem(DataManager &dm, std::size_t variant)
+    {
+        static const Symbol categories[] = {symbols::Top, symbols::Pants, symbols::Jacket, symbols::Shoes};
+        ItemRecord item;
+        item.id = dm.generateNextClothingItemId();
+        item.category = categories[variant % 4];
+        item.color = SymbolTable::getInstance().intern(variant % 2 ? "blue" : "white");
+        item.payload = defaultPayload(item.category);
+        return item;
+    }
+
+    template <typename F>
+    void parallel(std::size_t threads, F &&body)
+    {
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t)
+            workers.emplace_back([&body, t] { body(t); });
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    class SessionLoadTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            DataManager &dm = DataManager::getInstance();
+            dm.setBackend(std::make_shared<NativeBackend>());
+            for (std::size_t u = 0; u < Users; ++u)
+                ASSERT_TRUE(dm.createUser(username(u), username(u), "p"));
+        }
+
+        void TearDown() override
+        {
+            DataManager::getInstance().waitForPersistence();
+        }
+    };
+}
+
+TEST_F(SessionLoadTest, ThousandsOfConcurrentUsers)
+{
+    DataManager &dm = DataManager::getInstance();
+    SessionManager sessions(dm);
+
+    std::vector<SessionManager::Token> tokens(Users * SessionsPerUser);
+    std::vector<std::atomic<std::size_t>> notified(Users);
+    std::vector<std::atomic<std::size_t>> saved(Users);
+    std::atomic<std::size_t> foreign{0};
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // login-uri in paralel; callback-urile numara notificarile primite de fiecare user
+    parallel(Threads, [&](std::size_t t)
+             {
+                 for (std::size_t u = t; u < Users; u += Threads)
+                     for (std::size_t s = 0; s < SessionsPerUser; ++s)
+                     {
+                         SessionManager::Token token = sessions.login(username(u), "p");
+                         ASSERT_FALSE(token.empty());
+                         const std::string owner = username(u);
+                         sessions.setCallbacks(token,
+                                               [&, u, owner](const DataManager::ItemsDelta &delta)
+                                               {
+                                                   ++notified[u];
+                                                   // articolele adaugate trebuie sa fie ale acestui user
+                                                   for (int id : delta.added)
+                                                   {
+                                                       auto page = dm.getItemRecordPage(owner, id - 1, 1);
+                                                       if (page.empty() || page.front().id != id)
+                                                           ++foreign;
+                                                   }
+                                               },
+                                               nullptr);
+                         tokens[u * SessionsPerUser + s] = std::move(token);
+                     } });
+    ASSERT_EQ(sessions.userCount(), Users);
+    ASSERT_EQ(sessions.sessionCount(), Users * SessionsPerUser);
+
+    // operatii amestecate pe useri alesi aleator, cu bugetul de memorie aplicat in paralel
+    std::atomic<bool> running{true};
+    std::atomic<std::size_t> evictions{0};
+    std::thread budget([&]
+                       {
+                           sessions.setMemoryBudget(256 * 1024);
+                           while (running.load())
+                           {
+                               evictions += sessions.enforceMemoryBudget();
+                               sessions.expireIdle(std::chrono::hours(1));
+                               std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                           } });
+
+    parallel(Threads, [&](std::size_t t)
+             {
+                 std::mt19937_64 random(t + 1);
+                 for (std::size_t i = 0; i < OpsPerThread; ++i)
+                 {
+                     const std::size_t u = random() % Users;
+                     const SessionManager::Token &token = tokens[u * SessionsPerUser + random() % SessionsPerUser];
+                     const std::string user = sessions.username(token);
+                     ASSERT_EQ(user, username(u));
+                     switch (i % 5)
+                     {
+                     case 0:
+                         if (dm.saveItemRecord(user, makeItem(dm, i)))
+                             ++saved[u];
+                         break;
+                     case 1:
+                         dm.getItemRecords(user);
+                         break;
+                     case 2:
+                         dm.filterClothingItems(user, {"blue"}, {}, {"top"});
+                         break;
+                     case 3:
+                         dm.getTodaySuggestion(user);
+                         dm.getClothingItemsCount(user);
+                         break;
+                     case 4:
+                         ASSERT_NE(sessions.find(token), nullptr);
+                         break;
+                     }
+                 } });
+    running = false;
+    budget.join();
+    dm.waitForPersistence();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%zu users, %zu sessions, %zu ops in %.2fs (%.0f ops/s), %zu budget evictions\n", Users,
+                Users * SessionsPerUser, Threads * OpsPerThread, seconds, Threads * OpsPerThread / seconds,
+                evictions.load());
+    EXPECT_GT(evictions.load(), 0u);
+    EXPECT_EQ(foreign.load(), 0u);
+
+    // fiecare sesiune a primit exact schimbarile userului ei; garderobele eliberate se reincarca intregi
+    for (std::size_t u = 0; u < Users; ++u)
+    {
+        ASSERT_EQ(notified[u].load(), saved[u].load() * SessionsPerUser) << username(u);
+        ASSERT_EQ(dm.getClothingItemsCount(username(u)), saved[u].load()) << username(u);
+    }
+
+    // o sesiune inchisa per user: userii raman deschisi prin cealalta
+    parallel(Threads, [&](std::size_t t)
+             {
+                 for (std::size_t u = t; u < Users; u += Threads)
+                     EXPECT_TRUE(sessions.logout(tokens[u * SessionsPerUser])); });
+    EXPECT_EQ(sessions.sessionCount(), Users);
+    EXPECT_EQ(sessions.userCount(), Users);
+    EXPECT_EQ(sessions.find(tokens[0]), nullptr);
+    EXPECT_NE(sessions.find(tokens[1]), nullptr);
+
+    // expirarea inchide restul
+    EXPECT_EQ(sessions.expireIdle(std::chrono::seconds(0)), Users);
+    EXPECT_EQ(sessions.sessionCount(), 0u);
+    EXPECT_EQ(sessions.userCount(), 0u);
+}
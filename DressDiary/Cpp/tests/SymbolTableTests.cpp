@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include "SymbolTable.hpp"
+#include "Utilities.hpp"
+
+TEST(SymbolTableTest, FoldPointsToLowercaseForm)
+{
+    auto &table = SymbolTable::getInstance();
+    const Symbol mixed = table.intern("Navy-Blue");
+    const Symbol lower = table.intern("navy-blue");
+    EXPECT_NE(mixed, lower);
+    EXPECT_EQ(table.fold(mixed), lower);
+    EXPECT_EQ(table.fold(lower), lower);
+    EXPECT_EQ(table.name(mixed), "Navy-Blue");
+    EXPECT_EQ(table.intern("Navy-Blue"), mixed);
+}
+
+TEST(SymbolTableTest, UnknownIdsFoldToEmpty)
+{
+    auto &table = SymbolTable::getInstance();
+    const Symbol past = static_cast<Symbol>(table.size() + 100);
+    EXPECT_EQ(table.fold(past), symbols::Empty);
+    EXPECT_EQ(table.name(past), "");
+}
+
+// citirile nu iau lock: orice intrare publicata (id < size()) trebuie sa aiba deja forma
+// cu litere mici, chiar daca alt thread interneaza valori noi in acelasi timp
+TEST(SymbolTableTest, PublishedEntriesAreCompleteWhileInterning)
+{
+    auto &table = SymbolTable::getInstance();
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> mismatches{0};
+
+    std::thread reader([&]
+                       {
+                           while (!done.load(std::memory_order_acquire))
+                           {
+                               const std::size_t n = table.size();
+                               for (std::size_t id = n > 64 ? n - 64 : 0; id < n; ++id)
+                               {
+                                   const Symbol s = static_cast<Symbol>(id);
+                                   if (table.name(table.fold(s)) != toLowerAscii(table.name(s)))
+                                       ++mismatches;
+                               }
+                           } });
+
+    for (int i = 0; i < 20000; ++i)
+        table.intern("Concurrent-Value-" + std::to_string(i));
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0u);
+}
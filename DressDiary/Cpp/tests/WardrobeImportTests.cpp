@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "DataManager.hpp"
+#include "ItemFactory.hpp"
+#include "NativeBackend.hpp"
+
+// exportWardrobe -> importWardrobe in alt cont: purtarile outfit-urilor care nu mai exista,
+// refuzul unui outfit duplicat (DuplicateOutfitPolicy::Reject) si importul tot-sau-nimic
+
+namespace
+{
+    const Date Day = *Date::fromCivil(2024, 3, 1);
+
+    class WardrobeImportTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            archive = std::filesystem::temp_directory_path() / ("dressdiary-import-" + std::to_string(::getpid()) + ".ddw");
+            DataManager &dm = DataManager::getInstance();
+            dm.setBackend(std::make_shared<NativeBackend>());
+            dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Allow);
+            for (const char *name : {"source", "target"})
+            {
+                ASSERT_TRUE(dm.createUser(name, name, "p"));
+                ASSERT_TRUE(dm.loginUser(name, "p"));
+            }
+        }
+
+        void TearDown() override
+        {
+            DataManager &dm = DataManager::getInstance();
+            dm.waitForPersistence();
+            dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Allow);
+            dm.setBackend(std::make_shared<NativeBackend>());
+            std::filesystem::remove(archive);
+        }
+
+        int saveItem()
+        {
+            DataManager &dm = DataManager::getInstance();
+            ItemRecord item;
+            item.id = dm.generateNextClothingItemId();
+            item.category = symbols::Top;
+            item.color = SymbolTable::getInstance().intern("black");
+            item.payload = defaultPayload(item.category);
+            EXPECT_TRUE(dm.saveClothingItems("source", std::span<const ItemRecord>(&item, 1)));
+            return item.id;
+        }
+
+        std::string saveOutfit(const std::vector<int> &itemIds)
+        {
+            DataManager &dm = DataManager::getInstance();
+            auto outfit = ItemFactory::createOutfit(dm.generateNextOutfitId(), "outfit", Day, "Summer", {}, itemIds);
+            EXPECT_TRUE(dm.saveOutfit("source", *outfit));
+            return outfit->getId();
+        }
+
+        std::filesystem::path archive;
+    };
+
+    // purtarile nu se pot scrie; importul foloseste varianta implicita (loturi separate + stergeri)
+    class FailingWearsBackend : public NativeBackend
+    {
+    public:
+        bool appendWearRecords(const UserHandle &, std::span<const WearRecord>) override { return false; }
+        bool importWardrobe(const UserHandle &user, std::span<const ItemRecord> items,
+                            std::span<const Outfit> outfits, std::span<const WearRecord> wears) override
+        {
+            return StorageBackend::importWardrobe(user, items, outfits, wears);
+        }
+    };
+}
+
+TEST_F(WardrobeImportTest, WearsOfMissingOutfitsAreNotImported)
+{
+    DataManager &dm = DataManager::getInstance();
+    const int shirt = saveItem();
+    const int jacket = saveItem();
+    const std::string kept = saveOutfit({shirt, jacket});
+    const std::string deleted = saveOutfit({shirt});
+    ASSERT_TRUE(dm.markOutfitWorn("source", kept, Day));
+    ASSERT_TRUE(dm.markOutfitWorn("source", deleted, Day));
+    ASSERT_TRUE(dm.deleteOutfit("source", deleted));
+
+    ASSERT_TRUE(dm.exportWardrobe("source", archive.string()));
+    ASSERT_TRUE(dm.importWardrobe("target", archive.string()));
+
+    auto outfits = dm.getOutfits("target");
+    ASSERT_EQ(outfits.size(), 1u);
+    const std::uint64_t importedKey = WearLog::outfitKey(outfits.front()->getId());
+
+    std::size_t outfitWears = 0, itemWears = 0, standalone = 0;
+    for (const WearRecord &record : dm.getWearRecords("target", Day, Day))
+    {
+        EXPECT_TRUE(record.outfitKey == importedKey || record.outfitKey == WearRecord::NoOutfit);
+        if (record.isOutfit())
+            ++outfitWears;
+        else
+            ++itemWears;
+        standalone += record.outfitKey == WearRecord::NoOutfit;
+    }
+    EXPECT_EQ(outfitWears, 1u);
+    // articolele outfit-ului sters raman purtate, ca purtari separate
+    EXPECT_EQ(itemWears, 3u);
+    EXPECT_EQ(standalone, 1u);
+}
+
+TEST_F(WardrobeImportTest, RejectedDuplicateLeavesNothingImported)
+{
+    DataManager &dm = DataManager::getInstance();
+    const int shirt = saveItem();
+    const int pants = saveItem();
+    saveOutfit({shirt, pants});
+    saveOutfit({pants, shirt});
+
+    ASSERT_TRUE(dm.exportWardrobe("source", archive.string()));
+    dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Reject);
+    EXPECT_FALSE(dm.importWardrobe("target", archive.string()));
+    EXPECT_EQ(dm.getClothingItemsCount("target"), 0u);
+    EXPECT_TRUE(dm.getOutfits("target").empty());
+}
+
+TEST_F(WardrobeImportTest, SaveOutfitsRejectsTheWholeBatch)
+{
+    DataManager &dm = DataManager::getInstance();
+    const int shirt = saveItem();
+    const int pants = saveItem();
+    dm.setDuplicateOutfitPolicy(DataManager::DuplicateOutfitPolicy::Reject);
+
+    std::vector<std::shared_ptr<Outfit>> batch = {
+        ItemFactory::createOutfit(dm.generateNextOutfitId(), "a", Day, "Summer", {}, {shirt}),
+        ItemFactory::createOutfit(dm.generateNextOutfitId(), "b", Day, "Summer", {}, {shirt, pants}),
+        ItemFactory::createOutfit(dm.generateNextOutfitId(), "c", Day, "Summer", {}, {pants, shirt})};
+    EXPECT_FALSE(dm.saveOutfits("source", batch));
+    EXPECT_TRUE(dm.getOutfits("source").empty());
+
+    batch.pop_back();
+    EXPECT_TRUE(dm.saveOutfits("source", batch));
+    EXPECT_EQ(dm.getOutfits("source").size(), 2u);
+}
+
+TEST_F(WardrobeImportTest, FailedWearsLeaveNothingImported)
+{
+    DataManager &dm = DataManager::getInstance();
+    const int shirt = saveItem();
+    const std::string outfit = saveOutfit({shirt});
+    ASSERT_TRUE(dm.markOutfitWorn("source", outfit, Day));
+    ASSERT_TRUE(dm.exportWardrobe("source", archive.string()));
+
+    auto backend = std::make_shared<FailingWearsBackend>();
+    dm.setBackend(backend);
+    ASSERT_TRUE(dm.createUser("target", "target", "p"));
+    ASSERT_TRUE(dm.loginUser("target", "p"));
+
+    EXPECT_FALSE(dm.importWardrobe("target", archive.string()));
+    dm.waitForPersistence();
+    EXPECT_EQ(dm.getClothingItemsCount("target"), 0u);
+    EXPECT_TRUE(dm.getOutfits("target").empty());
+    EXPECT_TRUE(dm.getWearRecords("target", Day, Day).empty());
+
+    const UserHandle user{"target"};
+    EXPECT_TRUE(backend->fetchClothingItems(user).empty());
+    EXPECT_TRUE(backend->fetchOutfits(user).empty());
+}
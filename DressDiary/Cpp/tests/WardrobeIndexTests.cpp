@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "Outfit.hpp"
+#include "SymbolTable.hpp"
+#include "WardrobeIndex.hpp"
+
+namespace
+{
+    ItemRecord item(int id, const std::string &color, Symbol category, const std::string &material)
+    {
+        auto &table = SymbolTable::getInstance();
+        ItemRecord record;
+        record.id = id;
+        record.color = table.intern(color);
+        record.category = category;
+        if (!material.empty())
+            record.materials.push_back(table.intern(material));
+        record.payload = defaultPayload(category);
+        return record;
+    }
+
+    std::vector<std::size_t> slots(const Bitset &hits)
+    {
+        std::vector<std::size_t> result;
+        hits.forEach([&](std::size_t slot) { result.push_back(slot); });
+        return result;
+    }
+
+    // slot 0 fara culoare / material, slot 1 "Red" din bumbac
+    class WardrobeIndexTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            index.insertItem(0, item(1, "", symbols::Top, ""));
+            index.insertItem(1, item(2, "Red", symbols::Pants, "cotton"));
+            index.insertOutfit(0, Outfit("o1", "fara sezon", "", Date()));
+            index.insertOutfit(1, Outfit("o2", "vara", "vara", Date()));
+        }
+
+        WardrobeIndex index;
+    };
+}
+
+TEST_F(WardrobeIndexTest, KnownValuesMatchIgnoringCase)
+{
+    EXPECT_EQ(slots(index.query({"red"}, {}, {})), std::vector<std::size_t>{1});
+    EXPECT_EQ(slots(index.query({"RED"}, {"Cotton"}, {"pants"})), std::vector<std::size_t>{1});
+    EXPECT_EQ(slots(index.query({}, {}, {"top"})), std::vector<std::size_t>{0});
+    EXPECT_EQ(slots(index.queryOutfits({"Vara"})), std::vector<std::size_t>{1});
+}
+
+TEST_F(WardrobeIndexTest, UnknownValuesMatchNothing)
+{
+    // o valoare care nu a fost internata niciodata nu trebuie sa ajunga la atributul gol
+    EXPECT_TRUE(index.query({"no-such-color"}, {}, {}).none());
+    EXPECT_TRUE(index.query({}, {"no-such-material"}, {}).none());
+    EXPECT_TRUE(index.query({}, {}, {"no-such-category"}).none());
+    EXPECT_TRUE(index.queryOutfits({"no-such-season"}).none());
+}
+
+TEST_F(WardrobeIndexTest, UnknownValuesAreSkippedAmongKnownOnes)
+{
+    const std::vector<std::string> colors = {"no-such-color", "red"};
+    const std::vector<std::string> seasons = {"no-such-season", "vara"};
+    EXPECT_EQ(slots(index.query(colors, {}, {})), std::vector<std::size_t>{1});
+    EXPECT_EQ(slots(index.queryOutfits(seasons)), std::vector<std::size_t>{1});
+}
+
+TEST_F(WardrobeIndexTest, UnknownSymbolsMatchNothing)
+{
+    const std::vector<Symbol> unknown = {WardrobeIndex::Unknown};
+    EXPECT_TRUE(index.query(unknown, {}, {}).none());
+    EXPECT_TRUE(index.queryOutfits(unknown).none());
+    // orice id inca nealocat se comporta la fel
+    const std::vector<Symbol> unallocated = {static_cast<Symbol>(SymbolTable::getInstance().size() + 10)};
+    EXPECT_TRUE(index.query({}, {}, unallocated).none());
+}
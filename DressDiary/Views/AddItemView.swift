@@ -16,6 +16,8 @@ struct AddItemView: View {
     @State private var showPicker: Bool = false
     @State private var showAlert: Bool = false
     @State private var alertMessage: String = ""
+    @State private var detectedColor: String? = nil
+    @State private var colorDetection: CppCancellable?
     private let categories = ["pants", "jacket", "top", "shoes"]
     private let colors = ["red","orange","yellow","green","blue","purple","pink","brown","black","white","gray","other"]
 
@@ -95,6 +97,11 @@ struct AddItemView: View {
                 .sheet(isPresented: $showPicker) {
                     ImagePicker(image: $image)
                 }
+                .onChange(of: image) { _, newImage in
+                    if let newImage {
+                        detectColor(in: newImage)
+                    }
+                }
 
                 Button("Save Item") {
                     save()
@@ -113,6 +120,7 @@ struct AddItemView: View {
             .padding(32)
         }
         .background(Color("BackgroundColor").ignoresSafeArea())
+        .onDisappear { colorDetection?.cancel() }
         .alert(isPresented: $showAlert) {
             Alert(title: Text("Error"), message: Text(alertMessage), dismissButton: .default(Text("OK")))
         }
@@ -124,9 +132,17 @@ struct AddItemView: View {
 
     private var colorSection: some View {
         VStack(alignment: .leading, spacing: 12) {
-            Text("Colors")
-                .font(.headline)
-                .padding(.horizontal)
+            HStack {
+                Text("Colors")
+                    .font(.headline)
+                Spacer()
+                if let detected = detectedColor {
+                    Text("Detected: \(detected)")
+                        .font(.footnote)
+                        .foregroundColor(.secondary)
+                }
+            }
+            .padding(.horizontal)
 
             LazyVGrid(columns: Array(repeating: GridItem(.flexible()), count: 6), spacing: 12) {
                 ForEach(colors, id: \.self) { colorOption in
@@ -165,6 +181,25 @@ struct AddItemView: View {
         }
     }
 
+    // culoarea dominanta se calculeaza in C++, in fundal; o alegere facuta deja de user ramane
+    private func detectColor(in image: UIImage) {
+        colorDetection?.cancel()
+        detectedColor = nil
+        DispatchQueue.global(qos: .userInitiated).async {
+            guard let data = image.jpegData(compressionQuality: 0.8) else { return }
+            DispatchQueue.main.async {
+                guard self.image === image else { return }
+                colorDetection = CppBridge.detectColor(forImage: data) { detected in
+                    guard let detected else { return }
+                    detectedColor = detected
+                    if color.isEmpty {
+                        color = detected
+                    }
+                }
+            }
+        }
+    }
+
     private func save() {
         guard let user = currentUsername,
               !color.isEmpty,
@@ -6,6 +6,7 @@ struct ClosetView: View {
     @State private var showAdd: Bool = false
     @State private var filteredItems: [ClothingItem]? = nil
     @State private var isFiltering: Bool = true
+    @State private var loading: CppCancellable?
     
     var body: some View {
         NavigationStack {
@@ -43,15 +44,18 @@ struct ClosetView: View {
             AddItemView()
         }
         .onAppear(perform: load)
+        .onDisappear { loading?.cancel() }
         .background(Color("BackgroundColor"))
     }
     
     private func load() {
-        guard let user = currentUsername,
-              let arr = CppBridge.fetchClothingItems(forUser: user) as? [[String: Any]] else { return }
-        
-        items = arr.enumerated().compactMap { idx, dict in
-            ClothingItem(dictionary: dict, fallbackId: idx)
+        loading?.cancel()
+        guard let user = currentUsername else { return }
+        // prima pagina apare imediat, restul se adauga pe masura ce vin
+        var received: [ClothingItem] = []
+        loading = CppBridge.fetchClothingItems(forUser: user, pageSize: 24) { page, _ in
+            received += (0..<page.count).map { ClothingItem(view: page.item(at: $0)) }
+            items = received
         }
     }
 }
@@ -42,8 +42,13 @@ extension ClothingItem {
             materials = []
         }
 
+        // cardurile folosesc thumbnail-ul generat la salvare, daca exista
         let resolvedImage: UIImage
-        if let data = dictionary["image"] as? Data,
+        if let thumb = dictionary["thumbnail"] as? Data,
+           !thumb.isEmpty,
+           let img = UIImage(data: thumb) {
+            resolvedImage = img
+        } else if let data = dictionary["image"] as? Data,
            !data.isEmpty,
            let img = UIImage(data: data) {
             resolvedImage = img
@@ -108,3 +113,25 @@ extension ClothingItem {
         )
     }
 }
+
+extension ClothingItem {
+    init(view: CppItemView) {
+        let thumbnail = view.thumbnail.flatMap { UIImage(data: $0) }
+        let image = thumbnail ?? (view.image.isEmpty ? nil : UIImage(data: view.image))
+
+        self = ClothingItem(
+            id: Int(view.itemId),
+            category: view.category,
+            color: view.color,
+            materials: view.materials,
+            subcategory: "",
+            image: image ?? UIImage(),
+            pantLength: view.pantLength?.doubleValue,
+            pantWaist: view.pantWaist,
+            jacketWaterproof: view.jacketWaterproof?.boolValue,
+            topSleeveType: view.topSleeveType,
+            topNeckline: view.topNeckline,
+            shoeSize: view.shoeSize?.doubleValue
+        )
+    }
+}
@@ -6,6 +6,7 @@ struct FilterPageView: View {
     var onShowAll: () -> Void
     var onAddItem: () -> Void
 
+    @AppStorage("currentUsername") private var currentUsername: String?
     @State private var selectedColors: Set<String> = []
     @State private var selectedMaterials: Set<String> = []
     @State private var selectedCategories: Set<String> = []
@@ -22,6 +23,11 @@ struct FilterPageView: View {
         ("Jackets","jacketIcon"), ("Shoes","shoesIcon"),
         ("Accessories","accessoriesIcon")
     ]
+    // numele categoriilor din C++ (ClothingItem::getCategory)
+    private let categoryKeys: [String: String] = [
+        "Tops": "top", "Pants": "pants", "Jackets": "jacket",
+        "Shoes": "shoes", "Accessories": "accessories"
+    ]
 
     var body: some View {
         ScrollView {
@@ -142,16 +148,19 @@ struct FilterPageView: View {
 
     private var applyButton: some View {
         Button("Apply Filters") {
-            let filtered = items.filter { item in
-                let matchColor = selectedColors.isEmpty
-                    || selectedColors.contains(item.color.lowercased())
-                let matchMat = selectedMaterials.isEmpty
-                    || item.materials.contains(where: { selectedMaterials.contains($0.lowercased()) })
-                let matchCat = selectedCategories.isEmpty
-                    || selectedCategories.contains(item.category)
-                return matchColor && matchMat && matchCat
+            guard let user = currentUsername else {
+                onFilterApplied([])
+                return
             }
-            onFilterApplied(filtered)
+            // filtrarea se face prin indexul din C++; aici doar selectam articolele deja incarcate
+            let ids = CppBridge.filterItemIds(
+                forUser: user,
+                colors: Array(selectedColors),
+                materials: Array(selectedMaterials),
+                categories: selectedCategories.compactMap { categoryKeys[$0] }
+            )
+            let matching = Set(ids.map { $0.intValue })
+            onFilterApplied(items.filter { matching.contains($0.id) })
         }
         .padding()
         .frame(maxWidth: .infinity)
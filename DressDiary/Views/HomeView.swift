@@ -1,13 +1,15 @@
 import SwiftUI
 
 struct HomeView: View {
-    @State private var suggestion: (name: String, season: String, image: UIImage)?
+    @State private var suggestion: (id: String, name: String, season: String, image: UIImage)?
+    @State private var woreToday = false
     @State private var streak: Int = 0
     @AppStorage("currentUsername") private var currentUsername: String?
     let totalWidth = UIScreen.main.bounds.width * 0.25
     let greetings = ["have a nice day!", "what a beautiful day!", "time to rule the world!", "good to see you!"]
     @State private var greeting = "Hello"
     @State private var fullName: String = ""
+    @State private var loading: CppCancellable?
 
     var body: some View {
         VStack(alignment: .leading, spacing: 16) {
@@ -46,9 +48,18 @@ struct HomeView: View {
                             .foregroundColor(Color("textColor"))
                     }
                     .padding(.horizontal)
-                    Text("Today's suggestion.")
-                        .font(.system(.headline))
-                        .foregroundColor(Color("textColor"))
+                    HStack {
+                        Text("Today's suggestion.")
+                            .font(.system(.headline))
+                            .foregroundColor(Color("textColor"))
+                        Spacer()
+                        Button(woreToday ? "Worn today" : "Wore it") {
+                            markWorn(s.id)
+                        }
+                        .disabled(woreToday)
+                        .font(.subheadline.weight(.semibold))
+                    }
+                    .padding(.horizontal)
                 } else {
                     Image("placeholderCard")
                         .resizable()
@@ -76,11 +87,24 @@ struct HomeView: View {
         }
         .background(Color("BackgroundColor"))
         .onAppear(perform: loadSuggestion)
+        .onDisappear { loading?.cancel() }
     }
 
     private func loadSuggestion() {
-        guard let user = currentUsername,
-              let dict = CppBridge.getTodaySuggestion(forUser: user) as? [String: Any],
+        loading?.cancel()
+        guard let user = currentUsername else {
+            suggestion = nil
+            return
+        }
+        loading = CppBridge.getTodaySuggestion(forUser: user) { dict in
+            showSuggestion(dict as? [String: Any])
+        }
+    }
+
+    private func showSuggestion(_ dict: [String: Any]?) {
+        woreToday = false
+        guard let dict = dict,
+              let id = dict["id"] as? String,
               let name = dict["name"] as? String,
               let season = dict["season"] as? String
         else {
@@ -92,11 +116,16 @@ struct HomeView: View {
             guard let data = itemDict["image"] as? Data, !data.isEmpty else { return nil }
             return UIImage(data: data)
         }).first {
-            suggestion = (name: name, season: season, image: firstImage)
+            suggestion = (id: id, name: name, season: season, image: firstImage)
         } else {
             suggestion = nil
         }
     }
+
+    private func markWorn(_ outfitId: String) {
+        guard let user = currentUsername else { return }
+        woreToday = CppBridge.markOutfitWorn(forUser: user, outfitId: outfitId)
+    }
 }
 
 struct HomeView_Previews: PreviewProvider {
@@ -15,6 +15,7 @@ struct SavedOutfit: Identifiable {
 struct OutfitsView: View {
     @State private var outfits: [SavedOutfit] = []
     @State private var showAdd: Bool = false
+    @State private var loading: CppCancellable?
     @AppStorage("currentUsername") private var currentUsername: String?
 
     private let columns = [GridItem(.flexible()), GridItem(.flexible())]
@@ -73,6 +74,7 @@ struct OutfitsView: View {
                 AddOutfitView()
             }
             .onAppear(perform: load)
+            .onDisappear { loading?.cancel() }
         }
         .background(Color("BackgroundColor").ignoresSafeArea())
     }
@@ -82,12 +84,17 @@ struct OutfitsView: View {
     }
 
     private func load() {
-        guard let user = currentUsername,
-              let arr = CppBridge.fetchOutfits(forUser: user) as? [[String: Any]] else {
+        loading?.cancel()
+        guard let user = currentUsername else {
             outfits = []
             return
         }
+        loading = CppBridge.fetchOutfits(forUser: user) { arr in
+            show(arr.compactMap { $0 as? [String: Any] })
+        }
+    }
 
+    private func show(_ arr: [[String: Any]]) {
         outfits = arr.compactMap { dict in
             guard let id = dict["id"] as? String ?? (dict["id"] as? NSString).map({ String($0) }) else {
                 return nil
@@ -7,6 +7,8 @@ struct ProfileView: View {
     @State private var clothesCount = 0
     @State private var outfitsCount = 0
     @State private var streak: Int = 0
+    @State private var wearsCount = 0
+    @State private var neverWornCount = 0
 
     var body: some View {
         NavigationStack {
@@ -53,12 +55,22 @@ struct ProfileView: View {
                 .frame(height: 80)
                 .background(Color("BackgroundColor"))
                 .padding(.top, 16)
+
+                // Purtări
+                HStack(spacing: 0) {
+                    statBlock(value: wearsCount, label: "outfits worn")
+                    Divider()
+                    statBlock(value: neverWornCount, label: "never worn")
+                }
+                .frame(height: 80)
+                .background(Color("BackgroundColor"))
                 
                 Spacer()
                 
                 // Logout Button
                 if currentUsername != nil {
                     Button(action: {
+                        CppBridge.logout()
                         currentUsername = nil
                         presentation.wrappedValue.dismiss()}) {
                         HStack(spacing: 8) {
@@ -83,6 +95,9 @@ struct ProfileView: View {
                 clothesCount = Int(CppBridge.getClothingItemCount(forUser: username))
                 outfitsCount = Int(CppBridge.getOutfitCount(forUser: username))
                 streak = Int(CppBridge.getCurrentStreak())
+                let wear = CppBridge.wearStats(forUser: username)
+                wearsCount = (wear["outfitWears"] as? NSNumber)?.intValue ?? 0
+                neverWornCount = (wear["neverWorn"] as? NSNumber)?.intValue ?? 0
             }
         }
     }
@@ -1,9 +1,14 @@
 import SwiftUI
+import UniformTypeIdentifiers
 
 struct SettingsView: View {
     @AppStorage("preferredTheme") private var storedTheme: String = ""
     @AppStorage("syncSystemTheme") private var syncWithSystemTheme: Bool = false
+    @AppStorage("currentUsername") private var currentUsername: String?
     @State private var selectedTheme: String = "dark"
+    @State private var exportURL: URL?
+    @State private var showImporter = false
+    @State private var wardrobeMessage: String?
 
     var body: some View {
         Form {
@@ -35,6 +40,29 @@ struct SettingsView: View {
                         ThemeManager.applyTheme(selectedTheme: selectedTheme, syncWithSystem: newValue)
                     }
             }
+
+            Section(header: Text("Wardrobe")) {
+                Button("Export wardrobe", action: exportWardrobe)
+                    .disabled(currentUsername == nil)
+
+                if let url = exportURL {
+                    ShareLink(item: url) {
+                        Label("Share export", systemImage: "square.and.arrow.up")
+                    }
+                }
+
+                Button("Import wardrobe") { showImporter = true }
+                    .disabled(currentUsername == nil)
+
+                if let message = wardrobeMessage {
+                    Text(message)
+                        .font(.footnote)
+                        .foregroundColor(.secondary)
+                }
+            }
+        }
+        .fileImporter(isPresented: $showImporter, allowedContentTypes: [.data]) { result in
+            importWardrobe(result)
         }
         .onAppear(perform: onAppear)
         .navigationTitle("Settings")
@@ -54,6 +82,29 @@ struct SettingsView: View {
 
         ThemeManager.applyTheme(selectedTheme: selectedTheme, syncWithSystem: syncWithSystemTheme)
     }
+
+    private func exportWardrobe() {
+        guard let user = currentUsername else { return }
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("\(user).ddsnap")
+        if CppBridge.exportWardrobe(forUser: user, toPath: url.path) {
+            exportURL = url
+            wardrobeMessage = nil
+        } else {
+            exportURL = nil
+            wardrobeMessage = "Export failed."
+        }
+    }
+
+    private func importWardrobe(_ result: Result<URL, Error>) {
+        guard let user = currentUsername, case .success(let url) = result else { return }
+        let scoped = url.startAccessingSecurityScopedResource()
+        defer {
+            if scoped { url.stopAccessingSecurityScopedResource() }
+        }
+        wardrobeMessage = CppBridge.importWardrobe(forUser: user, fromPath: url.path)
+            ? "Wardrobe imported."
+            : "This file could not be imported."
+    }
 }
 
 struct SettingsView_Previews: PreviewProvider {
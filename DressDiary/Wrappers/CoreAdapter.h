@@ -1,42 +1,140 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "StorageBackend.hpp"
+#include "BlobStore.hpp"
 
-class User;
-class ClothingItem;
-class Outfit;
+// Functiile objc* lucreaza pe contextul privat de persistenta si trebuie apelate
+// din coada lui (CoreDataBackend le apeleaza prin performBlockAndWait).
+
+// creeaza contextul privat; se apeleaza o data de pe main thread (construirea backend-ului)
+void objcPreparePersistenceContext();
 
 // User operations
 bool objcCreateUser(const std::string &username,
                     const std::string &name,
                     const std::string &password);
 
+// cu `handleOut`, intoarce si handle-ul userului (NSManagedObjectID) pentru operatiile urmatoare
 std::shared_ptr<User> objcLoginUser(const std::string &username,
-                                    const std::string &password);
+                                    const std::string &password,
+                                    UserHandlePtr *handleOut = nullptr);
 
-bool objcUpdateUserLoginMeta(const std::string &username,
-                             const std::string &lastLoginDate,
+bool objcUpdateUserLoginMeta(const UserHandle &user,
+                             Date lastLoginDate,
                              int streak);
 
-bool objcUpdateUserDarkMode(const std::string &username, bool isDarkMode);
+bool objcUpdateUserDarkMode(const UserHandle &user, bool isDarkMode);
+
+std::shared_ptr<User> objcRecoverUser(const std::string &username,
+                                      UserHandlePtr *handleOut = nullptr);
+
+// un singur fetch pe CDUser; operatiile de mai jos folosesc handle-ul fara sa mai caute userul
+UserHandlePtr objcResolveUser(const std::string &username);
 
-std::shared_ptr<User> objcRecoverUser(const std::string &username);
+// cate fetch-uri pe CDUser au fost evitate prin handle-uri
+std::uint64_t objcUserLookupsSaved();
 
 // Clothing item operations
-std::vector<std::shared_ptr<ClothingItem>> objcFetchClothingItems(const std::string &username);
+// cu `blobs`, imaginile salvate prin BlobStore (atributul imageKey) sunt deschise din depozit
+std::vector<ItemRecord> objcFetchClothingItems(const UserHandle &user,
+                                               const BlobStore *blobs = nullptr);
+
+// pagina de articole cu id > afterId, crescator dupa id (fetchLimit + fetchBatchSize)
+std::vector<ItemRecord> objcFetchClothingItemPage(const UserHandle &user,
+                                                  int afterId,
+                                                  std::size_t limit,
+                                                  const BlobStore *blobs = nullptr);
+
+bool objcSaveClothingItem(const UserHandle &user, const ItemRecord &item);
 
-bool objcSaveClothingItem(const std::string &username, const ClothingItem &item);
+bool objcDeleteClothingItem(const UserHandle &user, int itemId);
 
-bool objcDeleteClothingItem(const std::string &username, int itemId);
+// loturi: un singur fetch al userului si un singur [ctx save:] pentru toate articolele
+bool objcSaveClothingItems(const UserHandle &user, std::span<const ItemRecord> items);
+
+bool objcDeleteClothingItems(const UserHandle &user, std::span<const int> itemIds);
 
 // Outfit operations
-std::vector<std::shared_ptr<Outfit>> objcFetchOutfits(const std::string &username);
+std::vector<std::shared_ptr<Outfit>> objcFetchOutfits(const UserHandle &user);
+
+// pagina de outfit-uri cu id > afterId, crescator dupa id
+std::vector<std::shared_ptr<Outfit>> objcFetchOutfitPage(const UserHandle &user,
+                                                         const std::string &afterId,
+                                                         std::size_t limit);
+
+bool objcSaveOutfit(const UserHandle &user, const Outfit &outfit);
+
+// un singur [ctx save:] pentru tot lotul (outfit-urile existente se actualizeaza)
+bool objcSaveOutfits(const UserHandle &user, std::span<const Outfit> outfits);
 
-bool objcSaveOutfit(const std::string &username, const Outfit &outfit);
+bool objcDeleteOutfit(const UserHandle &user, const std::string &outfitId);
 
-bool objcDeleteOutfit(const std::string &username, const std::string &outfitId);
+bool objcDeleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds);
 
 int objcGenerateNextClothingItemId();
 std::string objcGenerateNextOutfitId();
+
+// Backend-ul Core Data: adapteaza functiile de mai sus la interfata StorageBackend
+class CoreDataBackend : public StorageBackend
+{
+    std::shared_ptr<BlobStore> blobs_;
+    // fisierele per user din afara modelului Core Data: jurnalul de purtari (<user>.wear)
+    // si versiunea garderobei (<user>.rev, vezi dataRevision)
+    std::string userDataDir_;
+    std::unordered_map<std::string, std::uint64_t> revisions_;
+    std::mutex revisionsMutex_;
+    // handle-urile obtinute la login / recover, ca resolveUser sa nu mai faca fetch
+    std::unordered_map<std::string, UserHandlePtr> resolved_;
+    std::mutex resolvedMutex_;
+
+public:
+    // `userDataDir` gol: purtarile nu se salveaza pe disc, iar versiunea garderobei nu se urmareste
+    explicit CoreDataBackend(std::shared_ptr<BlobStore> blobs = nullptr, std::string userDataDir = "")
+        : blobs_(std::move(blobs)), userDataDir_(std::move(userDataDir))
+    {
+        objcPreparePersistenceContext();
+    }
+
+    bool createUser(const std::string &username, const std::string &name, const std::string &password) override;
+    std::shared_ptr<User> loginUser(const std::string &username, const std::string &password) override;
+    bool updateUserLoginMeta(const UserHandle &user, Date lastLoginDate, int streak) override;
+    bool updateUserDarkMode(const UserHandle &user, bool isDarkMode) override;
+    std::shared_ptr<User> recoverUser(const std::string &username) override;
+    UserHandlePtr resolveUser(const std::string &username) override;
+    std::uint64_t userLookupsSaved() const override;
+
+    std::vector<ItemRecord> fetchClothingItems(const UserHandle &user) override;
+    std::vector<ItemRecord> fetchClothingItemPage(const UserHandle &user, int afterId, std::size_t limit) override;
+    bool saveClothingItem(const UserHandle &user, const ItemRecord &item) override;
+    bool deleteClothingItem(const UserHandle &user, int itemId) override;
+    bool saveClothingItems(const UserHandle &user, std::span<const ItemRecord> items) override;
+    bool deleteClothingItems(const UserHandle &user, std::span<const int> itemIds) override;
+
+    std::vector<std::shared_ptr<Outfit>> fetchOutfits(const UserHandle &user) override;
+    std::vector<std::shared_ptr<Outfit>> fetchOutfitPage(const UserHandle &user, const std::string &afterId,
+                                                         std::size_t limit) override;
+    bool saveOutfit(const UserHandle &user, const Outfit &outfit) override;
+    bool saveOutfits(const UserHandle &user, std::span<const Outfit> outfits) override;
+    bool deleteOutfit(const UserHandle &user, const std::string &outfitId) override;
+    bool deleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds) override;
+
+    bool appendWearRecords(const UserHandle &user, std::span<const WearRecord> records) override;
+    std::vector<WearRecord> fetchWearRecords(const UserHandle &user) override;
+
+    std::uint64_t dataRevision(const UserHandle &user) override;
+
+    int generateNextClothingItemId() override;
+    std::string generateNextOutfitId() override;
+
+private:
+    std::string userFilePath(const UserHandle &user, const char *extension) const;
+    // creste versiunea inaintea scrierii in Core Data: o scriere intrerupta tot invalideaza snapshot-ul
+    bool bumpRevision(const UserHandle &user);
+};
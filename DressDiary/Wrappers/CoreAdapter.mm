@@ -6,10 +6,20 @@
 #import "User.hpp"
 #import "ClothingItem.hpp"
 #import "Outfit.hpp"
+#import "ImageBlobBridging.h"
+#import "Metrics.hpp"
+#import "WardrobeSnapshot.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <cstdio>
 #include <sstream>
 #include <iomanip>
+#include <optional>
+#include <span>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 
 // Helpers for string conversion
 static NSString* toNSString(const std::string& s) {
@@ -23,9 +33,24 @@ static std::string toStdString(NSString* s) {
     return cStr ? std::string(cStr) : std::string();
 }
 
-static std::shared_ptr<ClothingItem> buildClothingItemFromManagedObject(NSManagedObject *ciMO) {
+// string numeric sau text din Core Data (talie / maneca au fost salvate si ca numere)
+static std::string stringOrNumber(id value) {
+    if ([value isKindOfClass:NSString.class]) {
+        return toStdString(value);
+    }
+    if ([value respondsToSelector:@selector(doubleValue)]) {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(1) << [value doubleValue];
+        return oss.str();
+    }
+    return "";
+}
+
+static std::optional<ItemRecord> buildItemRecordFromManagedObject(NSManagedObject *ciMO,
+                                                                  const BlobStore *blobs = nullptr) {
+    DD_METRIC_SCOPE("CoreAdapter::buildItemRecordFromManagedObject");
     if (!ciMO) {
-        return nullptr;
+        return std::nullopt;
     }
 
     int identifier = [[ciMO valueForKey:@"id"] intValue];
@@ -44,89 +69,143 @@ static std::shared_ptr<ClothingItem> buildClothingItemFromManagedObject(NSManage
         }
     }
 
-    NSData *imgData = [ciMO valueForKey:@"imageData"];
-    std::vector<uint8_t> imgBytes;
-    if (imgData && imgData.length > 0) {
-        imgBytes.resize(imgData.length);
-        memcpy(imgBytes.data(), imgData.bytes, imgData.length);
+    // imaginea se citeste abia la primul acces si nu se copiaza din NSData;
+    // daca a fost salvata prin BlobStore, o deschidem direct din depozit (cu thumbnail)
+    ImageBlob imgBytes;
+    NSString *imageKey = nil;
+    if (ciMO.entity.attributesByName[@"imageKey"]) {
+        imageKey = [ciMO valueForKey:@"imageKey"];
+    }
+    if (blobs && [imageKey isKindOfClass:NSString.class] && blobs->contains(toStdString(imageKey))) {
+        imgBytes = blobs->open(toStdString(imageKey));
+    } else {
+        // nu retinem obiectul gestionat (e legat de context si poate fi invalidat pana la acces):
+        // doar id-ul lui, iar obiectul se reciteste in contextul lui
+        NSManagedObjectID *objectID = ciMO.objectID;
+        NSManagedObjectContext *context = ciMO.managedObjectContext;
+        imgBytes = ImageBlob::lazy([objectID, context]() {
+            __block ImageBlob loaded;
+            [context performBlockAndWait:^{
+                NSManagedObject *object = [context existingObjectWithID:objectID error:nil];
+                if (object) {
+                    loaded = blobFromNSData([object valueForKey:@"imageData"]);
+                }
+            }];
+            DD_METRIC_COUNT("CoreAdapter.imageBytesLoaded", loaded.size());
+            return loaded;
+        });
     }
 
-    std::shared_ptr<ClothingItem> cppItem = nullptr;
-
-    if (category == "pants") {
+    // dispatch pe simbolul internat, nu pe string
+    SymbolTable &table = SymbolTable::getInstance();
+    const Symbol categoryId = table.intern(category);
+    ItemPayload payload;
+    if (categoryId == symbols::Pants) {
         float lungP = [[ciMO valueForKey:@"lungimePants"] floatValue];
-        std::string tal;
-        id waistValue = [ciMO valueForKey:@"taliePants"];
-        if ([waistValue isKindOfClass:NSString.class]) {
-            tal = toStdString(waistValue);
-        } else if ([waistValue respondsToSelector:@selector(doubleValue)]) {
-            std::ostringstream oss;
-            oss << std::fixed << std::setprecision(1) << [waistValue doubleValue];
-            tal = oss.str();
-        } else {
-            tal = "";
-        }
-        cppItem = std::make_shared<Pants>(
-            identifier,
-            color,
-            matList,
-            category,
-            imgBytes,
-            lungP,
-            tal
-        );
-    } else if (category == "jacket") {
+        payload = PantsData{lungP, table.intern(stringOrNumber([ciMO valueForKey:@"taliePants"]))};
+    } else if (categoryId == symbols::Jacket) {
         bool wp = [[ciMO valueForKey:@"waterproofJacket"] boolValue];
-        cppItem = std::make_shared<Jacket>(
-            identifier,
-            color,
-            matList,
-            category,
-            imgBytes,
-            wp
-        );
-    } else if (category == "top") {
-        std::string sleeve;
-        id sleeveValue = [ciMO valueForKey:@"manecaTop"];
-        if ([sleeveValue isKindOfClass:NSString.class]) {
-            sleeve = toStdString(sleeveValue);
-        } else if ([sleeveValue respondsToSelector:@selector(doubleValue)]) {
-            std::ostringstream oss;
-            oss << std::fixed << std::setprecision(1) << [sleeveValue doubleValue];
-            sleeve = oss.str();
-        } else {
-            sleeve = "";
-        }
+        payload = JacketData{wp};
+    } else if (categoryId == symbols::Top) {
         std::string decStr;
         NSString *decNS = [ciMO valueForKey:@"decolteuTop"];
         if (decNS && [decNS isKindOfClass:NSString.class]) {
             decStr = toStdString(decNS);
         }
-        cppItem = std::make_shared<Top>(
-            identifier,
-            color,
-            matList,
-            category,
-            imgBytes,
-            sleeve,
-            decStr
-        );
-    } else if (category == "shoes") {
+        payload = TopData{
+            table.intern(stringOrNumber([ciMO valueForKey:@"manecaTop"])),
+            table.intern(decStr)
+        };
+    } else if (categoryId == symbols::Shoes) {
         float size = [[ciMO valueForKey:@"shoeSize"] floatValue];
-        cppItem = std::make_shared<Shoes>(
-            identifier,
-            color,
-            matList,
-            category,
-            imgBytes,
-            size
-        );
+        payload = ShoesData{size};
     } else {
         // Unknown category, ignore
-        return nullptr;
+        return std::nullopt;
+    }
+
+    return ItemFactory::createRecord(identifier, color, matList, category, std::move(imgBytes), std::move(payload));
+}
+
+// Contextul privat (NSPrivateQueueConcurrencyType) in care backend-ul face toate citirile si
+// scrierile: [ctx save:] nu mai ruleaza pe main thread. viewContext primeste modificarile
+// automat (automaticallyMergesChangesFromParent).
+static NSManagedObjectContext *sharedPersistenceContext = nil;
+static dispatch_once_t persistenceContextOnce;
+
+void objcPreparePersistenceContext()
+{
+    DD_METRIC_SCOPE("objcPreparePersistenceContext");
+    dispatch_once(&persistenceContextOnce, ^{
+        AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
+        NSPersistentContainer *container = app.persistentContainer;
+        container.viewContext.automaticallyMergesChangesFromParent = YES;
+        sharedPersistenceContext = [container newBackgroundContext];
+        sharedPersistenceContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+    });
+}
+
+static NSManagedObjectContext *persistenceContext()
+{
+    objcPreparePersistenceContext();
+    return sharedPersistenceContext;
+}
+
+// ruleaza `work` pe coada contextului privat si asteapta rezultatul
+template <typename F>
+static auto performOnPersistenceContext(F work) -> decltype(work())
+{
+    using Result = decltype(work());
+    __block Result result{};
+    [persistenceContext() performBlockAndWait:^{
+        result = work();
+    }];
+    return result;
+}
+
+// Handle-ul Core Data: NSManagedObjectID-ul userului, rezolvat o data la login / recover
+class CoreDataUserHandle : public UserHandle {
+public:
+    CoreDataUserHandle(std::string username, NSManagedObjectID *objectID)
+        : UserHandle(std::move(username)), objectID(objectID) {}
+
+    NSManagedObjectID *objectID;
+};
+
+// cate fetch-uri pe CDUser au fost evitate
+static std::atomic<std::uint64_t> savedUserLookups{0};
+
+static NSManagedObject *fetchUserObject(NSManagedObjectContext *ctx, const std::string &username) {
+    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
+    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
+    userFetch.fetchLimit = 1;
+    NSError *uErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
+    if (uErr || uResults.count == 0) {
+        return nil;
     }
+    return uResults.firstObject;
+}
+
+static UserHandlePtr makeUserHandle(NSManagedObject *userMO, const std::string &username) {
+    // obiectele inca nesalvate au id temporar, care nu mai e valid dupa save
+    NSManagedObjectID *objectID = userMO.objectID.isTemporaryID ? nil : userMO.objectID;
+    return std::make_shared<CoreDataUserHandle>(username, objectID);
+}
 
-    return cppItem;
+// User MO pentru handle: din context dupa objectID (fara fetch), altfel fetch dupa username
+static NSManagedObject *userObjectFor(NSManagedObjectContext *ctx, const UserHandle &user) {
+    auto *handle = dynamic_cast<const CoreDataUserHandle *>(&user);
+    if (handle && handle->objectID) {
+        NSError *err = nil;
+        NSManagedObject *userMO = [ctx existingObjectWithID:handle->objectID error:&err];
+        if (userMO && !err) {
+            savedUserLookups.fetch_add(1, std::memory_order_relaxed);
+            return userMO;
+        }
+    }
+    return fetchUserObject(ctx, user.username());
 }
 
 // User operations
@@ -135,13 +214,14 @@ bool objcCreateUser(const std::string& username,
                     const std::string& name,
                     const std::string& password)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcCreateUser");
+    NSManagedObjectContext *ctx = persistenceContext();
 
     // Check if username already exists
     NSFetchRequest *fetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
     fetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
     NSError *err = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *results = [ctx executeFetchRequest:fetch error:&err];
     if (err || results.count > 0) {
         return false;
@@ -163,22 +243,25 @@ bool objcCreateUser(const std::string& username,
 
     if (![ctx save:&err]) {
         NSLog(@"Error creating User: %@", err.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
 std::shared_ptr<User> objcLoginUser(const std::string& username,
-                                    const std::string& password)
+                                    const std::string& password,
+                                    UserHandlePtr *handleOut)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcLoginUser");
+    NSManagedObjectContext *ctx = persistenceContext();
 
     // Fetch user by username & password
     NSFetchRequest *fetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
     fetch.predicate = [NSPredicate predicateWithFormat:@"username == %@ AND password == %@",
                        toNSString(username), toNSString(password)];
     NSError *err = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *results = [ctx executeFetchRequest:fetch error:&err];
     if (err || results.count == 0) {
         return nullptr;
@@ -188,7 +271,7 @@ std::shared_ptr<User> objcLoginUser(const std::string& username,
     std::string u = toStdString([userMO valueForKey:@"username"]);
     std::string n = toStdString([userMO valueForKey:@"name"]);
     std::string p = toStdString([userMO valueForKey:@"password"]);
-    std::string lastDate = toStdString([userMO valueForKey:@"lastLoginDate"]);
+    Date lastDate = Date::fromString(toStdString([userMO valueForKey:@"lastLoginDate"]));
     bool dark = [[userMO valueForKey:@"darkMode"] boolValue];
     int streakValue = [[userMO valueForKey:@"streak"] intValue];
 
@@ -196,68 +279,67 @@ std::shared_ptr<User> objcLoginUser(const std::string& username,
     cppUser->setLastLogIn(lastDate);
     cppUser->setStreak(streakValue == 0 ? 1 : streakValue);
     cppUser->setDarkMode(dark);
+    if (handleOut) {
+        *handleOut = makeUserHandle(userMO, u);
+    }
     return cppUser;
 }
 
-bool objcUpdateUserLoginMeta(const std::string& username,
-                             const std::string& lastLoginDate,
+bool objcUpdateUserLoginMeta(const UserHandle& user,
+                             Date lastLoginDate,
                              int streak)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcUpdateUserLoginMeta");
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch user by username
-    NSFetchRequest *fetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    fetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *err = nil;
-    NSArray *results = [ctx executeFetchRequest:fetch error:&err];
-    if (err || results.count == 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
         return false;
     }
 
-    NSManagedObject *userMO = results.firstObject;
-    [userMO setValue:toNSString(lastLoginDate) forKey:@"lastLoginDate"];
+    NSError *err = nil;
+    [userMO setValue:toNSString(lastLoginDate.toString()) forKey:@"lastLoginDate"];
     [userMO setValue:@(streak)            forKey:@"streak"];
     if (![ctx save:&err]) {
         NSLog(@"Error updating login meta: %@", err.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
-bool objcUpdateUserDarkMode(const std::string& username,
+bool objcUpdateUserDarkMode(const UserHandle& user,
                             bool isDarkMode)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcUpdateUserDarkMode");
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    NSFetchRequest *fetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    fetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *err = nil;
-    NSArray *results = [ctx executeFetchRequest:fetch error:&err];
-    if (err || results.count == 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
         return false;
     }
 
-    NSManagedObject *userMO = results.firstObject;
+    NSError *err = nil;
     [userMO setValue:@(isDarkMode) forKey:@"darkMode"];
     if (![ctx save:&err]) {
         NSLog(@"Error updating dark mode: %@", err.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
-std::shared_ptr<User> objcRecoverUser(const std::string& username) {
+std::shared_ptr<User> objcRecoverUser(const std::string& username, UserHandlePtr *handleOut) {
+    DD_METRIC_SCOPE("objcRecoverUser");
     NSString *uname = [NSString stringWithUTF8String:username.c_str()];
 
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *context = app.persistentContainer.viewContext;
+    NSManagedObjectContext *context = persistenceContext();
 
     NSFetchRequest *request = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
     request.predicate = [NSPredicate predicateWithFormat:@"username == %@", uname];
 
     NSError *error = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *results = [context executeFetchRequest:request error:&error];
 
     if (results.count > 0) {
@@ -265,7 +347,7 @@ std::shared_ptr<User> objcRecoverUser(const std::string& username) {
 
         std::string u  = [[cdUser valueForKey:@"username"] UTF8String];
         std::string n  = [[cdUser valueForKey:@"name"] UTF8String];
-        std::string ld = [[cdUser valueForKey:@"lastLoginDate"] UTF8String];
+        Date ld        = Date::fromString(toStdString([cdUser valueForKey:@"lastLoginDate"]));
         bool isDark    = [[cdUser valueForKey:@"darkMode"] boolValue];
         int streak     = [[cdUser valueForKey:@"streak"] intValue];
 
@@ -273,6 +355,9 @@ std::shared_ptr<User> objcRecoverUser(const std::string& username) {
         user->setDarkMode(isDark);
         user->setLastLogIn(ld);
         user->setStreak(streak == 0 ? 1 : streak);
+        if (handleOut) {
+            *handleOut = makeUserHandle(cdUser, u);
+        }
 
         return user;
     }
@@ -283,151 +368,254 @@ std::shared_ptr<User> objcRecoverUser(const std::string& username) {
 
 // ClothingItem operations
 
-std::vector<std::shared_ptr<ClothingItem>> objcFetchClothingItems(const std::string& username)
+std::vector<ItemRecord> objcFetchClothingItems(const UserHandle& user,
+                                               const BlobStore *blobs)
 {
-    std::vector<std::shared_ptr<ClothingItem>> result;
+    DD_METRIC_SCOPE("objcFetchClothingItems");
+    std::vector<ItemRecord> result;
 
     // 1) Obținem contextul Core Data
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // 2) Luăm User MO după username
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
-        return result;  // nu există user sau eroare
+    // 2) User MO din handle (fără fetch după username)
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
+        return result;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
     // 3) Luăm toate ClothingItem‐urile ale lui userMO
     NSFetchRequest *itemFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
     itemFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@", userMO];
     NSError *iErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *items = [ctx executeFetchRequest:itemFetch error:&iErr];
     if (iErr) {
         return result;  // eroare la fetch
     }
 
+    DD_METRIC_COUNT("CoreAdapter.itemsFetched", items.count);
+    result.reserve(items.count);
     for (NSManagedObject *ciMO in items) {
-        auto cppItem = buildClothingItemFromManagedObject(ciMO);
-        if (cppItem) {
-            result.push_back(cppItem);
+        if (auto record = buildItemRecordFromManagedObject(ciMO, blobs)) {
+            result.push_back(std::move(*record));
         }
     }
 
     return result;
 }
 
-bool objcSaveClothingItem(const std::string& username,
-                          const ClothingItem& item)
+std::vector<ItemRecord> objcFetchClothingItemPage(const UserHandle& user,
+                                                  int afterId,
+                                                  std::size_t limit,
+                                                  const BlobStore *blobs)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcFetchClothingItemPage");
+    std::vector<ItemRecord> result;
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch User MO
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
-        return false;
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO || limit == 0) {
+        return result;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
-    // Create ClothingItem MO
-    NSEntityDescription *ent = [NSEntityDescription entityForName:@"CDClothingItem"
-                                           inManagedObjectContext:ctx];
-    NSManagedObject *ciMO = [[NSManagedObject alloc] initWithEntity:ent
-                                              insertIntoManagedObjectContext:ctx];
-    [ciMO setValue:@(item.getId())       forKey:@"id"];
-    [ciMO setValue:toNSString(item.getColor())     forKey:@"color"];
+    // range scan dupa id, cu limita: costul nu depinde de cate articole are userul
+    NSFetchRequest *itemFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
+    itemFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@ AND id > %d", userMO, afterId];
+    itemFetch.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"id" ascending:YES]];
+    itemFetch.fetchLimit = limit;
+    itemFetch.fetchBatchSize = limit;
+    NSError *iErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *items = [ctx executeFetchRequest:itemFetch error:&iErr];
+    if (iErr) {
+        return result;
+    }
+
+    DD_METRIC_COUNT("CoreAdapter.itemsFetched", items.count);
+    result.reserve(items.count);
+    for (NSManagedObject *ciMO in items) {
+        if (auto record = buildItemRecordFromManagedObject(ciMO, blobs)) {
+            result.push_back(std::move(*record));
+        }
+    }
+    return result;
+}
+
+// copiaza campurile articolului in managed object (folosit la insert si la update)
+static void fillClothingItemMO(NSManagedObject *ciMO, const ItemRecord &item)
+{
+    [ciMO setValue:@(item.id)       forKey:@"id"];
+    [ciMO setValue:toNSString(item.colorName())     forKey:@"color"];
 
     // Join materials vector into a comma-separated string
-    const auto& matVec = item.getMaterials();
-    NSMutableArray *matStrings = [NSMutableArray array];
-    for (const auto& m : matVec) {
-        [matStrings addObject:toNSString(m)];
+    const SymbolTable &table = SymbolTable::getInstance();
+    NSMutableArray *matStrings = [NSMutableArray arrayWithCapacity:item.materials.size()];
+    for (Symbol m : item.materials) {
+        [matStrings addObject:toNSString(table.name(m))];
     }
     NSString *joinedMats = [matStrings componentsJoinedByString:@","];
    [ciMO setValue:joinedMats forKey:@"materials"];
 
-    std::string category = item.getCategory();
-    [ciMO setValue:toNSString(category)   forKey:@"category"];
+    [ciMO setValue:toNSString(item.categoryName())   forKey:@"category"];
 
-    // ImageData
-    const auto& imgVec = item.getImage();
-    if (!imgVec.empty()) {
+    // ImageData: daca imaginea e deja in BlobStore pastram doar cheia, altfel bytes-ii inline
+    const auto& imgVec = item.image;
+    if (!imgVec.key().empty() && ciMO.entity.attributesByName[@"imageKey"]) {
+        [ciMO setValue:toNSString(imgVec.key()) forKey:@"imageKey"];
+        [ciMO setValue:nil forKey:@"imageData"];
+    } else if (!imgVec.empty()) {
         NSData *data = [NSData dataWithBytes:imgVec.data() length:imgVec.size()];
         [ciMO setValue:data forKey:@"imageData"];
     }
 
-    if (category == "pants") {
-        if (const Pants* pants = dynamic_cast<const Pants*>(&item)) {
-            [ciMO setValue:@(pants->getLungime()) forKey:@"lungimePants"];
-            [ciMO setValue:toNSString(pants->getTalie()) forKey:@"taliePants"];
-        }
-    } else if (category == "jacket") {
-        if (const Jacket* jacket = dynamic_cast<const Jacket*>(&item)) {
-            [ciMO setValue:@(jacket->isWaterproof()) forKey:@"waterproofJacket"];
-        }
-    } else if (category == "top") {
-        if (const Top* top = dynamic_cast<const Top*>(&item)) {
-            [ciMO setValue:toNSString(top->getManeca()) forKey:@"manecaTop"];
-            [ciMO setValue:toNSString(top->getDecolteu()) forKey:@"decolteuTop"];
-        }
-    } else if (category == "shoes") {
-        if (const Shoes* shoes = dynamic_cast<const Shoes*>(&item)) {
-            [ciMO setValue:@(shoes->getSizeShoes()) forKey:@"shoeSize"];
+    // campurile specifice: std::visit pe payload, fara dynamic_cast
+    std::visit(overloaded{
+        [](std::monostate) {},
+        [&](const PantsData &pants) {
+            [ciMO setValue:@(pants.lungime) forKey:@"lungimePants"];
+            [ciMO setValue:toNSString(table.name(pants.talie)) forKey:@"taliePants"];
+        },
+        [&](const JacketData &jacket) {
+            [ciMO setValue:@(jacket.waterproof) forKey:@"waterproofJacket"];
+        },
+        [&](const TopData &top) {
+            [ciMO setValue:toNSString(table.name(top.maneca)) forKey:@"manecaTop"];
+            [ciMO setValue:toNSString(table.name(top.decolteu)) forKey:@"decolteuTop"];
+        },
+        [&](const ShoesData &shoes) {
+            [ciMO setValue:@(shoes.size) forKey:@"shoeSize"];
+        }}, item.payload);
+}
+
+bool objcSaveClothingItem(const UserHandle& user,
+                          const ItemRecord& item)
+{
+    DD_METRIC_SCOPE("objcSaveClothingItem");
+    return objcSaveClothingItems(user, std::span<const ItemRecord>(&item, 1));
+}
+
+bool objcSaveClothingItems(const UserHandle& user,
+                           std::span<const ItemRecord> items)
+{
+    DD_METRIC_SCOPE("objcSaveClothingItems");
+    if (items.empty()) {
+        return true;
+    }
+    NSManagedObjectContext *ctx = persistenceContext();
+
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
+        return false;
+    }
+
+    // articolele deja existente se actualizeaza, nu se dubleaza (un singur fetch cu IN)
+    NSMutableArray<NSNumber *> *ids = [NSMutableArray arrayWithCapacity:items.size()];
+    for (const auto &item : items) {
+        [ids addObject:@(item.id)];
+    }
+    NSFetchRequest *existingFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
+    existingFetch.predicate = [NSPredicate predicateWithFormat:@"id IN %@ AND owner == %@", ids, userMO];
+    NSError *eErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *existing = [ctx executeFetchRequest:existingFetch error:&eErr];
+    if (eErr) {
+        return false;
+    }
+    NSMutableDictionary<NSNumber *, NSManagedObject *> *byId = [NSMutableDictionary dictionaryWithCapacity:existing.count];
+    for (NSManagedObject *mo in existing) {
+        byId[[mo valueForKey:@"id"]] = mo;
+    }
+
+    NSEntityDescription *ent = [NSEntityDescription entityForName:@"CDClothingItem"
+                                           inManagedObjectContext:ctx];
+    for (const auto &item : items) {
+        NSManagedObject *ciMO = byId[@(item.id)];
+        if (!ciMO) {
+            ciMO = [[NSManagedObject alloc] initWithEntity:ent
+                            insertIntoManagedObjectContext:ctx];
+            byId[@(item.id)] = ciMO;
         }
+        fillClothingItemMO(ciMO, item);
+        [ciMO setValue:userMO forKey:@"owner"];
     }
 
-    [ciMO setValue:userMO forKey:@"owner"];
+    // un singur commit pentru tot lotul
     NSError *saveErr = nil;
     if (![ctx save:&saveErr]) {
-        NSLog(@"Error saving ClothingItem: %@", saveErr.localizedDescription);
+        NSLog(@"Error saving ClothingItems: %@", saveErr.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
-bool objcDeleteClothingItem(const std::string& username,
+bool objcDeleteClothingItem(const UserHandle& user,
                             int itemId)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcDeleteClothingItem");
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch User MO
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
         return false;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
     // Fetch ClothingItem by id and owner
     NSFetchRequest *ciFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
     ciFetch.predicate = [NSPredicate predicateWithFormat:@"id == %d AND owner == %@", itemId, userMO];
     NSError *ciErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *ciResults = [ctx executeFetchRequest:ciFetch error:&ciErr];
     if (ciErr || ciResults.count == 0) {
         return false;
     }
-    NSManagedObject *ciMO = ciResults.firstObject;
-    NSSet *relatedOutfits = [ciMO valueForKey:@"outfits"];
-    if ([relatedOutfits isKindOfClass:NSSet.class] && relatedOutfits.count > 0) {
-        for (NSManagedObject *outfitMO in relatedOutfits) {
-            NSMutableSet *itemsRelation = [outfitMO mutableSetValueForKey:@"items"];
-            [itemsRelation removeObject:ciMO];
-        }
-    }
-    [ctx deleteObject:ciMO];
+    // relatia outfits are regula Nullify: Core Data scoate articolul din outfit-uri la delete,
+    // iar cache-ul DataManager isi actualizeaza singur outfit-urile prin indexul invers
+    [ctx deleteObject:ciResults.firstObject];
     NSError *delErr = nil;
     if (![ctx save:&delErr]) {
         NSLog(@"Error deleting ClothingItem: %@", delErr.localizedDescription);
+        [ctx rollback];
+        return false;
+    }
+    return true;
+}
+
+bool objcDeleteClothingItems(const UserHandle& user,
+                             std::span<const int> itemIds)
+{
+    DD_METRIC_SCOPE("objcDeleteClothingItems");
+    if (itemIds.empty()) {
+        return true;
+    }
+    NSManagedObjectContext *ctx = persistenceContext();
+
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
+        return false;
+    }
+
+    NSMutableArray<NSNumber *> *ids = [NSMutableArray arrayWithCapacity:itemIds.size()];
+    for (int itemId : itemIds) {
+        [ids addObject:@(itemId)];
+    }
+    NSFetchRequest *ciFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
+    ciFetch.predicate = [NSPredicate predicateWithFormat:@"id IN %@ AND owner == %@", ids, userMO];
+    NSError *ciErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *ciResults = [ctx executeFetchRequest:ciFetch error:&ciErr];
+    if (ciErr) {
+        return false;
+    }
+    // outfit-urile se actualizeaza prin regula Nullify (vezi objcDeleteClothingItem)
+    for (NSManagedObject *ciMO in ciResults) {
+        [ctx deleteObject:ciMO];
+    }
+
+    NSError *delErr = nil;
+    if (![ctx save:&delErr]) {
+        NSLog(@"Error deleting ClothingItems: %@", delErr.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
@@ -437,134 +625,138 @@ bool objcDeleteClothingItem(const std::string& username,
 // Outfit operations
 // --------------------
 
-std::vector<std::shared_ptr<Outfit>> objcFetchOutfits(const std::string& username)
+// construieste Outfit-ul C++ dintr-un CDOutfit (fetch complet si pe pagini)
+static std::shared_ptr<Outfit> buildOutfitFromManagedObject(NSManagedObject *oMO)
 {
+    std::string id        = toStdString([oMO valueForKey:@"id"]);
+    std::string name      = toStdString([oMO valueForKey:@"name"]);
+    Date dateAdded        = Date::fromString(toStdString([oMO valueForKey:@"dateAdded"]));
+    std::string season    = toStdString([oMO valueForKey:@"season"]);
+
+    // doar id-urile; articolele insele sunt deja in cache-ul DataManager
+    NSSet *itemsSet = [oMO valueForKey:@"items"];
+    std::vector<int> componentIds;
+    if ([itemsSet isKindOfClass:NSSet.class] && itemsSet.count > 0) {
+        NSArray *sortedItems = [[itemsSet allObjects] sortedArrayUsingDescriptors:@[
+            [NSSortDescriptor sortDescriptorWithKey:@"id" ascending:YES]
+        ]];
+        componentIds.reserve(sortedItems.count);
+        for (NSManagedObject *ciMO in sortedItems) {
+            componentIds.push_back([[ciMO valueForKey:@"id"] intValue]);
+        }
+    }
+    std::vector<OutfitItemPlacement> layoutEntries;
+    NSDictionary<NSString *, NSAttributeDescription *> *attributes = oMO.entity.attributesByName;
+    if (attributes[@"layoutJSON"]) {
+        NSString *layoutJSON = [oMO valueForKey:@"layoutJSON"];
+        if ([layoutJSON isKindOfClass:NSString.class] && layoutJSON.length > 0) {
+            NSData *data = [layoutJSON dataUsingEncoding:NSUTF8StringEncoding];
+            if (data) {
+                NSError *jsonErr = nil;
+                NSArray *candidateArray = (NSArray *)[NSJSONSerialization JSONObjectWithData:data options:0 error:&jsonErr];
+                if (!jsonErr && [candidateArray isKindOfClass:NSArray.class]) {
+                    for (NSDictionary *entry in candidateArray) {
+                        NSNumber *itemIdNum = entry[@"itemId"];
+                        NSNumber *xNum = entry[@"x"];
+                        NSNumber *yNum = entry[@"y"];
+                        if (itemIdNum && xNum && yNum) {
+                            layoutEntries.push_back({
+                                itemIdNum.intValue,
+                                xNum.doubleValue,
+                                yNum.doubleValue
+                            });
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return ItemFactory::createOutfit(id, name, dateAdded, season, {}, componentIds, layoutEntries);
+}
+
+std::vector<std::shared_ptr<Outfit>> objcFetchOutfits(const UserHandle& user)
+{
+    DD_METRIC_SCOPE("objcFetchOutfits");
     std::vector<std::shared_ptr<Outfit>> result;
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch User MO
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
         return result;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
     // Fetch Outfit by owner
     NSFetchRequest *oFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDOutfit"];
     oFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@", userMO];
     NSError *oErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *outfits = [ctx executeFetchRequest:oFetch error:&oErr];
     if (oErr) {
         return result;
     }
 
+    DD_METRIC_COUNT("CoreAdapter.outfitsFetched", outfits.count);
+    result.reserve(outfits.count);
     for (NSManagedObject *oMO in outfits) {
-        std::string id        = toStdString([oMO valueForKey:@"id"]);
-        std::string name      = toStdString([oMO valueForKey:@"name"]);
-        std::string dateAdded = toStdString([oMO valueForKey:@"dateAdded"]);
-        std::string season    = toStdString([oMO valueForKey:@"season"]);
-
-        NSSet *itemsSet = [oMO valueForKey:@"items"];
-        std::vector<std::shared_ptr<ClothingItem>> cppItems;
-        std::vector<int> componentIds;
-        if ([itemsSet isKindOfClass:NSSet.class] && itemsSet.count > 0) {
-            NSArray *sortedItems = [[itemsSet allObjects] sortedArrayUsingDescriptors:@[
-                [NSSortDescriptor sortDescriptorWithKey:@"id" ascending:YES]
-            ]];
-            cppItems.reserve(sortedItems.count);
-            componentIds.reserve(sortedItems.count);
-            for (NSManagedObject *ciMO in sortedItems) {
-                int identifier = [[ciMO valueForKey:@"id"] intValue];
-                componentIds.push_back(identifier);
-                auto itemPtr = buildClothingItemFromManagedObject(ciMO);
-                if (itemPtr) {
-                    cppItems.push_back(itemPtr);
-                }
-            }
-        }
-        std::vector<OutfitItemPlacement> layoutEntries;
-        NSDictionary<NSString *, NSAttributeDescription *> *attributes = oMO.entity.attributesByName;
-        if (attributes[@"layoutJSON"]) {
-            NSString *layoutJSON = [oMO valueForKey:@"layoutJSON"];
-            if ([layoutJSON isKindOfClass:NSString.class] && layoutJSON.length > 0) {
-                NSData *data = [layoutJSON dataUsingEncoding:NSUTF8StringEncoding];
-                if (data) {
-                    NSError *jsonErr = nil;
-                    NSArray *candidateArray = (NSArray *)[NSJSONSerialization JSONObjectWithData:data options:0 error:&jsonErr];
-                    if (!jsonErr && [candidateArray isKindOfClass:NSArray.class]) {
-                        for (NSDictionary *entry in candidateArray) {
-                            NSNumber *itemIdNum = entry[@"itemId"];
-                            NSNumber *xNum = entry[@"x"];
-                            NSNumber *yNum = entry[@"y"];
-                            if (itemIdNum && xNum && yNum) {
-                                layoutEntries.push_back({
-                                    itemIdNum.intValue,
-                                    xNum.doubleValue,
-                                    yNum.doubleValue
-                                });
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        auto cppOutfit = ItemFactory::createOutfit(id, name, dateAdded, season, cppItems, componentIds, layoutEntries);
-
-        result.push_back(cppOutfit);
+        result.push_back(buildOutfitFromManagedObject(oMO));
     }
     return result;
 }
 
-bool objcSaveOutfit(const std::string& username,
-                    const Outfit& outfit)
+std::vector<std::shared_ptr<Outfit>> objcFetchOutfitPage(const UserHandle& user,
+                                                         const std::string &afterId,
+                                                         std::size_t limit)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcFetchOutfitPage");
+    std::vector<std::shared_ptr<Outfit>> result;
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch User MO
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
-        return false;
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO || limit == 0) {
+        return result;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
-    // Create Outfit MO
-    NSEntityDescription *ent = [NSEntityDescription entityForName:@"CDOutfit"
-                                           inManagedObjectContext:ctx];
-    NSManagedObject *oMO = [[NSManagedObject alloc] initWithEntity:ent
-                                              insertIntoManagedObjectContext:ctx];
+    // range scan dupa id: doar pagina ceruta ajunge in memorie
+    NSFetchRequest *oFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDOutfit"];
+    oFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@ AND id > %@", userMO, toNSString(afterId)];
+    oFetch.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"id" ascending:YES]];
+    oFetch.fetchLimit = limit;
+    oFetch.fetchBatchSize = limit;
+    NSError *oErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *outfits = [ctx executeFetchRequest:oFetch error:&oErr];
+    if (oErr) {
+        return result;
+    }
+
+    DD_METRIC_COUNT("CoreAdapter.outfitsFetched", outfits.count);
+    result.reserve(outfits.count);
+    for (NSManagedObject *oMO in outfits) {
+        result.push_back(buildOutfitFromManagedObject(oMO));
+    }
+    return result;
+}
+
+// copiaza campurile outfit-ului in managed object; `itemsById` sunt articolele userului deja aduse
+static void fillOutfitMO(NSManagedObject *oMO,
+                         NSManagedObject *userMO,
+                         const Outfit &outfit,
+                         NSDictionary<NSNumber *, NSManagedObject *> *itemsById)
+{
     [oMO setValue:toNSString(outfit.getId())        forKey:@"id"];
     [oMO setValue:toNSString(outfit.getName())      forKey:@"name"];
-    [oMO setValue:toNSString(outfit.getDateAdded()) forKey:@"dateAdded"];
+    [oMO setValue:toNSString(outfit.getDateAdded().toString()) forKey:@"dateAdded"];
    [oMO setValue:toNSString(outfit.getSeason())    forKey:@"season"];
     [oMO setValue:userMO forKey:@"owner"];
 
-    const auto& componentIds = outfit.getItemIds();
-    if (!componentIds.empty()) {
-        NSMutableArray<NSNumber *> *ids = [NSMutableArray arrayWithCapacity:componentIds.size()];
-        for (int itemId : componentIds) {
-            [ids addObject:@(itemId)];
-        }
-
-        NSFetchRequest *itemsFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
-        itemsFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@ AND id IN %@", userMO, ids];
-        NSError *itemErr = nil;
-        NSArray *linkedItems = [ctx executeFetchRequest:itemsFetch error:&itemErr];
-        if (!itemErr) {
-            NSMutableSet *itemsRelation = [oMO mutableSetValueForKey:@"items"];
-            for (NSManagedObject *ciMO in linkedItems) {
-                [itemsRelation addObject:ciMO];
-            }
-        } else {
-            NSLog(@"Error fetching clothing items for outfit save: %@", itemErr.localizedDescription);
+    // componentele se refac din outfit.getItemIds() (la update se inlocuiesc cele vechi)
+    NSMutableSet *itemsRelation = [oMO mutableSetValueForKey:@"items"];
+    [itemsRelation removeAllObjects];
+    for (int itemId : outfit.getItemIds()) {
+        NSManagedObject *ciMO = itemsById[@(itemId)];
+        if (ciMO) {
+            [itemsRelation addObject:ciMO];
         }
     }
 
@@ -590,35 +782,107 @@ bool objcSaveOutfit(const std::string& username,
             [oMO setValue:nil forKey:@"layoutJSON"];
         }
     }
+}
+
+bool objcSaveOutfit(const UserHandle& user,
+                    const Outfit& outfit)
+{
+    DD_METRIC_SCOPE("objcSaveOutfit");
+    return objcSaveOutfits(user, std::span<const Outfit>(&outfit, 1));
+}
+
+bool objcSaveOutfits(const UserHandle& user,
+                     std::span<const Outfit> outfits)
+{
+    DD_METRIC_SCOPE("objcSaveOutfits");
+    if (outfits.empty()) {
+        return true;
+    }
+    NSManagedObjectContext *ctx = persistenceContext();
+
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
+        return false;
+    }
+
+    // outfit-urile deja salvate se actualizeaza, nu se dubleaza (ca la objcSaveClothingItems)
+    NSMutableArray<NSString *> *outfitIds = [NSMutableArray arrayWithCapacity:outfits.size()];
+    NSMutableSet<NSNumber *> *itemIds = [NSMutableSet set];
+    for (const auto &outfit : outfits) {
+        [outfitIds addObject:toNSString(outfit.getId())];
+        for (int itemId : outfit.getItemIds()) {
+            [itemIds addObject:@(itemId)];
+        }
+    }
+    NSFetchRequest *existingFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDOutfit"];
+    existingFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@ AND id IN %@", userMO, outfitIds];
+    NSError *eErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *existing = [ctx executeFetchRequest:existingFetch error:&eErr];
+    if (eErr) {
+        return false;
+    }
+    NSMutableDictionary<NSString *, NSManagedObject *> *outfitsById = [NSMutableDictionary dictionaryWithCapacity:existing.count];
+    for (NSManagedObject *oMO in existing) {
+        outfitsById[[oMO valueForKey:@"id"]] = oMO;
+    }
+
+    // componentele tuturor outfit-urilor, intr-un singur fetch
+    NSMutableDictionary<NSNumber *, NSManagedObject *> *itemsById = [NSMutableDictionary dictionaryWithCapacity:itemIds.count];
+    if (itemIds.count > 0) {
+        NSFetchRequest *itemsFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
+        itemsFetch.predicate = [NSPredicate predicateWithFormat:@"owner == %@ AND id IN %@", userMO, itemIds];
+        NSError *itemErr = nil;
+        DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+        NSArray *linkedItems = [ctx executeFetchRequest:itemsFetch error:&itemErr];
+        if (!itemErr) {
+            for (NSManagedObject *ciMO in linkedItems) {
+                itemsById[[ciMO valueForKey:@"id"]] = ciMO;
+            }
+        } else {
+            NSLog(@"Error fetching clothing items for outfit save: %@", itemErr.localizedDescription);
+        }
+    }
+
+    NSEntityDescription *ent = [NSEntityDescription entityForName:@"CDOutfit"
+                                           inManagedObjectContext:ctx];
+    for (const auto &outfit : outfits) {
+        NSString *outfitId = toNSString(outfit.getId());
+        NSManagedObject *oMO = outfitsById[outfitId];
+        if (!oMO) {
+            oMO = [[NSManagedObject alloc] initWithEntity:ent
+                           insertIntoManagedObjectContext:ctx];
+            outfitsById[outfitId] = oMO;
+        }
+        fillOutfitMO(oMO, userMO, outfit, itemsById);
+    }
 
+    // un singur commit pentru tot lotul; la eroare nu ramane nimic din el
     NSError *saveErr = nil;
     if (![ctx save:&saveErr]) {
-        NSLog(@"Error saving Outfit: %@", saveErr.localizedDescription);
+        NSLog(@"Error saving Outfits: %@", saveErr.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
-bool objcDeleteOutfit(const std::string& username,
+bool objcDeleteOutfit(const UserHandle& user,
                       const std::string& outfitId)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcDeleteOutfit");
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    // Fetch User MO
-    NSFetchRequest *userFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDUser"];
-    userFetch.predicate = [NSPredicate predicateWithFormat:@"username == %@", toNSString(username)];
-    NSError *uErr = nil;
-    NSArray *uResults = [ctx executeFetchRequest:userFetch error:&uErr];
-    if (uErr || uResults.count == 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
         return false;
     }
-    NSManagedObject *userMO = uResults.firstObject;
 
     // Fetch Outfit by id and owner
     NSFetchRequest *oFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDOutfit"];
     oFetch.predicate = [NSPredicate predicateWithFormat:@"id == %@ AND owner == %@", toNSString(outfitId), userMO];
     NSError *oErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
     NSArray *oResults = [ctx executeFetchRequest:oFetch error:&oErr];
     if (oErr || oResults.count == 0) {
         return false;
@@ -629,38 +893,343 @@ bool objcDeleteOutfit(const std::string& username,
     NSError *delErr = nil;
     if (![ctx save:&delErr]) {
         NSLog(@"Error deleting Outfit: %@", delErr.localizedDescription);
+        [ctx rollback];
         return false;
     }
     return true;
 }
 
-int objcGenerateNextClothingItemId()
+bool objcDeleteOutfits(const UserHandle& user,
+                       std::span<const std::string> outfitIds)
 {
-    AppDelegate *app = (AppDelegate *)[UIApplication sharedApplication].delegate;
-    NSManagedObjectContext *ctx = app.persistentContainer.viewContext;
+    DD_METRIC_SCOPE("objcDeleteOutfits");
+    if (outfitIds.empty()) {
+        return true;
+    }
+    NSManagedObjectContext *ctx = persistenceContext();
 
-    static int lastGeneratedId = -1;
-    if (lastGeneratedId < 0) {
+    NSManagedObject *userMO = userObjectFor(ctx, user);
+    if (!userMO) {
+        return false;
+    }
+
+    NSMutableArray<NSString *> *ids = [NSMutableArray arrayWithCapacity:outfitIds.size()];
+    for (const auto &outfitId : outfitIds) {
+        [ids addObject:toNSString(outfitId)];
+    }
+    NSFetchRequest *oFetch = [NSFetchRequest fetchRequestWithEntityName:@"CDOutfit"];
+    oFetch.predicate = [NSPredicate predicateWithFormat:@"id IN %@ AND owner == %@", ids, userMO];
+    NSError *oErr = nil;
+    DD_METRIC_COUNT("CoreAdapter.fetches", 1);
+    NSArray *oResults = [ctx executeFetchRequest:oFetch error:&oErr];
+    if (oErr) {
+        return false;
+    }
+    for (NSManagedObject *oMO in oResults) {
+        [ctx deleteObject:oMO];
+    }
+
+    NSError *delErr = nil;
+    if (![ctx save:&delErr]) {
+        NSLog(@"Error deleting Outfits: %@", delErr.localizedDescription);
+        [ctx rollback];
+        return false;
+    }
+    return true;
+}
+
+UserHandlePtr objcResolveUser(const std::string& username)
+{
+    DD_METRIC_SCOPE("objcResolveUser");
+    NSManagedObjectContext *ctx = persistenceContext();
+
+    NSManagedObject *userMO = fetchUserObject(ctx, username);
+    if (!userMO) {
+        return nullptr;
+    }
+    return makeUserHandle(userMO, username);
+}
+
+std::uint64_t objcUserLookupsSaved()
+{
+    return savedUserLookups.load(std::memory_order_relaxed);
+}
+
+int objcGenerateNextClothingItemId()
+{
+    DD_METRIC_SCOPE("objcGenerateNextClothingItemId");
+    // maximul din store se citeste o singura data; apoi doar incrementare atomica.
+    // Ultimul id dat se pastreaza si in NSUserDefaults: dupa stergerea articolului cu id-ul maxim
+    // si o repornire, id-ul nu se refoloseste (jurnalul purtarilor ar lega vechile purtari de
+    // articolul nou).
+    static NSString *const LastIdKey = @"DressDiary.lastClothingItemId";
+    static std::atomic<int> lastGeneratedId{-1};
+    if (lastGeneratedId.load() < 0) {
+        NSManagedObjectContext *ctx = persistenceContext();
         NSFetchRequest *request = [NSFetchRequest fetchRequestWithEntityName:@"CDClothingItem"];
         request.sortDescriptors = @[ [NSSortDescriptor sortDescriptorWithKey:@"id" ascending:NO] ];
         request.fetchLimit = 1;
         NSError *err = nil;
+        DD_METRIC_COUNT("CoreAdapter.fetches", 1);
         NSArray *results = [ctx executeFetchRequest:request error:&err];
+        int maxId = 0;
         if (!err && results.count > 0) {
             NSManagedObject *ciMO = results.firstObject;
-            lastGeneratedId = [[ciMO valueForKey:@"id"] intValue];
-        } else {
-            lastGeneratedId = 0;
+            maxId = [[ciMO valueForKey:@"id"] intValue];
         }
+        maxId = std::max(maxId, static_cast<int>([NSUserDefaults.standardUserDefaults integerForKey:LastIdKey]));
+        int unset = -1;
+        lastGeneratedId.compare_exchange_strong(unset, maxId);
     }
 
-    lastGeneratedId += 1;
-    return lastGeneratedId;
+    const int nextId = lastGeneratedId.fetch_add(1) + 1;
+    [NSUserDefaults.standardUserDefaults setInteger:nextId forKey:LastIdKey];
+    return nextId;
 }
 
 std::string objcGenerateNextOutfitId()
 {
+    DD_METRIC_SCOPE("objcGenerateNextOutfitId");
     NSUUID *uuid = [NSUUID UUID];
     NSString *uuidString = [uuid UUIDString];
     return std::string([uuidString UTF8String]);
 }
+
+// --------------------
+// CoreDataBackend
+// --------------------
+
+bool CoreDataBackend::createUser(const std::string &username, const std::string &name, const std::string &password)
+{
+    return performOnPersistenceContext([&] { return objcCreateUser(username, name, password); });
+}
+
+std::shared_ptr<User> CoreDataBackend::loginUser(const std::string &username, const std::string &password)
+{
+    // userul tocmai a fost citit: pastram handle-ul pentru resolveUser
+    UserHandlePtr handle;
+    auto user = performOnPersistenceContext([&] { return objcLoginUser(username, password, &handle); });
+    if (handle) {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        resolved_[username] = std::move(handle);
+    }
+    return user;
+}
+
+bool CoreDataBackend::updateUserLoginMeta(const UserHandle &user, Date lastLoginDate, int streak)
+{
+    return performOnPersistenceContext([&] { return objcUpdateUserLoginMeta(user, lastLoginDate, streak); });
+}
+
+bool CoreDataBackend::updateUserDarkMode(const UserHandle &user, bool isDarkMode)
+{
+    return performOnPersistenceContext([&] { return objcUpdateUserDarkMode(user, isDarkMode); });
+}
+
+std::shared_ptr<User> CoreDataBackend::recoverUser(const std::string &username)
+{
+    UserHandlePtr handle;
+    auto user = performOnPersistenceContext([&] { return objcRecoverUser(username, &handle); });
+    if (handle) {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        resolved_[username] = std::move(handle);
+    }
+    return user;
+}
+
+UserHandlePtr CoreDataBackend::resolveUser(const std::string &username)
+{
+    {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        auto it = resolved_.find(username);
+        if (it != resolved_.end()) {
+            savedUserLookups.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+    UserHandlePtr handle = performOnPersistenceContext([&] { return objcResolveUser(username); });
+    if (handle) {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        resolved_[username] = handle;
+    }
+    return handle;
+}
+
+std::uint64_t CoreDataBackend::userLookupsSaved() const
+{
+    return objcUserLookupsSaved();
+}
+
+std::vector<ItemRecord> CoreDataBackend::fetchClothingItems(const UserHandle &user)
+{
+    return performOnPersistenceContext([&] { return objcFetchClothingItems(user, blobs_.get()); });
+}
+
+std::vector<ItemRecord> CoreDataBackend::fetchClothingItemPage(const UserHandle &user, int afterId, std::size_t limit)
+{
+    return performOnPersistenceContext([&] { return objcFetchClothingItemPage(user, afterId, limit, blobs_.get()); });
+}
+
+bool CoreDataBackend::saveClothingItem(const UserHandle &user, const ItemRecord &item)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcSaveClothingItem(user, item); });
+}
+
+bool CoreDataBackend::deleteClothingItem(const UserHandle &user, int itemId)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcDeleteClothingItem(user, itemId); });
+}
+
+bool CoreDataBackend::saveClothingItems(const UserHandle &user, std::span<const ItemRecord> items)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcSaveClothingItems(user, items); });
+}
+
+bool CoreDataBackend::deleteClothingItems(const UserHandle &user, std::span<const int> itemIds)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcDeleteClothingItems(user, itemIds); });
+}
+
+std::vector<std::shared_ptr<Outfit>> CoreDataBackend::fetchOutfits(const UserHandle &user)
+{
+    return performOnPersistenceContext([&] { return objcFetchOutfits(user); });
+}
+
+std::vector<std::shared_ptr<Outfit>> CoreDataBackend::fetchOutfitPage(const UserHandle &user, const std::string &afterId,
+                                                                      std::size_t limit)
+{
+    return performOnPersistenceContext([&] { return objcFetchOutfitPage(user, afterId, limit); });
+}
+
+bool CoreDataBackend::saveOutfit(const UserHandle &user, const Outfit &outfit)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcSaveOutfit(user, outfit); });
+}
+
+bool CoreDataBackend::saveOutfits(const UserHandle &user, std::span<const Outfit> outfits)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcSaveOutfits(user, outfits); });
+}
+
+bool CoreDataBackend::deleteOutfit(const UserHandle &user, const std::string &outfitId)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcDeleteOutfit(user, outfitId); });
+}
+
+bool CoreDataBackend::deleteOutfits(const UserHandle &user, std::span<const std::string> outfitIds)
+{
+    if (!bumpRevision(user)) {
+        return false;
+    }
+    return performOnPersistenceContext([&] { return objcDeleteOutfits(user, outfitIds); });
+}
+
+// username-ul ajunge in numele fisierului, deci doar caractere alfanumerice (restul %-codate)
+std::string CoreDataBackend::userFilePath(const UserHandle &user, const char *extension) const
+{
+    NSString *name = [toNSString(user.username())
+        stringByAddingPercentEncodingWithAllowedCharacters:[NSCharacterSet alphanumericCharacterSet]];
+    if (userDataDir_.empty() || !name) {
+        return "";
+    }
+    return userDataDir_ + "/" + toStdString(name) + extension;
+}
+
+// fisierul e scris doar de worker-ul de persistenta, nu trece prin contextul Core Data
+bool CoreDataBackend::appendWearRecords(const UserHandle &user, std::span<const WearRecord> records)
+{
+    DD_METRIC_SCOPE("CoreDataBackend::appendWearRecords");
+    std::string path = userFilePath(user, ".wear");
+    if (path.empty()) {
+        return true;
+    }
+    return bumpRevision(user) && WearLog::appendToFile(path, records);
+}
+
+std::vector<WearRecord> CoreDataBackend::fetchWearRecords(const UserHandle &user)
+{
+    DD_METRIC_SCOPE("CoreDataBackend::fetchWearRecords");
+    std::string path = userFilePath(user, ".wear");
+    return path.empty() ? std::vector<WearRecord>{} : WearLog::readFile(path);
+}
+
+// versiunea: un u64 little-endian in <user>.rev, tinut si in memorie dupa prima citire.
+// Fara fisier (sau cu unul incomplet) se porneste de la o valoare aleatoare, nu de la 1,
+// ca o versiune pierduta sa nu poata ajunge din nou la valoarea unui snapshot vechi.
+std::uint64_t CoreDataBackend::dataRevision(const UserHandle &user)
+{
+    std::string path = userFilePath(user, ".rev");
+    if (path.empty()) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(revisionsMutex_);
+    auto it = revisions_.find(user.username());
+    if (it != revisions_.end()) {
+        return it->second;
+    }
+    std::uint64_t revision = 0;
+    if (std::FILE *in = std::fopen(path.c_str(), "rb")) {
+        std::uint8_t bytes[8];
+        if (std::fread(bytes, 1, sizeof(bytes), in) == sizeof(bytes)) {
+            for (int i = 0; i < 8; ++i) {
+                revision |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+            }
+        }
+        std::fclose(in);
+    }
+    while (revision == 0) {
+        arc4random_buf(&revision, sizeof(revision));
+        // loc pentru incrementari: valoarea nu ajunge la 0 (= neurmarita)
+        revision >>= 1;
+    }
+    revisions_[user.username()] = revision;
+    return revision;
+}
+
+bool CoreDataBackend::bumpRevision(const UserHandle &user)
+{
+    std::string path = userFilePath(user, ".rev");
+    if (path.empty()) {
+        return true;
+    }
+    std::uint64_t revision = dataRevision(user) + 1;
+    std::lock_guard<std::mutex> lock(revisionsMutex_);
+    revisions_[user.username()] = revision;
+    std::uint8_t bytes[8];
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<std::uint8_t>(revision >> (8 * i));
+    }
+    // temporar + fsync + rename: o cadere nu lasa un .rev gol (care ar reporni numaratoarea)
+    return WardrobeSnapshot::writeFile(path, std::span<const std::uint8_t>(bytes, sizeof(bytes)));
+}
+
+int CoreDataBackend::generateNextClothingItemId()
+{
+    return performOnPersistenceContext([] { return objcGenerateNextClothingItemId(); });
+}
+
+std::string CoreDataBackend::generateNextOutfitId()
+{
+    return objcGenerateNextOutfitId();
+}
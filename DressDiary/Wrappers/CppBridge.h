@@ -4,6 +4,46 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ Operație asincronă pornită prin CppBridge (variantele cu `completion:`).
+ `cancel` oprește lucrul rămas și garantează că blocul de completion nu mai e apelat;
+ de apelat când view-ul care a cerut datele dispare.
+*/
+@interface CppCancellable : NSObject
+- (void)cancel;
+@property (nonatomic, readonly, getter=isCancelled) BOOL cancelled;
+@end
+
+/**
+ Vedere asupra unui articol dintr-un CppItemBatch: citește direct din lotul C++,
+ fără dicționar și fără copierea imaginii. Câmpurile altor categorii sunt nil.
+*/
+@interface CppItemView : NSObject
+@property (nonatomic, readonly) int itemId;
+@property (nonatomic, readonly) NSString *category;
+@property (nonatomic, readonly) NSString *color;
+@property (nonatomic, readonly) NSArray<NSString *> *materials;
+/** Bytes-ii imaginii, fără copiere (NSData ține în viață bufferul din C++). */
+@property (nonatomic, readonly) NSData *image;
+/** Thumbnail-ul generat la salvare (doar pentru imaginile din BlobStore). */
+@property (nonatomic, readonly, nullable) NSData *thumbnail;
+@property (nonatomic, readonly, nullable) NSNumber *pantLength;
+@property (nonatomic, readonly, nullable) NSString *pantWaist;
+@property (nonatomic, readonly, nullable) NSNumber *jacketWaterproof;
+@property (nonatomic, readonly, nullable) NSString *topSleeveType;
+@property (nonatomic, readonly, nullable) NSString *topNeckline;
+@property (nonatomic, readonly, nullable) NSNumber *shoeSize;
+@end
+
+/**
+ Lot de articole într-un singur buffer C++ cu layout fix; valorile text se convertesc
+ o singură dată pe lot (pool de simboluri), nu pentru fiecare articol.
+*/
+@interface CppItemBatch : NSObject
+@property (nonatomic, readonly) NSInteger count;
+- (CppItemView *)itemAtIndex:(NSInteger)index;
+@end
+
 @interface CppBridge : NSObject
 
 #pragma mark – User
@@ -15,12 +55,17 @@ NS_ASSUME_NONNULL_BEGIN
 + (nullable NSString *)loginUser:(NSString *)username
                         password:(NSString *)password;
 
+/** Închide sesiunea utilizatorului curent (garderoba lui iese din cache). */
++ (void)logout;
+
 + (int)getClothingItemCountForUser:(NSString *)username;
 + (int)getOutfitCountForUser:(NSString *)username;
 + (void)setDarkMode:(BOOL)isDark;
 + (BOOL)getDarkMode;
 + (NSString *)getCurrentName;
 + (int)getCurrentStreak;
+/** Numărul de fetch-uri pe user evitate prin handle-ul rezolvat la login (diagnostic). */
++ (NSInteger)getUserLookupsSaved;
 + (BOOL)recoverUserFromCoreData:(NSString *)username;
 
 #pragma mark – ClothingItem
@@ -42,6 +87,25 @@ NS_ASSUME_NONNULL_BEGIN
 */
 + (NSArray<NSDictionary *> *)fetchClothingItemsForUser:(NSString *)username;
 
+/** Aceleași articole ca fetchClothingItemsForUser, ca lot compact (fără un NSDictionary per articol). */
++ (CppItemBatch *)fetchItemBatchForUser:(NSString *)username;
+
+/**
+ Ca fetchClothingItemsForUser, dar în fundal; completion rulează pe main queue
+ (doar dacă operația n-a fost anulată).
+*/
++ (CppCancellable *)fetchClothingItemsForUser:(NSString *)username
+                                   completion:(void (^)(NSArray<NSDictionary *> *items))completion;
+
+/**
+ Articolele pe pagini de câte `pageSize`, crescător după id: prima pagină ajunge fără să se
+ aștepte restul garderobei. `onPage` rulează pe main queue pentru fiecare pagină; ultima are
+ `last` = YES (poate fi goală). După cancel nu mai vin pagini.
+*/
++ (CppCancellable *)fetchClothingItemsForUser:(NSString *)username
+                                     pageSize:(NSInteger)pageSize
+                                       onPage:(void (^)(CppItemBatch *page, BOOL last))onPage;
+
 /**
  Salvează un ClothingItem nou pentru user.
  @param username       – username-ul proprietarului
@@ -90,6 +154,10 @@ NS_ASSUME_NONNULL_BEGIN
 */
 + (NSArray<NSDictionary *> *)fetchOutfitsForUser:(NSString *)username;
 
+/** Ca fetchOutfitsForUser, în fundal; completion pe main queue dacă nu s-a anulat. */
++ (CppCancellable *)fetchOutfitsForUser:(NSString *)username
+                             completion:(void (^)(NSArray<NSDictionary *> *outfits))completion;
+
 /**
  Salvează un Outfit nou pentru user.
  @param username  – username-ul proprietarului
@@ -97,7 +165,7 @@ NS_ASSUME_NONNULL_BEGIN
  @param dateAdded – data adăugării ("DD-MM-YYYY")
  @param season    – sezonul (“vara”, “iarna” etc.)
  @param itemIds   – NSArray<NSNumber *> cu id-urile articolelor componente
- @return YES dacă a reușit salvarea, NO altfel.
+ @return YES dacă a reușit salvarea, NO altfel (inclusiv pentru o dată invalidă).
 */
 + (BOOL)saveOutfitForUser:(NSString *)username
                      name:(NSString *)name
@@ -105,6 +173,36 @@ NS_ASSUME_NONNULL_BEGIN
                    season:(NSString *)season
                   itemIds:(NSArray<NSNumber *> *)itemIds;
 
+/**
+ Ca saveOutfitForUser, în fundal; completion pe main queue.
+ Anularea are efect doar până când salvarea a pornit.
+*/
++ (CppCancellable *)saveOutfitForUser:(NSString *)username
+                                 name:(NSString *)name
+                            dateAdded:(NSString *)dateAdded
+                               season:(NSString *)season
+                              itemIds:(NSArray<NSNumber *> *)itemIds
+                           completion:(void (^)(BOOL saved))completion;
+
+/**
+ Dacă e YES, saveOutfitForUser refuză un outfit cu exact aceleași articole ca unul existent.
+ Implicit NO (duplicatul se poate semnala cu findDuplicateOutfitForUser).
+*/
++ (void)setRejectDuplicateOutfits:(BOOL)reject;
+
+/**
+ Id-ul outfit-ului salvat care are exact aceleași articole (ordinea nu contează), sau nil.
+*/
++ (nullable NSString *)findDuplicateOutfitForUser:(NSString *)username
+                                          itemIds:(NSArray<NSNumber *> *)itemIds;
+
+/**
+ Perechile de outfit-uri cu articole în mare parte comune (similaritate Jaccard >= threshold, 0..1).
+ Fiecare NSDictionary are cheile @"first", @"second" (id-uri de outfit) și @"similarity" (NSNumber).
+*/
++ (NSArray<NSDictionary *> *)findNearDuplicateOutfitsForUser:(NSString *)username
+                                                   threshold:(double)threshold;
+
 /**
  Șterge Outfit-ul cu id-ul dat pentru user.
  @return YES dacă a găsit și a șters outfit-ul, NO altfel.
@@ -113,13 +211,79 @@ NS_ASSUME_NONNULL_BEGIN
                   outfitId:(NSString *)outfitId;
 
 /**
- Returnează sugestia de outfit pentru ziua curentă (bazat pe sezon).
+ Returnează sugestia de outfit pentru ziua curentă: aleasă ponderat dintre outfit-urile
+ sezonului, favorizând ce n-a mai fost purtat sau sugerat recent (aceeași pe parcursul zilei).
  Dacă nu există niciun outfit pentru sezonul curent, returnează nil.
  Formatul NSDictionary este același ca la fetchOutfitsForUser: cheile
    @"id", @"name", @"dateAdded", @"season", @"items", @"itemIds"
 */
 + (nullable NSDictionary *)getTodaySuggestionForUser:(NSString *)username;
 
+/** Ca getTodaySuggestionForUser, în fundal; completion pe main queue dacă nu s-a anulat. */
++ (CppCancellable *)getTodaySuggestionForUser:(NSString *)username
+                                   completion:(void (^)(NSDictionary * _Nullable suggestion))completion;
+
+/**
+ Marchează outfit-ul ca purtat azi: se adaugă în jurnalul de purtări (persistat)
+ și influențează sugestiile următoare.
+ @return YES dacă outfit-ul există și purtarea s-a salvat, NO altfel.
+*/
++ (BOOL)markOutfitWornForUser:(NSString *)username
+                     outfitId:(NSString *)outfitId;
+
+/**
+ Compune outfit-uri noi din articolele user-ului (top, pants, shoes și, iarna sau pe ploaie,
+ o geacă), ordonate descrescător după compatibilitatea culorilor / materialelor cu sezonul curent.
+ Outfit-urile nu se salvează. Fiecare NSDictionary are cheile:
+   @"itemIds" (NSArray<NSNumber>), @"items" (ca la fetchClothingItemsForUser), @"score" (NSNumber)
+*/
++ (NSArray<NSDictionary *> *)generateOutfitsForUser:(NSString *)username
+                                              count:(NSInteger)count;
+
+#pragma mark – Purtări
+
+/**
+ Marchează un articol ca purtat azi, separat de un outfit.
+ @return YES dacă articolul există și purtarea s-a salvat, NO altfel.
+*/
++ (BOOL)markItemWornForUser:(NSString *)username
+                     itemId:(int)itemId;
+
+/**
+ Statisticile de purtare, din agregatele ținute la zi (fără reparcurgerea istoricului). Cheile:
+   @"outfitWears", @"itemWears", @"neverWorn" (NSNumber) – @"neverWorn" = articole niciodată purtate;
+   @"mostWorn" – NSArray de NSDictionary cu @"id", @"name", @"wears", cele mai purtate outfit-uri
+   din ultimele @"windowDays" zile, descrescător;
+   @"colors", @"categories" – NSArray de NSDictionary cu @"name", @"count" (purtări), descrescător.
+*/
++ (NSDictionary<NSString *, id> *)wearStatsForUser:(NSString *)username;
+
+#pragma mark – Export / import
+
+/**
+ Scrie garderoba userului (articole, outfit-uri, purtări și toate imaginile) într-un singur fișier.
+ @return YES dacă fișierul a fost scris, NO altfel.
+*/
++ (BOOL)exportWardrobeForUser:(NSString *)username
+                       toPath:(NSString *)path;
+
+/**
+ Adaugă userului garderoba dintr-un fișier exportat; articolele și outfit-urile primesc id-uri noi.
+ @return NO dacă fișierul nu este valid sau salvarea a eșuat.
+*/
++ (BOOL)importWardrobeForUser:(NSString *)username
+                     fromPath:(NSString *)path;
+
+#pragma mark – Culori
+
+/**
+ Culoarea dominantă a fotografiei, în vocabularul din AddItemView (@"red", @"blue", @"gray", ...),
+ calculată în fundal (fundalul uniform și pixelii transparenți sunt ignorați).
+ completion rulează pe main queue, cu nil dacă imaginea nu a putut fi analizată.
+*/
++ (CppCancellable *)detectColorForImage:(NSData *)image
+                             completion:(void (^)(NSString * _Nullable color))completion;
+
 #pragma mark – Filtrare simplă
 
 /**
@@ -129,6 +293,16 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSArray<NSDictionary *> *)fetchAndFilterItemsForUser:(NSString *)username
                                                  color:(NSString *)color;
 
+/**
+ Filtrare multi-atribut prin indexul din C++: OR între valorile aceluiași atribut,
+ AND între atribute; un array gol înseamnă „orice valoare”. Comparația ignoră majusculele.
+ Returnează doar id-urile articolelor potrivite.
+*/
++ (NSArray<NSNumber *> *)filterItemIdsForUser:(NSString *)username
+                                       colors:(NSArray<NSString *> *)colors
+                                    materials:(NSArray<NSString *> *)materials
+                                   categories:(NSArray<NSString *> *)categories;
+
 /**
  Filtrează Outfit-urile după sezon.
  Returnează array de NSDictionary ca la fetchOutfitsForUser.
@@ -136,6 +310,39 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSArray<NSDictionary *> *)fetchAndFilterOutfitsForUser:(NSString *)username
                                                    season:(NSString *)season;
 
+#pragma mark – Metrici
+
+/**
+ Metricile căilor fierbinți (DataManager, adaptoarele Core Data, conversiile din bridge).
+ Cheile: @"timers" – NSArray de NSDictionary cu @"name", @"count", @"totalMs", @"p50Ms",
+ @"p99Ms", @"maxMs"; @"counters" – NSDictionary nume → NSNumber.
+ Goale dacă metricile sunt dezactivate la compilare (DRESSDIARY_METRICS=0, implicit în release).
+*/
++ (NSDictionary<NSString *, id> *)metricsSnapshot;
++ (void)resetMetrics;
+
+/** Pornește / oprește înregistrarea evenimentelor pentru trace (ultimele 65536 se păstrează). */
++ (void)setMetricsTracing:(BOOL)enabled;
+
+/** Evenimentele înregistrate, în format Chrome trace-event JSON (chrome://tracing, Perfetto). */
++ (NSString *)metricsTraceJSON;
+
+#if DEBUG
+#pragma mark – Date sintetice (doar debug)
+
+/**
+ Adaugă userului o garderobă sintetică deterministă (același seed → aceleași articole),
+ pentru profilare cu Instruments la sute sau mii de articole.
+ @param imageBytes – mărimea imaginii fiecărui articol (0 = fără imagini)
+ @return YES dacă toate articolele și outfit-urile au fost salvate.
+*/
++ (BOOL)seedSyntheticWardrobeForUser:(NSString *)username
+                               items:(NSInteger)items
+                             outfits:(NSInteger)outfits
+                          imageBytes:(NSInteger)imageBytes
+                                seed:(uint64_t)seed;
+#endif
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -1,21 +1,32 @@
 #import "CppBridge.h"
 #import <CoreData/CoreData.h>
+#import <ImageIO/ImageIO.h>
 #import <UIKit/UIKit.h>
 #import "CoreAdapter.h"
 #import "CurrentUser.hpp"
 #import "DataManager.hpp"
 #import "ClothingItem.hpp"
+#import "ItemRecord.hpp"
 #import "ItemFactory.hpp"
 #import "Items.hpp"
 #import "Outfit.hpp"
 #import "User.hpp"
 #import "Utilities.hpp"
-
+#import "CancellationToken.hpp"
+#import "ItemBatch.hpp"
+#import "SyntheticWardrobe.hpp"
+#import "ColorAnalyzer.hpp"
+#import "Metrics.hpp"
+#import "ImageBlobBridging.h"
+
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <span>
 
 using namespace std;
 
@@ -28,27 +39,95 @@ static vector<string> toStdStringVector(NSArray<NSString *> *array) {
     return result;
 }
 
-// Helper: construiește NSDictionary pentru un ClothingItem C++
-static NSDictionary<NSString *, id> *dictFromClothingItem(const shared_ptr<ClothingItem> &item) {
-    NSNumber *itemId = [NSNumber numberWithInt:item->getId()];
-    NSString *category = [NSString stringWithUTF8String:item->getCategory().c_str()];
-    NSString *color = [NSString stringWithUTF8String:item->getColor().c_str()];
+// Helper: thumbnail JPEG (latura maxima 480px) pentru carduri si colaje
+static vector<uint8_t> makeThumbnail(std::span<const uint8_t> bytes) {
+    DD_METRIC_SCOPE("CppBridge::makeThumbnail");
+    @autoreleasepool {
+        NSData *data = [NSData dataWithBytesNoCopy:const_cast<uint8_t *>(bytes.data())
+                                            length:bytes.size()
+                                      freeWhenDone:NO];
+        UIImage *image = [UIImage imageWithData:data];
+        if (!image || image.size.width <= 0 || image.size.height <= 0) {
+            return {};
+        }
+
+        const CGFloat maxSide = 480.0;
+        CGFloat scale = MIN(1.0, maxSide / MAX(image.size.width, image.size.height));
+        CGSize target = CGSizeMake(round(image.size.width * scale), round(image.size.height * scale));
 
-    // materials
-    vector<string> mats = item->getMaterials();
-    NSMutableArray<NSString *> *matArray = [NSMutableArray arrayWithCapacity:mats.size()];
-    for (const auto &m : mats) {
-        [matArray addObject:[NSString stringWithUTF8String:m.c_str()]];
+        UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+        format.scale = 1.0;
+        UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:target format:format];
+        UIImage *thumb = [renderer imageWithActions:^(UIGraphicsImageRendererContext *ctx) {
+            [image drawInRect:CGRectMake(0, 0, target.width, target.height)];
+        }];
+
+        NSData *jpeg = UIImageJPEGRepresentation(thumb, 0.75);
+        if (!jpeg) {
+            return {};
+        }
+        const uint8_t *raw = (const uint8_t *)jpeg.bytes;
+        DD_METRIC_COUNT("CppBridge.bytesCopied", jpeg.length);
+        return vector<uint8_t>(raw, raw + jpeg.length);
     }
+}
 
-    // image
-    const vector<uint8_t> &bytes = item->getImage();
-    NSData *imageData = nil;
-    if (!bytes.empty()) {
-        imageData = [NSData dataWithBytes:bytes.data() length:bytes.size()];
-    } else {
-        imageData = [NSData data];
+// Decoder pentru ColorAnalyzer: ImageIO decodeaza direct la latura ceruta (thumbnail, cu orientarea
+// aplicata), fara sa aloce imaginea completa; pixelii ajung RGBA8 in bufferul din `out`
+static bool decodeRGBA(std::span<const uint8_t> bytes, size_t maxSide, RgbaImage &out) {
+    DD_METRIC_SCOPE("CppBridge::decodeRGBA");
+    @autoreleasepool {
+        NSData *data = [NSData dataWithBytesNoCopy:const_cast<uint8_t *>(bytes.data())
+                                            length:bytes.size()
+                                      freeWhenDone:NO];
+        CGImageSourceRef source = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+        if (!source) {
+            return false;
+        }
+        NSDictionary *options = @{
+            (id)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
+            (id)kCGImageSourceCreateThumbnailWithTransform : @YES,
+            (id)kCGImageSourceThumbnailMaxPixelSize : @(maxSide)
+        };
+        CGImageRef image = CGImageSourceCreateThumbnailAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+        CFRelease(source);
+        if (!image) {
+            return false;
+        }
+
+        out.width = CGImageGetWidth(image);
+        out.height = CGImageGetHeight(image);
+        out.pixels.assign(out.width * out.height * 4, 0);
+        CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+        CGContextRef context = CGBitmapContextCreate(out.pixels.data(), out.width, out.height, 8, out.width * 4, space,
+                                                     kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+        CGColorSpaceRelease(space);
+        if (context) {
+            CGContextDrawImage(context, CGRectMake(0, 0, out.width, out.height), image);
+            CGContextRelease(context);
+        }
+        CGImageRelease(image);
+        return context != NULL;
     }
+}
+
+// Helper: construiește NSDictionary pentru un articol (record plat, fara RTTI)
+static NSDictionary<NSString *, id> *dictFromItemRecord(const ItemRecord &item) {
+    DD_METRIC_SCOPE("CppBridge::dictFromItemRecord");
+    DD_METRIC_COUNT("CppBridge.itemDicts", 1);
+    const SymbolTable &table = SymbolTable::getInstance();
+    NSNumber *itemId = [NSNumber numberWithInt:item.id];
+    NSString *category = [NSString stringWithUTF8String:item.categoryName().c_str()];
+    NSString *color = [NSString stringWithUTF8String:item.colorName().c_str()];
+
+    // materials
+    NSMutableArray<NSString *> *matArray = [NSMutableArray arrayWithCapacity:item.materials.size()];
+    for (Symbol m : item.materials) {
+        [matArray addObject:[NSString stringWithUTF8String:table.name(m).c_str()]];
+    }
+
+    // image (fara copiere: NSData arata in bufferul partajat al articolului)
+    NSData *imageData = nsDataFromBlob(item.image);
 
     NSMutableDictionary<NSString *, id> *dict = [@{
         @"id"         : itemId,
@@ -58,49 +137,57 @@ static NSDictionary<NSString *, id> *dictFromClothingItem(const shared_ptr<Cloth
         @"image"      : imageData
     } mutableCopy];
 
-    auto pantsPtr = std::dynamic_pointer_cast<Pants>(item);
-    if (pantsPtr) {
-        dict[@"pantLength"] = @(pantsPtr->getLungime());
-        dict[@"pantWaist"] = [NSString stringWithUTF8String:pantsPtr->getTalie().c_str()];
-    }
-
-    auto jacketPtr = std::dynamic_pointer_cast<Jacket>(item);
-    if (jacketPtr) {
-        dict[@"jacketWaterproof"] = @(jacketPtr->isWaterproof());
+    // thumbnail pentru listari (doar pentru imaginile din BlobStore)
+    if (!item.image.key().empty()) {
+        dict[@"thumbnail"] = nsDataFromBlob(DataManager::getInstance().getThumbnail(item.image));
     }
 
-    auto topPtr = std::dynamic_pointer_cast<Top>(item);
-    if (topPtr) {
-        dict[@"topSleeveType"] = [NSString stringWithUTF8String:topPtr->getManeca().c_str()];
-        dict[@"topNeckline"] = [NSString stringWithUTF8String:topPtr->getDecolteu().c_str()];
-    }
-
-    auto shoesPtr = std::dynamic_pointer_cast<Shoes>(item);
-    if (shoesPtr) {
-        dict[@"shoeSize"] = @(shoesPtr->getSizeShoes());
-    }
+    std::visit(overloaded{
+        [](std::monostate) {},
+        [&](const PantsData &pants) {
+            dict[@"pantLength"] = @(pants.lungime);
+            dict[@"pantWaist"] = [NSString stringWithUTF8String:table.name(pants.talie).c_str()];
+        },
+        [&](const JacketData &jacket) {
+            dict[@"jacketWaterproof"] = @(jacket.waterproof);
+        },
+        [&](const TopData &top) {
+            dict[@"topSleeveType"] = [NSString stringWithUTF8String:table.name(top.maneca).c_str()];
+            dict[@"topNeckline"] = [NSString stringWithUTF8String:table.name(top.decolteu).c_str()];
+        },
+        [&](const ShoesData &shoes) {
+            dict[@"shoeSize"] = @(static_cast<int>(shoes.size));
+        }}, item.payload);
 
     return dict;
 }
 
 // Helper: construiește NSDictionary pentru un Outfit C++
+// (articolele vin deja rezolvate prin join-ul din DataManager).
+// Cu `itemDicts`, dicționarul unui articol comun mai multor outfit-uri se construiește o singură dată.
 static NSDictionary<NSString *, id> *dictFromOutfit(
     const shared_ptr<Outfit> &outfit,
-    const unordered_map<int, shared_ptr<ClothingItem>> &itemsById
+    const vector<ItemRecord> &items,
+    NSMutableDictionary<NSNumber *, NSDictionary *> *itemCache = nil
 ) {
+    DD_METRIC_SCOPE("CppBridge::dictFromOutfit");
     NSString *outfitId  = [NSString stringWithUTF8String:outfit->getId().c_str()];
     NSString *name      = [NSString stringWithUTF8String:outfit->getName().c_str()];
-    NSString *dateAdded = [NSString stringWithUTF8String:outfit->getDateAdded().c_str()];
+    NSString *dateAdded = [NSString stringWithUTF8String:outfit->getDateAdded().toString().c_str()];
     NSString *season    = [NSString stringWithUTF8String:outfit->getSeason().c_str()];
     const auto &itemIds = outfit->getItemIds();
     NSMutableArray<NSNumber *> *itemIdsArray = [NSMutableArray arrayWithCapacity:itemIds.size()];
-    NSMutableArray<NSDictionary *> *itemDicts = [NSMutableArray arrayWithCapacity:itemIds.size()];
+    NSMutableArray<NSDictionary *> *itemDicts = [NSMutableArray arrayWithCapacity:items.size()];
     for (int identifier : itemIds) {
         [itemIdsArray addObject:@(identifier)];
-        auto it = itemsById.find(identifier);
-        if (it != itemsById.end() && it->second) {
-            [itemDicts addObject:dictFromClothingItem(it->second)];
+    }
+    for (const auto &item : items) {
+        NSDictionary *itemDict = itemCache[@(item.id)];
+        if (!itemDict) {
+            itemDict = dictFromItemRecord(item);
+            itemCache[@(item.id)] = itemDict;
         }
+        [itemDicts addObject:itemDict];
     }
     return @{
         @"id"        : outfitId,
@@ -112,8 +199,213 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
     };
 }
 
+// cate dictionare se construiesc intre doua verificari ale token-ului
+static const size_t kCancellationStride = 64;
+
+@interface CppCancellable ()
+- (CancellationToken)token;
+@end
+
+@implementation CppCancellable {
+    CancellationToken _token;
+}
+
+- (void)cancel {
+    _token.cancel();
+}
+
+- (BOOL)isCancelled {
+    return _token.isCancelled();
+}
+
+- (CancellationToken)token {
+    return _token;
+}
+
+@end
+
+@interface CppItemBatch ()
+- (instancetype)initWithBatch:(ItemBatch)batch;
+- (const ItemBatch &)batch;
+- (nullable NSString *)stringAtIndex:(uint32_t)index;
+@end
+
+@interface CppItemView ()
+- (instancetype)initWithBatch:(CppItemBatch *)batch index:(size_t)index;
+@end
+
+@implementation CppItemBatch {
+    std::shared_ptr<const ItemBatch> _batch;
+    NSArray<NSString *> *_strings;
+}
+
+- (instancetype)initWithBatch:(ItemBatch)batch {
+    DD_METRIC_SCOPE("CppBridge::CppItemBatch");
+    DD_METRIC_COUNT("CppBridge.batchItems", batch.size());
+    self = [super init];
+    if (self) {
+        _batch = std::make_shared<const ItemBatch>(std::move(batch));
+
+        // fiecare valoare distincta devine NSString o singura data pe lot
+        const SymbolTable &table = SymbolTable::getInstance();
+        NSMutableArray<NSString *> *strings = [NSMutableArray arrayWithCapacity:_batch->strings().size()];
+        for (Symbol symbol : _batch->strings()) {
+            [strings addObject:[NSString stringWithUTF8String:table.name(symbol).c_str()]];
+        }
+        _strings = strings;
+    }
+    return self;
+}
+
+- (const ItemBatch &)batch {
+    return *_batch;
+}
+
+- (nullable NSString *)stringAtIndex:(uint32_t)index {
+    return index == ItemBatch::NoString ? nil : _strings[index];
+}
+
+- (NSInteger)count {
+    return static_cast<NSInteger>(_batch->size());
+}
+
+- (CppItemView *)itemAtIndex:(NSInteger)index {
+    NSParameterAssert(index >= 0 && index < self.count);
+    return [[CppItemView alloc] initWithBatch:self index:static_cast<size_t>(index)];
+}
+
+@end
+
+@implementation CppItemView {
+    CppItemBatch *_owner; // tine lotul (si bufferele imaginilor) in viata
+    size_t _index;
+}
+
+- (instancetype)initWithBatch:(CppItemBatch *)batch index:(size_t)index {
+    self = [super init];
+    if (self) {
+        _owner = batch;
+        _index = index;
+    }
+    return self;
+}
+
+- (const ItemBatch::Record &)record {
+    return [_owner batch][_index];
+}
+
+- (int)itemId {
+    return [self record].id;
+}
+
+- (NSString *)category {
+    return [_owner stringAtIndex:[self record].category];
+}
+
+- (NSString *)color {
+    return [_owner stringAtIndex:[self record].color];
+}
+
+- (NSArray<NSString *> *)materials {
+    auto materials = [_owner batch].materials([self record]);
+    NSMutableArray<NSString *> *result = [NSMutableArray arrayWithCapacity:materials.size()];
+    for (uint32_t index : materials) {
+        [result addObject:[_owner stringAtIndex:index]];
+    }
+    return result;
+}
+
+- (NSData *)image {
+    return nsDataFromBlob([_owner batch].image(_index));
+}
+
+- (nullable NSData *)thumbnail {
+    const ImageBlob &image = [_owner batch].image(_index);
+    if (image.key().empty()) {
+        return nil;
+    }
+    return nsDataFromBlob(DataManager::getInstance().getThumbnail(image));
+}
+
+- (nullable NSNumber *)pantLength {
+    const auto &record = [self record];
+    return record.kind == ItemBatch::Kind::Pants ? @(record.pantLength) : nil;
+}
+
+- (nullable NSString *)pantWaist {
+    return [_owner stringAtIndex:[self record].pantWaist];
+}
+
+- (nullable NSNumber *)jacketWaterproof {
+    const auto &record = [self record];
+    return record.kind == ItemBatch::Kind::Jacket ? @(record.jacketWaterproof) : nil;
+}
+
+- (nullable NSString *)topSleeveType {
+    return [_owner stringAtIndex:[self record].topSleeveType];
+}
+
+- (nullable NSString *)topNeckline {
+    return [_owner stringAtIndex:[self record].topNeckline];
+}
+
+- (nullable NSNumber *)shoeSize {
+    const auto &record = [self record];
+    return record.kind == ItemBatch::Kind::Shoes ? @(static_cast<int>(record.shoeSize)) : nil;
+}
+
+@end
+
+// Helper: ruleaza work(token) pe executorul din DataManager si livreaza rezultatul pe main queue,
+// doar daca operatia n-a fost anulata intre timp. Anularea arunca OperationCancelled in job,
+// iar exceptia ramane in future-ul (ignorat) al executorului.
+template <typename Work, typename Completion>
+static CppCancellable *runCancellable(Work work, Completion completion) {
+    CppCancellable *handle = [[CppCancellable alloc] init];
+    CancellationToken token = [handle token];
+    DataManager::getInstance().getExecutor().submit(token, [work = std::move(work), completion, token]() mutable {
+        @autoreleasepool {
+            auto result = work(token);
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (!token.isCancelled()) {
+                    completion(result);
+                }
+            });
+        }
+    });
+    return handle;
+}
+
 @implementation CppBridge
 
++ (void)initialize {
+    if (self == [CppBridge class]) {
+        // imaginile stau in Application Support/Blobs, deduplicate dupa continut
+        NSURL *supportDir = [[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory
+                                                                   inDomains:NSUserDomainMask].firstObject;
+        NSString *blobsDir = [supportDir.path stringByAppendingPathComponent:@"Blobs"];
+        auto blobs = std::make_shared<BlobStore>(string([blobsDir UTF8String]));
+        blobs->setThumbnailGenerator(makeThumbnail);
+
+        // fisierele per user din afara Core Data (jurnalul de purtari, versiunea garderobei)
+        NSString *userDataDir = [supportDir.path stringByAppendingPathComponent:@"UserData"];
+        [[NSFileManager defaultManager] createDirectoryAtPath:userDataDir
+                                  withIntermediateDirectories:YES
+                                                   attributes:nil
+                                                        error:nil];
+
+        // pe iOS persistenta se face prin Core Data
+        DataManager::getInstance().setBackend(std::make_shared<CoreDataBackend>(blobs, string([userDataDir UTF8String])));
+        DataManager::getInstance().setBlobStore(blobs);
+
+        // snapshot-urile garderobei: la pornire cache-ul se incarca din ele, fara fetch-uri Core Data
+        NSString *snapshotDir = [supportDir.path stringByAppendingPathComponent:@"Snapshots"];
+        DataManager::getInstance().setSnapshotDirectory(string([snapshotDir UTF8String]));
+
+        ColorAnalyzer::getInstance().setDecoder(decodeRGBA);
+    }
+}
+
 #pragma mark – User
 
 + (BOOL)createUser:(NSString *)username
@@ -126,10 +418,7 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 
     bool ok = DataManager::getInstance().createUser(u, n, p);
     if (ok) {
-        auto userPtr = DataManager::getInstance().loginUser(u, p);
-        if (userPtr) {
-            CurrentUser::getInstance().setUser(userPtr);
-        }
+        CurrentUser::getInstance().login(u, p);
     }
     return ok;
 }
@@ -139,11 +428,14 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 {
     std::string u = [username UTF8String];
     std::string p = [password UTF8String];
-    auto cppUser = DataManager::getInstance().loginUser(u, p);
-    if (!cppUser) {
+    if (!CurrentUser::getInstance().login(u, p)) {
         return nil;
     }
-    return [NSString stringWithUTF8String:cppUser->getUsername().c_str()];
+    return [NSString stringWithUTF8String:CurrentUser::getInstance().getUser()->getUsername().c_str()];
+}
+
++ (void)logout {
+    CurrentUser::getInstance().logout();
 }
 
 + (void)setDarkMode:(BOOL)isDark {
@@ -153,7 +445,7 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
         return;
     }
     user->setDarkMode(isDark);
-    objcUpdateUserDarkMode(user->getUsername(), isDark);
+    DataManager::getInstance().updateDarkMode(user->getUsername(), isDark);
 }
 
 + (BOOL)getDarkMode {
@@ -172,6 +464,10 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
     return 0;
 }
 
++ (NSInteger)getUserLookupsSaved {
+    return static_cast<NSInteger>(DataManager::getInstance().getUserLookupsSaved());
+}
+
 + (int)getClothingItemCountForUser:(NSString *)username {
     std::string u = [username UTF8String];
     return static_cast<int>(DataManager::getInstance().getClothingItemsCount(u));
@@ -184,9 +480,7 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 
 + (BOOL)recoverUserFromCoreData:(NSString *)username {
     std::string u = [username UTF8String];
-    auto userPtr = objcRecoverUser(u);
-    if (userPtr) {
-        CurrentUser::getInstance().setUser(userPtr);
+    if (CurrentUser::getInstance().recover(u)) {
         return YES;
     }
     NSLog(@"[CppBridge] Failed to recover user from Core Data");
@@ -206,15 +500,68 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 #pragma mark – ClothingItem
 
 + (NSArray<NSDictionary *> *)fetchClothingItemsForUser:(NSString *)username {
+    DD_METRIC_SCOPE("CppBridge::fetchClothingItemsForUser");
     std::string u = [username UTF8String];
-    auto cppItems = DataManager::getInstance().getClothingItems(u);
-    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:cppItems.size()];
-    for (auto &itemPtr : cppItems) {
-        [result addObject:dictFromClothingItem(itemPtr)];
+    auto records = DataManager::getInstance().getItemRecords(u);
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:records.size()];
+    for (const auto &record : records) {
+        [result addObject:dictFromItemRecord(record)];
     }
     return result;
 }
 
++ (CppCancellable *)fetchClothingItemsForUser:(NSString *)username
+                                   completion:(void (^)(NSArray<NSDictionary *> *items))completion
+{
+    std::string u = [username UTF8String];
+    return runCancellable([u](const CancellationToken &token) {
+        DD_METRIC_SCOPE("CppBridge::fetchClothingItemsForUser(async)");
+        auto records = DataManager::getInstance().getItemRecords(u, token);
+        NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:records.size()];
+        for (size_t i = 0; i < records.size(); ++i) {
+            if (i % kCancellationStride == 0) {
+                token.throwIfCancelled();
+            }
+            [result addObject:dictFromItemRecord(records[i])];
+        }
+        return result;
+    }, completion);
+}
+
++ (CppItemBatch *)fetchItemBatchForUser:(NSString *)username {
+    DD_METRIC_SCOPE("CppBridge::fetchItemBatchForUser");
+    std::string u = [username UTF8String];
+    return [[CppItemBatch alloc] initWithBatch:DataManager::getInstance().getItemBatch(u)];
+}
+
++ (CppCancellable *)fetchClothingItemsForUser:(NSString *)username
+                                     pageSize:(NSInteger)pageSize
+                                       onPage:(void (^)(CppItemBatch *page, BOOL last))onPage
+{
+    CppCancellable *handle = [[CppCancellable alloc] init];
+    CancellationToken token = [handle token];
+    std::string u = [username UTF8String];
+    size_t batch = static_cast<size_t>(std::max<NSInteger>(pageSize, 1));
+    DataManager::getInstance().getExecutor().submit(token, [u, batch, token, onPage] {
+        ItemCursor cursor = DataManager::getInstance().openItemCursor(u);
+        while (!cursor.done()) {
+            token.throwIfCancelled();
+            @autoreleasepool {
+                DD_METRIC_SCOPE("CppBridge::fetchClothingItemsForUser(page)");
+                auto records = cursor.next(batch);
+                CppItemBatch *page = [[CppItemBatch alloc] initWithBatch:ItemBatch(records)];
+                BOOL last = cursor.done();
+                dispatch_async(dispatch_get_main_queue(), ^{
+                    if (!token.isCancelled()) {
+                        onPage(page, last);
+                    }
+                });
+            }
+        }
+    });
+    return handle;
+}
+
 + (BOOL)saveClothingItemForUser:(NSString *)username
                           color:(NSString *)color
                       materials:(NSArray<NSString *> *)materials
@@ -233,66 +580,29 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 
     vector<string> mats = toStdStringVector(materials);
 
-    vector<uint8_t> bytes;
-    if (imageData != nil && imageData.length > 0) {
-        const uint8_t *rawPtr = (const uint8_t *)imageData.bytes;
-        bytes.assign(rawPtr, rawPtr + imageData.length);
-    }
-
-    int newId = objcGenerateNextClothingItemId();
-    shared_ptr<ClothingItem> cppItem;
+    ImageBlob bytes = blobFromNSData(imageData);
 
+    SymbolTable &table = SymbolTable::getInstance();
+    ItemPayload payload;
     if ([category isEqualToString:@"pants"]) {
-        std::string waist = pantWaist ? [pantWaist UTF8String] : "";
-        cppItem = std::make_shared<Pants>(
-            newId,
-            c,
-            mats,
-            cat,
-            bytes,
-            pantLength,
-            waist
-        );
+        payload = PantsData{pantLength, table.intern(pantWaist ? [pantWaist UTF8String] : "")};
     } else if ([category isEqualToString:@"jacket"]) {
-        cppItem = std::make_shared<Jacket>(
-            newId,
-            c,
-            mats,
-            cat,
-            bytes,
-            jacketWaterproof
-        );
+        payload = JacketData{static_cast<bool>(jacketWaterproof)};
     } else if ([category isEqualToString:@"top"]) {
-        std::string sleeve = topSleeveType ? [topSleeveType UTF8String] : "";
-        std::string neckline = topNeckline ? [topNeckline UTF8String] : "";
-        cppItem = std::make_shared<Top>(
-            newId,
-            c,
-            mats,
-            cat,
-            bytes,
-            sleeve,
-            neckline
-        );
+        payload = TopData{
+            table.intern(topSleeveType ? [topSleeveType UTF8String] : ""),
+            table.intern(topNeckline ? [topNeckline UTF8String] : "")
+        };
     } else if ([category isEqualToString:@"shoes"]) {
-        cppItem = std::make_shared<Shoes>(
-            newId,
-            c,
-            mats,
-            cat,
-            bytes,
-            shoeSize
-        );
+        payload = ShoesData{shoeSize};
     } else {
         NSLog(@"[CppBridge] Unsupported category %@", category);
         return NO;
     }
 
-    if (!cppItem) {
-        return NO;
-    }
-
-    bool succes = DataManager::getInstance().saveClothingItem(u, *cppItem);
+    int newId = DataManager::getInstance().generateNextClothingItemId();
+    ItemRecord record = ItemFactory::createRecord(newId, c, mats, cat, std::move(bytes), std::move(payload));
+    bool succes = DataManager::getInstance().saveItemRecord(u, std::move(record));
     return succes ? YES : NO;
 }
 
@@ -306,24 +616,37 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 #pragma mark – Outfit
 
 + (NSArray<NSDictionary *> *)fetchOutfitsForUser:(NSString *)username {
+    DD_METRIC_SCOPE("CppBridge::fetchOutfitsForUser");
     std::string u = [username UTF8String];
-    auto cppOutfits = DataManager::getInstance().getOutfits(u);
-    auto cppItems = DataManager::getInstance().getClothingItems(u);
-    unordered_map<int, shared_ptr<ClothingItem>> itemsById;
-    itemsById.reserve(cppItems.size());
-    for (auto &itemPtr : cppItems) {
-        if (itemPtr) {
-            itemsById[itemPtr->getId()] = itemPtr;
-        }
-    }
+    auto outfits = DataManager::getInstance().getResolvedOutfits(u);
 
-    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:cppOutfits.size()];
-    for (auto &oPtr : cppOutfits) {
-        [result addObject:dictFromOutfit(oPtr, itemsById)];
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:outfits.size()];
+    NSMutableDictionary<NSNumber *, NSDictionary *> *itemDicts = [NSMutableDictionary dictionary];
+    for (const auto &resolved : outfits) {
+        [result addObject:dictFromOutfit(resolved.outfit, resolved.items, itemDicts)];
     }
     return result;
 }
 
++ (CppCancellable *)fetchOutfitsForUser:(NSString *)username
+                             completion:(void (^)(NSArray<NSDictionary *> *outfits))completion
+{
+    std::string u = [username UTF8String];
+    return runCancellable([u](const CancellationToken &token) {
+        DD_METRIC_SCOPE("CppBridge::fetchOutfitsForUser(async)");
+        auto outfits = DataManager::getInstance().getResolvedOutfits(u, token);
+        NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:outfits.size()];
+        NSMutableDictionary<NSNumber *, NSDictionary *> *itemDicts = [NSMutableDictionary dictionary];
+        for (size_t i = 0; i < outfits.size(); ++i) {
+            if (i % kCancellationStride == 0) {
+                token.throwIfCancelled();
+            }
+            [result addObject:dictFromOutfit(outfits[i].outfit, outfits[i].items, itemDicts)];
+        }
+        return result;
+    }, completion);
+}
+
 + (BOOL)saveOutfitForUser:(NSString *)username
                      name:(NSString *)name
                 dateAdded:(NSString *)dateAdded
@@ -332,19 +655,90 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 {
     std::string u    = [username UTF8String];
     std::string nm   = [name UTF8String];
-    std::string date = [dateAdded UTF8String];
+    std::optional<Date> date = Date::parse([dateAdded UTF8String]);
     std::string s    = [season UTF8String];
+    if (!date) {
+        return NO;
+    }
     std::vector<int> ids;
     ids.reserve(itemIds.count);
     for (NSNumber *num in itemIds) {
         ids.push_back(num.intValue);
     }
 
-    std::string newId = objcGenerateNextOutfitId();
-    auto cppOutfit = ItemFactory::createOutfit(newId, nm, date, s, {}, ids);
+    std::string newId = DataManager::getInstance().generateNextOutfitId();
+    auto cppOutfit = ItemFactory::createOutfit(newId, nm, *date, s, {}, ids);
     return DataManager::getInstance().saveOutfit(u, *cppOutfit);
 }
 
++ (CppCancellable *)saveOutfitForUser:(NSString *)username
+                                 name:(NSString *)name
+                            dateAdded:(NSString *)dateAdded
+                               season:(NSString *)season
+                              itemIds:(NSArray<NSNumber *> *)itemIds
+                           completion:(void (^)(BOOL saved))completion
+{
+    std::string u    = [username UTF8String];
+    std::string nm   = [name UTF8String];
+    std::optional<Date> date = Date::parse([dateAdded UTF8String]);
+    std::string s    = [season UTF8String];
+    std::vector<int> ids;
+    ids.reserve(itemIds.count);
+    for (NSNumber *num in itemIds) {
+        ids.push_back(num.intValue);
+    }
+
+    return runCancellable([u, nm, date, s, ids](const CancellationToken &) {
+        if (!date) {
+            return NO;
+        }
+        std::string newId = DataManager::getInstance().generateNextOutfitId();
+        auto cppOutfit = ItemFactory::createOutfit(newId, nm, *date, s, {}, ids);
+        return static_cast<BOOL>(DataManager::getInstance().saveOutfit(u, *cppOutfit));
+    }, completion);
+}
+
++ (void)setRejectDuplicateOutfits:(BOOL)reject
+{
+    DataManager::getInstance().setDuplicateOutfitPolicy(reject ? DataManager::DuplicateOutfitPolicy::Reject
+                                                               : DataManager::DuplicateOutfitPolicy::Allow);
+}
+
++ (nullable NSString *)findDuplicateOutfitForUser:(NSString *)username
+                                          itemIds:(NSArray<NSNumber *> *)itemIds
+{
+    std::string u = [username UTF8String];
+    std::vector<int> ids;
+    ids.reserve(itemIds.count);
+    for (NSNumber *num in itemIds) {
+        ids.push_back(num.intValue);
+    }
+
+    // outfit temporar, fara id: se compara doar articolele
+    auto probe = ItemFactory::createOutfit("", "", Date(), "", {}, ids);
+    auto duplicate = DataManager::getInstance().findDuplicateOutfit(u, *probe);
+    if (!duplicate) {
+        return nil;
+    }
+    return [NSString stringWithUTF8String:duplicate->getId().c_str()];
+}
+
++ (NSArray<NSDictionary *> *)findNearDuplicateOutfitsForUser:(NSString *)username
+                                                   threshold:(double)threshold
+{
+    std::string u = [username UTF8String];
+    auto matches = DataManager::getInstance().findNearDuplicateOutfits(u, threshold);
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:matches.size()];
+    for (const auto &match : matches) {
+        [result addObject:@{
+            @"first":      [NSString stringWithUTF8String:match.first.c_str()],
+            @"second":     [NSString stringWithUTF8String:match.second.c_str()],
+            @"similarity": @(match.jaccard)
+        }];
+    }
+    return result;
+}
+
 + (BOOL)deleteOutfitForUser:(NSString *)username
                   outfitId:(NSString *)outfitId
 {
@@ -354,20 +748,147 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 }
 
 + (nullable NSDictionary *)getTodaySuggestionForUser:(NSString *)username {
+    DD_METRIC_SCOPE("CppBridge::getTodaySuggestionForUser");
     std::string u = [username UTF8String];
     auto suggestion = DataManager::getInstance().getTodaySuggestion(u);
     if (!suggestion) {
         return nil;
     }
-    auto cppItems = DataManager::getInstance().getClothingItems(u);
-    unordered_map<int, shared_ptr<ClothingItem>> itemsById;
-    itemsById.reserve(cppItems.size());
-    for (auto &itemPtr : cppItems) {
-        if (itemPtr) {
-            itemsById[itemPtr->getId()] = itemPtr;
+    auto items = DataManager::getInstance().getOutfitItems(u, suggestion->getId());
+    return dictFromOutfit(suggestion, items);
+}
+
++ (CppCancellable *)getTodaySuggestionForUser:(NSString *)username
+                                   completion:(void (^)(NSDictionary * _Nullable suggestion))completion
+{
+    std::string u = [username UTF8String];
+    return runCancellable([u](const CancellationToken &token) -> NSDictionary * {
+        DD_METRIC_SCOPE("CppBridge::getTodaySuggestionForUser(async)");
+        auto suggestion = DataManager::getInstance().getTodaySuggestion(u);
+        if (!suggestion) {
+            return nil;
+        }
+        token.throwIfCancelled();
+        auto items = DataManager::getInstance().getOutfitItems(u, suggestion->getId());
+        return dictFromOutfit(suggestion, items);
+    }, completion);
+}
+
++ (BOOL)markOutfitWornForUser:(NSString *)username
+                     outfitId:(NSString *)outfitId
+{
+    std::string u   = [username UTF8String];
+    std::string oid = [outfitId UTF8String];
+    return DataManager::getInstance().markOutfitWorn(u, oid);
+}
+
++ (NSArray<NSDictionary *> *)generateOutfitsForUser:(NSString *)username
+                                              count:(NSInteger)count
+{
+    DD_METRIC_SCOPE("CppBridge::generateOutfitsForUser");
+    std::string u = [username UTF8String];
+    auto generated = DataManager::getInstance().generateOutfits(u, static_cast<std::size_t>(std::max<NSInteger>(count, 0)));
+    if (generated.empty()) {
+        return @[];
+    }
+
+    std::unordered_map<int, ItemRecord> byId;
+    for (auto &record : DataManager::getInstance().getItemRecords(u)) {
+        byId.emplace(record.id, std::move(record));
+    }
+
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:generated.size()];
+    for (const auto &outfit : generated) {
+        NSMutableArray<NSNumber *> *ids = [NSMutableArray arrayWithCapacity:outfit.itemIds.size()];
+        NSMutableArray<NSDictionary *> *items = [NSMutableArray arrayWithCapacity:outfit.itemIds.size()];
+        for (int id : outfit.itemIds) {
+            [ids addObject:@(id)];
+            auto it = byId.find(id);
+            if (it != byId.end()) {
+                [items addObject:dictFromItemRecord(it->second)];
+            }
         }
+        [result addObject:@{
+            @"itemIds": ids,
+            @"items":   items,
+            @"score":   @(outfit.score)
+        }];
+    }
+    return result;
+}
+
+#pragma mark – Purtări
+
++ (BOOL)markItemWornForUser:(NSString *)username
+                     itemId:(int)itemId
+{
+    std::string u = [username UTF8String];
+    return DataManager::getInstance().markItemWorn(u, itemId, Date::today());
+}
+
+static NSArray<NSDictionary *> *histogramArray(const DataManager::Histogram &histogram) {
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:histogram.size()];
+    for (const auto &[name, count] : histogram) {
+        [result addObject:@{
+            @"name"  : [NSString stringWithUTF8String:name.c_str()],
+            @"count" : @(count)
+        }];
+    }
+    return result;
+}
+
++ (NSDictionary<NSString *, id> *)wearStatsForUser:(NSString *)username
+{
+    DD_METRIC_SCOPE("CppBridge::wearStatsForUser");
+    std::string u = [username UTF8String];
+    DataManager::WearStats stats = DataManager::getInstance().getWearStats(u);
+
+    NSMutableArray<NSDictionary *> *mostWorn = [NSMutableArray arrayWithCapacity:stats.mostWorn.size()];
+    for (const auto &[outfit, wears] : stats.mostWorn) {
+        [mostWorn addObject:@{
+            @"id"    : [NSString stringWithUTF8String:outfit->getId().c_str()],
+            @"name"  : [NSString stringWithUTF8String:outfit->getName().c_str()],
+            @"wears" : @(wears)
+        }];
     }
-    return dictFromOutfit(suggestion, itemsById);
+    return @{
+        @"outfitWears" : @(stats.outfitWears),
+        @"itemWears"   : @(stats.itemWears),
+        @"neverWorn"   : @(stats.neverWorn),
+        @"windowDays"  : @(stats.windowDays),
+        @"mostWorn"    : mostWorn,
+        @"colors"      : histogramArray(stats.colors),
+        @"categories"  : histogramArray(stats.categories)
+    };
+}
+
+#pragma mark – Export / import
+
++ (BOOL)exportWardrobeForUser:(NSString *)username
+                       toPath:(NSString *)path
+{
+    DD_METRIC_SCOPE("CppBridge::exportWardrobe");
+    return DataManager::getInstance().exportWardrobe([username UTF8String], [path fileSystemRepresentation]);
+}
+
++ (BOOL)importWardrobeForUser:(NSString *)username
+                     fromPath:(NSString *)path
+{
+    DD_METRIC_SCOPE("CppBridge::importWardrobe");
+    return DataManager::getInstance().importWardrobe([username UTF8String], [path fileSystemRepresentation]);
+}
+
+#pragma mark – Culori
+
++ (CppCancellable *)detectColorForImage:(NSData *)image
+                             completion:(void (^)(NSString * _Nullable color))completion
+{
+    ImageBlob bytes = blobFromNSData(image);
+    return runCancellable([bytes](const CancellationToken &) -> NSString * {
+        DD_METRIC_SCOPE("CppBridge::detectColorForImage(async)");
+        std::string color = ColorAnalyzer::getInstance().analyze(bytes).dominant();
+        return color.empty() ? nil : [NSString stringWithUTF8String:color.c_str()];
+    }, completion);
 }
 
 #pragma mark – Filtrare simplă
@@ -375,15 +896,34 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 + (NSArray<NSDictionary *> *)fetchAndFilterItemsForUser:(NSString *)username
                                                   color:(NSString *)color
 {
+    DD_METRIC_SCOPE("CppBridge::fetchAndFilterItemsForUser");
     std::string u = [username UTF8String];
     std::string c = [color UTF8String];
-    auto items = DataManager::getInstance().getClothingItems(u);
-    NSMutableArray<NSDictionary *> *result = [NSMutableArray array];
-    for (auto &itemPtr : items) {
-        if (!itemPtr) { continue; }
-        if (c.empty() || itemPtr->getColor() == c) {
-            [result addObject:dictFromClothingItem(itemPtr)];
-        }
+    vector<string> colors;
+    if (!c.empty()) {
+        colors.push_back(c);
+    }
+    auto items = DataManager::getInstance().filterClothingItems(u, colors, {}, {});
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:items.size()];
+    for (const auto &record : items) {
+        [result addObject:dictFromItemRecord(record)];
+    }
+    return result;
+}
+
++ (NSArray<NSNumber *> *)filterItemIdsForUser:(NSString *)username
+                                       colors:(NSArray<NSString *> *)colors
+                                    materials:(NSArray<NSString *> *)materials
+                                   categories:(NSArray<NSString *> *)categories
+{
+    std::string u = [username UTF8String];
+    auto items = DataManager::getInstance().filterClothingItems(u,
+                                                                toStdStringVector(colors),
+                                                                toStdStringVector(materials),
+                                                                toStdStringVector(categories));
+    NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:items.size()];
+    for (const auto &record : items) {
+        [result addObject:@(record.id)];
     }
     return result;
 }
@@ -391,26 +931,78 @@ static NSDictionary<NSString *, id> *dictFromOutfit(
 + (NSArray<NSDictionary *> *)fetchAndFilterOutfitsForUser:(NSString *)username
                                                     season:(NSString *)season
 {
+    DD_METRIC_SCOPE("CppBridge::fetchAndFilterOutfitsForUser");
     std::string u = [username UTF8String];
     std::string s = [season UTF8String];
-    auto outfits = DataManager::getInstance().getOutfits(u);
-    auto items = DataManager::getInstance().getClothingItems(u);
-    unordered_map<int, shared_ptr<ClothingItem>> itemsById;
-    itemsById.reserve(items.size());
-    for (auto &itemPtr : items) {
-        if (itemPtr) {
-            itemsById[itemPtr->getId()] = itemPtr;
-        }
+    vector<string> seasons;
+    if (!s.empty()) {
+        seasons.push_back(s);
     }
+    auto outfits = DataManager::getInstance().filterResolvedOutfits(u, seasons);
 
-    NSMutableArray<NSDictionary *> *result = [NSMutableArray array];
-    for (auto &oPtr : outfits) {
-        if (!oPtr) { continue; }
-        if (s.empty() || oPtr->getSeason() == s) {
-            [result addObject:dictFromOutfit(oPtr, itemsById)];
-        }
+    NSMutableArray<NSDictionary *> *result = [NSMutableArray arrayWithCapacity:outfits.size()];
+    NSMutableDictionary<NSNumber *, NSDictionary *> *itemDicts = [NSMutableDictionary dictionary];
+    for (const auto &resolved : outfits) {
+        [result addObject:dictFromOutfit(resolved.outfit, resolved.items, itemDicts)];
     }
     return result;
 }
 
+#pragma mark – Metrici
+
++ (NSDictionary<NSString *, id> *)metricsSnapshot
+{
+    MetricsSnapshot snapshot = Metrics::getInstance().snapshot();
+    NSMutableArray<NSDictionary *> *timers = [NSMutableArray arrayWithCapacity:snapshot.timers.size()];
+    for (const auto &timer : snapshot.timers) {
+        [timers addObject:@{
+            @"name"    : [NSString stringWithUTF8String:timer.name.c_str()],
+            @"count"   : @(timer.count),
+            @"totalMs" : @(timer.totalMs),
+            @"p50Ms"   : @(timer.p50Ms),
+            @"p99Ms"   : @(timer.p99Ms),
+            @"maxMs"   : @(timer.maxMs)
+        }];
+    }
+    NSMutableDictionary<NSString *, NSNumber *> *counters = [NSMutableDictionary dictionaryWithCapacity:snapshot.counters.size()];
+    for (const auto &counter : snapshot.counters) {
+        counters[[NSString stringWithUTF8String:counter.name.c_str()]] = @(counter.value);
+    }
+    return @{ @"timers" : timers, @"counters" : counters };
+}
+
++ (void)resetMetrics
+{
+    Metrics::getInstance().reset();
+}
+
++ (void)setMetricsTracing:(BOOL)enabled
+{
+    Metrics::getInstance().setTracing(enabled);
+}
+
++ (NSString *)metricsTraceJSON
+{
+    return [NSString stringWithUTF8String:Metrics::getInstance().traceJSON().c_str()];
+}
+
+#if DEBUG
+#pragma mark – Date sintetice (doar debug)
+
++ (BOOL)seedSyntheticWardrobeForUser:(NSString *)username
+                               items:(NSInteger)items
+                             outfits:(NSInteger)outfits
+                          imageBytes:(NSInteger)imageBytes
+                                seed:(uint64_t)seed
+{
+    SyntheticWardrobe::Config config;
+    config.seed = seed;
+    config.itemCount = static_cast<size_t>(std::max<NSInteger>(items, 0));
+    config.outfitCount = static_cast<size_t>(std::max<NSInteger>(outfits, 0));
+    config.imageBytes = static_cast<size_t>(std::max<NSInteger>(imageBytes, 0));
+    auto wardrobe = SyntheticWardrobe::generate(config);
+    return SyntheticWardrobe::populate(DataManager::getInstance(), [username UTF8String], wardrobe);
+}
+#endif
+
 @end
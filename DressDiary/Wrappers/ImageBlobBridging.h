@@ -0,0 +1,33 @@
+#pragma once
+
+#import <Foundation/Foundation.h>
+#include "ImageBlob.hpp"
+
+// Conversii fara copiere intre NSData si ImageBlob (doar pentru fisierele .mm)
+
+// ImageBlob care arata direct in bufferul lui NSData; NSData ramane retinut cat traieste blob-ul
+inline ImageBlob blobFromNSData(NSData *data)
+{
+    if (!data || data.length == 0) {
+        return {};
+    }
+    NSData *immutable = [data copy];   // NSMutableData nu are buffer stabil
+    std::shared_ptr<const void> owner(CFBridgingRetain(immutable), [](const void *p) {
+        CFRelease(p);
+    });
+    return ImageBlob::wrap(static_cast<const std::uint8_t *>(immutable.bytes), immutable.length, std::move(owner));
+}
+
+// NSData care arata direct in bufferul blob-ului; blob-ul ramane in viata cat traieste NSData
+inline NSData *nsDataFromBlob(const ImageBlob &blob)
+{
+    if (blob.empty()) {
+        return [NSData data];
+    }
+    ImageBlob keepAlive = blob;
+    return [[NSData alloc] initWithBytesNoCopy:const_cast<std::uint8_t *>(blob.data())
+                                        length:blob.size()
+                                   deallocator:^(void *, NSUInteger) {
+                                       (void)keepAlive;
+                                   }];
+}